@@ -4,13 +4,14 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.1
+ * @version  1.2
  * @created  22.1.2013
- * @update   16.2.2015
+ * @update   17.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.2:  - Weckzeit als Member statt auf dem Heap (sie kommt jetzt aus den Settings).
  */
 #include "Alarm.h"
 
@@ -24,10 +25,9 @@
  *
  * @param speakerPin Der Pin, an dem der Lautsprecher oder Buzzer haengt.
  */
-Alarm::Alarm(byte speakerPin) {
+Alarm::Alarm(byte speakerPin) : _alarmTime(0, 7, 0, 0, 0, 0) {
     _speakerPin = speakerPin;
     pinMode(_speakerPin, OUTPUT);
-    _alarmTime = new TimeStamp(0, 7, 0, 0, 0, 0);
     _isActive = false;
     _showAlarmTimeTimer = 0;
 }
@@ -60,7 +60,7 @@ void Alarm::buzz(boolean on) {
  * @return Eine TimeStamp mit der eingstellten Weckzeit.
  */
 TimeStamp* Alarm::getAlarmTime() {
-    return _alarmTime;
+    return &_alarmTime;
 }
 
 /**
@@ -4,13 +4,14 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.1
+ * @version  1.2
  * @created  22.1.2013
- * @update   16.2.2015
+ * @update   17.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.2:  - Weckzeit als Member statt auf dem Heap (sie kommt jetzt aus den Settings).
  */
 #ifndef ALARM_H
 #define ALARM_H
@@ -35,7 +36,7 @@ public:
     boolean isActive();
 
 private:
-    TimeStamp *_alarmTime;
+    TimeStamp _alarmTime;
     boolean _isActive;
     byte _showAlarmTimeTimer;
     byte _speakerPin;
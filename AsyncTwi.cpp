@@ -0,0 +1,167 @@
+/**
+ * AsyncTwi
+ * Interrupt-getriebener I2C-Master (TWI) fuer die RTC.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "AsyncTwi.h"
+#include <util/twi.h>
+
+// TWI an, Interrupt an, Interrupt-Flag loeschen (= naechsten Schritt starten)
+#define ASYNCTWI_NEXT (_BV(TWEN) | _BV(TWIE) | _BV(TWINT))
+
+AsyncTwi::AsyncTwi() {
+    _state = ASYNCTWI_IDLE;
+    _address = 0;
+    _register = 0;
+    _reading = false;
+    _registerSent = false;
+    _index = 0;
+    _length = 0;
+    _started = 0;
+}
+
+/**
+ * Interne Pull-Ups an, Takt ASYNCTWI_FREQUENCY, TWI einschalten.
+ */
+void AsyncTwi::begin() {
+    digitalWrite(SDA, HIGH);
+    digitalWrite(SCL, HIGH);
+    TWSR = 0;
+    TWBR = ((F_CPU / ASYNCTWI_FREQUENCY) - 16) / 2;
+    TWCR = _BV(TWEN);
+    _state = ASYNCTWI_IDLE;
+}
+
+/**
+ * Das Lesen von count Registern ab reg anstossen. Laeuft noch eine
+ * Uebertragung, wird auf deren Ende gewartet.
+ */
+void AsyncTwi::startRead(byte address, byte reg, byte count) {
+    while (isBusy());
+    _address = address;
+    _register = reg;
+    _reading = true;
+    _length = min(count, ASYNCTWI_BUFFER);
+    start();
+}
+
+/**
+ * Das Schreiben von count Registern ab reg anstossen. Die Daten werden
+ * kopiert, data kann danach wiederverwendet werden.
+ */
+void AsyncTwi::startWrite(byte address, byte reg, const byte* data, byte count) {
+    while (isBusy());
+    _address = address;
+    _register = reg;
+    _reading = false;
+    _length = min(count, ASYNCTWI_BUFFER);
+    for (byte i = 0; i < _length; i++) {
+        _buffer[i] = data[i];
+    }
+    start();
+}
+
+/**
+ * Laeuft noch eine Uebertragung? Haengt sie zu lange, wird der TWI
+ * zurueckgesetzt.
+ */
+boolean AsyncTwi::isBusy() {
+    if (_state != ASYNCTWI_BUSY) {
+        return false;
+    }
+    if (millis() - _started > ASYNCTWI_TIMEOUT) {
+        TWCR = 0;
+        begin();
+        _state = ASYNCTWI_ERROR;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Die gelesenen Daten der letzten (fertigen) Uebertragung holen.
+ *
+ * @return FALSE, wenn sie fehlgeschlagen ist.
+ */
+boolean AsyncTwi::getData(byte* data, byte count) {
+    if ((_state != ASYNCTWI_IDLE) || (_index < count)) {
+        return false;
+    }
+    for (byte i = 0; i < count; i++) {
+        data[i] = _buffer[i];
+    }
+    return true;
+}
+
+/**
+ * Einen Schritt der Uebertragung ausfuehren, aus ISR(TWI_vect) aufzurufen.
+ */
+void AsyncTwi::interrupt() {
+    switch (TW_STATUS) {
+        case TW_START:
+        case TW_REP_START:
+            // Nach dem Register (und einem neuen Start) wird gelesen.
+            TWDR = (_address << 1) | ((_reading && _registerSent) ? TW_READ : TW_WRITE);
+            TWCR = ASYNCTWI_NEXT;
+            break;
+        case TW_MT_SLA_ACK:
+        case TW_MT_DATA_ACK:
+            if (!_registerSent) {
+                TWDR = _register;
+                _registerSent = true;
+                TWCR = ASYNCTWI_NEXT;
+            } else if (_reading) {
+                TWCR = ASYNCTWI_NEXT | _BV(TWSTA);
+            } else if (_index < _length) {
+                TWDR = _buffer[_index++];
+                TWCR = ASYNCTWI_NEXT;
+            } else {
+                stop(ASYNCTWI_IDLE);
+            }
+            break;
+        case TW_MR_SLA_ACK:
+            // beim letzten Byte kein ACK
+            TWCR = ASYNCTWI_NEXT | ((_length > 1) ? _BV(TWEA) : 0);
+            break;
+        case TW_MR_DATA_ACK:
+            _buffer[_index++] = TWDR;
+            TWCR = ASYNCTWI_NEXT | ((_index + 1 < _length) ? _BV(TWEA) : 0);
+            break;
+        case TW_MR_DATA_NACK:
+            _buffer[_index++] = TWDR;
+            stop(ASYNCTWI_IDLE);
+            break;
+        default:
+            // NACK, Arbitrierung verloren oder Busfehler
+            stop(ASYNCTWI_ERROR);
+            break;
+    }
+}
+
+/**
+ * Eine Uebertragung mit START beginnen.
+ */
+void AsyncTwi::start() {
+    // ein vorheriges STOP muss erst raus sein
+    while (TWCR & _BV(TWSTO));
+    _registerSent = false;
+    _index = 0;
+    _started = millis();
+    _state = ASYNCTWI_BUSY;
+    TWCR = ASYNCTWI_NEXT | _BV(TWSTA);
+}
+
+/**
+ * Die Uebertragung mit STOP beenden (ohne Interrupt, der TWI ist dann frei).
+ */
+void AsyncTwi::stop(byte state) {
+    TWCR = _BV(TWEN) | _BV(TWINT) | _BV(TWSTO);
+    _state = state;
+}
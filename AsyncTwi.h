@@ -0,0 +1,67 @@
+/**
+ * AsyncTwi
+ * Interrupt-getriebener I2C-Master (TWI) fuer die RTC. Anders als Wire wartet er
+ * nicht, bis eine Uebertragung fertig ist: startRead() bzw. startWrite() stossen
+ * sie nur an, den Rest erledigt interrupt() (aus ISR(TWI_vect)) Byte fuer Byte.
+ * Ob sie fertig ist, sagt isBusy(), das Ergebnis holt getData(). So haelt das
+ * Lesen der RTC loop() (und damit das Multiplexen) nicht mehr auf.
+ *
+ * Haengt der Bus laenger als ASYNCTWI_TIMEOUT ms, wird der TWI zurueckgesetzt
+ * und die Uebertragung gilt als fehlgeschlagen.
+ * Ersetzt Wire komplett (beide belegen TWI_vect).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef ASYNCTWI_H
+#define ASYNCTWI_H
+
+#include "Arduino.h"
+#include "Configuration.h"
+
+#define ASYNCTWI_FREQUENCY 100000L
+#define ASYNCTWI_BUFFER    8
+#define ASYNCTWI_TIMEOUT   10
+
+#define ASYNCTWI_IDLE  0
+#define ASYNCTWI_BUSY  1
+#define ASYNCTWI_ERROR 2
+
+class AsyncTwi {
+public:
+    AsyncTwi();
+
+    void begin();
+
+    void startRead(byte address, byte reg, byte count);
+    void startWrite(byte address, byte reg, const byte* data, byte count);
+    boolean isBusy();
+    boolean getData(byte* data, byte count);
+
+    void interrupt();
+
+private:
+    volatile byte _state;
+    byte _address;
+    byte _register;
+    boolean _reading;
+    volatile boolean _registerSent;
+    byte _buffer[ASYNCTWI_BUFFER];
+    volatile byte _index;
+    byte _length;
+    unsigned long _started;
+
+    void start();
+    void stop(byte state);
+};
+
+#ifdef ENABLE_ASYNC_TWI
+extern AsyncTwi twi;
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * ChangeDetector
+ * Merkt sich den zuletzt ausgegebenen Bildschirm-Puffer und meldet nur dann
+ * eine Aenderung, wenn sich der Inhalt wirklich geaendert hat.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "ChangeDetector.h"
+#include "Configuration.h"
+
+ChangeDetector::ChangeDetector() {
+    _valid = false;
+    _frames = 0;
+    _changes = 0;
+}
+
+/**
+ * Den neu gerenderten Bildschirm-Puffer mit dem letzten vergleichen.
+ *
+ * @return TRUE, wenn er an den LED-Treiber muss.
+ */
+boolean ChangeDetector::hasChanged(word matrix[16]) {
+    _frames++;
+    boolean changed = !_valid;
+    for (byte i = 0; i < 16; i++) {
+        if (_last[i] != matrix[i]) {
+            _last[i] = matrix[i];
+            changed = true;
+        }
+    }
+    _valid = true;
+    if (changed) {
+        _changes++;
+    }
+    return changed;
+}
+
+/**
+ * Beim naechsten Vergleich auf jeden Fall eine Aenderung melden
+ * (z.B. wenn der Treiber wieder eingeschaltet wurde).
+ */
+void ChangeDetector::invalidate() {
+    _valid = false;
+}
+
+/**
+ * Die Zahl der gerenderten Bilder.
+ */
+unsigned long ChangeDetector::getFrames() {
+    return _frames;
+}
+
+/**
+ * Die Zahl der Bilder, die an den LED-Treiber gingen.
+ */
+unsigned long ChangeDetector::getChanges() {
+    return _changes;
+}
+
+/**
+ * Die Zaehler maschinenlesbar ausgeben: 'DIFF,<gerendert>,<geaendert>'.
+ */
+void ChangeDetector::printCounters() {
+    Serial.print(F("DIFF,"));
+    Serial.print(_frames);
+    Serial.print(F(","));
+    Serial.println(_changes);
+}
@@ -0,0 +1,44 @@
+/**
+ * ChangeDetector
+ * Merkt sich den zuletzt ausgegebenen Bildschirm-Puffer und meldet nur dann
+ * eine Aenderung, wenn sich der Inhalt wirklich geaendert hat. loop() rendert
+ * jede Sekunde neu, die Woerter aendern sich aber nur alle fuenf Minuten.
+ * Ohne Aenderung bleibt der LED-Treiber unberuehrt (kein neues Ueberblenden,
+ * kein erneutes Rausschieben).
+ *
+ * Verglichen wird der ganze Puffer statt eines Hashes, damit keine Aenderung
+ * durch eine Kollision verloren geht.
+ * RAM: 16 words Kopie + Flag + 2 Zaehler = 41 Bytes.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef CHANGEDETECTOR_H
+#define CHANGEDETECTOR_H
+
+#include "Arduino.h"
+
+class ChangeDetector {
+public:
+    ChangeDetector();
+
+    boolean hasChanged(word matrix[16]);
+    void invalidate();
+
+    unsigned long getFrames();
+    unsigned long getChanges();
+    void printCounters();
+
+private:
+    word _last[16];
+    boolean _valid;
+    unsigned long _frames;
+    unsigned long _changes;
+};
+
+#endif
@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.5
+ * @version  1.26
  * @created  23.1.2013
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt
@@ -18,6 +18,27 @@
  *         - PWM_DURATION an neue LDR-Klasse angepasst. 
  *         - DCF77_SIGNAL_IS_INVERTED jetzt im EEPROM.
  * V 1.5:  - Diverse Config-Moeglichkeiten fuer die verschiedenen LED-Driver eingefuehrt.
+ * V 1.6:  - MULTIPLEX_IN_ISR eingefuehrt.
+ * V 1.7:  - LED_DRIVER_BAM eingefuehrt.
+ * V 1.8:  - ENABLE_TRANSITIONS und die Uebergaenge pro Modus eingefuehrt.
+ * V 1.9:  - SHIFTREGISTER_SPI und SHIFTREGISTER_USART_SPI eingefuehrt.
+ * V 1.10: - ENABLE_PROFILER eingefuehrt.
+ * V 1.11: - ENABLE_LANGUAGE_XX eingefuehrt.
+ * V 1.12: - MYDCF77_EDGE_INTERRUPT eingefuehrt.
+ * V 1.13: - MYDCF77_SOFT_DECODER eingefuehrt.
+ * V 1.14: - ENABLE_DCF77_TELEMETRY eingefuehrt.
+ * V 1.15: - ENABLE_DCF77_SCHEDULER eingefuehrt.
+ * V 1.16: - ENABLE_RTC_DRIFT eingefuehrt.
+ * V 1.17: - ENABLE_ASYNC_TWI eingefuehrt.
+ * V 1.18: - ENABLE_OFFLINE_DST eingefuehrt.
+ * V 1.19: - EXT_MODE_TIMEOUT eingefuehrt.
+ * V 1.20: - DPIN_PORT/_PIN/_MODE ueber _SFR_MEM8(), damit sie auch im Host-HAL (host/) gehen.
+ * V 1.21: - ENABLE_TRANSITIONS standardmaessig aus und nur mit LED_DRIVER_BAM.
+ * V 1.22: - Mit SHIFTREGISTER_USART_SPI geht Serial ins Leere (NullSerial.h).
+ * V 1.23: - ENABLE_SEQUENTIAL_LOOP eingefuehrt.
+ * V 1.24: - Auskommentiertes DPIN-Makro als Blockkommentar (-Wcomment).
+ * V 1.25: - ENABLE_PROFILER entfernt, die Laufzeiten misst tests/bench_profile.cpp auf dem Host.
+ * V 1.26: - ENABLE_SEQUENTIAL_LOOP entfernt, die alte loop() steckt in tests/bench_refresh_gap.cpp.
  */
 #ifndef CONFIGURATION_H
 #define CONFIGURATION_H
@@ -51,6 +72,7 @@
  * Welcher LED-Treiber soll benutzt werden?
  */
    #define LED_DRIVER_DEFAULT
+// #define LED_DRIVER_BAM
 // #define LED_DRIVER_UEBERPIXEL
 // #define LED_DRIVER_POWER_SHIFT_REGISTER
 // #define LED_DRIVER_NEOPIXEL
@@ -70,6 +92,31 @@
 // #define REMOTE_SPARKFUN
 // #define REMOTE_MOONCANDLES
    #define REMOTE_LUNARTEC
+
+/*
+ * Welche Sprachen sollen in die Firmware? Die Uhr hat meist nur eine Front,
+ * jede ausgeschaltete Sprache spart ihre Tabellen und ihren Code im Flash.
+ * Im Modus 'Sprache' kann nur zwischen den eingeschalteten Sprachen gewechselt
+ * werden. ENABLE_LANGUAGE_DE umfasst alle deutschen Varianten (DE, SW, BA, SA).
+ * Default: alle eingeschaltet
+ */
+   #define ENABLE_LANGUAGE_DE
+   #define ENABLE_LANGUAGE_CH
+   #define ENABLE_LANGUAGE_EN
+   #define ENABLE_LANGUAGE_FR
+   #define ENABLE_LANGUAGE_IT
+   #define ENABLE_LANGUAGE_NL
+   #define ENABLE_LANGUAGE_ES
+
+/*
+ * Daten zur DCF77-Empfangsqualitaet sammeln? Dann gibt 'T' ueber Serial Pulslaengen,
+ * Fehlergruende, letzte Synchronisation und Tastgrad aus und der Modus 'DCF77-Statistik'
+ * (nach 'DCF77-Debug') zeigt die Pulslaengen als Balken, die Ecken die decodierten der
+ * letzten vier Minuten. Siehe DCF77Telemetry.h.
+ * Kostet ca. 60 Bytes RAM.
+ * Default: ausgeschaltet
+ */
+// #define ENABLE_DCF77_TELEMETRY
    
 /*
  *
@@ -90,6 +137,15 @@
  * (default = 8)
  */
    #define PWM_DURATION 8
+/*
+ * Das Multiplexing per Timer1-Interrupt erledigen statt in loop(). Die Zeilen werden
+ * dann in festem Takt ausgegeben und die Helligkeit ueber einen Compare-Match auf
+ * OutputEnable geregelt. loop() wird nicht mehr durch delayMicroseconds() gebremst
+ * und Tasten, IR, I2C und DCF77 stoeren die Anzeige nicht mehr (und umgekehrt).
+ * Achtung: Timer1 ist dann belegt (IR benutzt Timer2, millis() Timer0).
+ * Default: ausgeschaltet
+ */
+// #define MULTIPLEX_IN_ISR
 /*
  * Dieser Schalter stellt die Anzeige auf den Kopf, falls man die Kabel beim Anoden-
  * multiplexer nicht kreuzen moechte oder es vergessen hat.
@@ -101,12 +157,70 @@
  * Default: Eingeschaltet.
  */
    #define SHIFTREGISTER_TURBO
+/*
+ * Die Shift-Register ueber die SPI-Hardware beschreiben statt per Bit-Banging.
+ * Mit MULTIPLEX_IN_ISR wird dann die naechste Zeile geschoben, waehrend die
+ * aktuelle leuchtet. Achtung, andere Verkabelung (siehe Qlockthree.ino):
+ * - SHIFTREGISTER_SPI: Data an D11 (MOSI), Clock an D13 (SCK), Latch an D10.
+ *   Der Lautsprecher wandert von D13 an A2.
+ * - SHIFTREGISTER_USART_SPI: Data an D1 (TXD), Clock an D4 (XCK). Die serielle
+ *   Schnittstelle (und damit DEBUG) und die SQW-LED entfallen, Serial geht ins
+ *   Leere (NullSerial.h).
+ * Nur fuer LED_DRIVER_DEFAULT und LED_DRIVER_BAM.
+ * Default: ausgeschaltet
+ */
+// #define SHIFTREGISTER_SPI
+// #define SHIFTREGISTER_USART_SPI
+
+#if (defined(SHIFTREGISTER_SPI) || defined(SHIFTREGISTER_USART_SPI)) && !defined(LED_DRIVER_DEFAULT) && !defined(LED_DRIVER_BAM)
+  #error "SHIFTREGISTER_SPI und SHIFTREGISTER_USART_SPI gehen nur mit LED_DRIVER_DEFAULT und LED_DRIVER_BAM."
+#endif
+#ifdef SHIFTREGISTER_USART_SPI
+  // Die USART gehoert den Shift-Registern, Serial.begin() und jede Ausgabe wuerden dazwischenfunken.
+  #include "NullSerial.h"
+  #define Serial nullSerial
+#endif
 /*
  * Noch optimiertes Schreiben von 0 und FFFF?
  * Default: Ausgeschaltet
  */
 // #define OPTIMIZED_FOR_DARKNESS
 
+// ------------------ BAM Display Driver ---------------------
+/*
+ * Die kuerzeste Bitebene des LED_DRIVER_BAM in Mikrosekunden. Eine Zeile
+ * dauert 255 * BAM_UNIT (plus Schieben), bei 10 Zeilen und 4us also ca. 98Hz.
+ * Default: 4
+ */
+   #define BAM_UNIT 4
+
+// ------------------ Uebergaenge ---------------------
+/*
+ * Uebergaenge zwischen zwei Anzeigen ueber den Graustufen-Bildspeicher rendern.
+ * Das geht nur mit Treibern mit Helligkeit pro LED (LED_DRIVER_BAM). Die anderen
+ * wuerden jeden Schritt als neue Anzeige bekommen und dabei ihr eigenes
+ * Ueberblenden neu starten, deshalb ist es dort unten wieder ausgeschaltet.
+ * Default: ausgeschaltet
+ */
+// #define ENABLE_TRANSITIONS
+/*
+ * Der Uebergang beim Wechsel der Uhrzeit und beim Wechsel des Modus.
+ * Moeglich: TRANSITION_NONE, TRANSITION_CROSSFADE, TRANSITION_WIPE,
+ * TRANSITION_LETTERS, TRANSITION_RAIN.
+ * Default: TRANSITION_CROSSFADE, TRANSITION_WIPE
+ */
+   #define TRANSITION_TIME        TRANSITION_CROSSFADE
+   #define TRANSITION_MODE_CHANGE TRANSITION_WIPE
+/*
+ * Die Dauer eines Uebergangsschritts in Millisekunden.
+ * Default: 40
+ */
+   #define TRANSITION_STEP_DURATION 40
+
+#ifndef LED_DRIVER_BAM
+  #undef ENABLE_TRANSITIONS
+#endif
+
 // ------------------ Tasten --------------------- 
 /*
  * Die Zeit in Millisekunden, innerhalb derer Prellungen der Taster nicht als Druecken zaehlen.
@@ -114,6 +228,12 @@
  * Default: 300
  */
    #define BUTTON_TRESHOLD 300
+/*
+ * Nach so vielen Sekunden ohne Taste kehren die Einstell-Modi (EXT_MODE_*) von selbst
+ * zur Zeitanzeige zurueck, hoechstens 255. Test, DCF77-Debug und DCF77-Statistik bleiben stehen.
+ * Default: 60
+ */
+   #define EXT_MODE_TIMEOUT 60
 
 // ------------------ DCF77-Empfaenger ---------------------
 /*
@@ -127,6 +247,74 @@
  */
 // #define MYDCF77_SIGNAL_IS_ANALOG
 // #define MYDCF77_ANALOG_SIGNAL_TRESHOLD 600
+/*
+ * Das DCF77-Signal per Pin-Change-Interrupt auswerten: jede Flanke bekommt einen
+ * Zeitstempel, 0 und 1 (100ms und 200ms) und der Minutenanfang werden ueber die Zeit
+ * erkannt. Das haengt dann nicht mehr davon ab, wie schnell loop() laeuft (Helligkeit,
+ * Ueberblenden, IR...), MYDCF77_MEANCOUNT und MYDCF77_MEANSTARTVALUE sind ohne Bedeutung.
+ * Geht nicht mit einem analogen Pin, dann wird wie bisher in loop() gezaehlt.
+ * Default: eingeschaltet
+ */
+   #define MYDCF77_EDGE_INTERRUPT
+#ifdef MYDCF77_SIGNAL_IS_ANALOG
+  #undef MYDCF77_EDGE_INTERRUPT
+#endif
+/*
+ * Fuer schwachen Empfang (z.B. im Haus): statt jeden Puls hart als 0 oder 1 zu
+ * entscheiden, rastet der Dekoder ueber viele Sekunden auf die Phase der Sekunde
+ * und der Minute ein und sammelt fuer jedes Bit eine Sicherheit. Stunde und Datum
+ * werden ueber mehrere Minuten gesammelt, kippt eine Paritaet, wird das unsicherste
+ * Bit korrigiert. Eine Minute zaehlt erst, wenn sie sicher genug ist. Das Einrasten
+ * dauert ein paar Minuten.
+ * Braucht MYDCF77_EDGE_INTERRUPT. Kostet ca. 190 Bytes RAM.
+ * Default: ausgeschaltet
+ */
+// #define MYDCF77_SOFT_DECODER
+#ifndef MYDCF77_EDGE_INTERRUPT
+  #undef MYDCF77_SOFT_DECODER
+#endif
+/*
+ * Den DCF77-Empfaenger nur einschalten, wenn eine Synchronisation faellig ist (sonst
+ * laeuft er immer). Aus der Drift der RTC zwischen zwei Synchronisationen wird der
+ * naechste Termin berechnet: dann, wenn die RTC um DCF77_SCHEDULER_MAX_OFFSET Sekunden
+ * daneben liegen koennte, aber frueher als nach DCF77_SCHEDULER_MIN_INTERVAL und
+ * spaetestens nach DCF77_SCHEDULER_MAX_INTERVAL Minuten. Nachts (Display aus) wird
+ * bevorzugt. Klappt der Empfang nicht innerhalb von DCF77_SCHEDULER_WINDOW Minuten,
+ * wird es spaeter nochmal versucht. In den DCF77-Modi laeuft der Empfaenger immer.
+ * Spart Strom, Rechenzeit in loop() und Stoerungen durch den Empfaenger.
+ * Default: ausgeschaltet
+ */
+// #define ENABLE_DCF77_SCHEDULER
+   #define DCF77_SCHEDULER_MAX_OFFSET 2
+   #define DCF77_SCHEDULER_MIN_INTERVAL 60
+   #define DCF77_SCHEDULER_MAX_INTERVAL 1440
+   #define DCF77_SCHEDULER_WINDOW 30
+/*
+ * Die Drift der RTC bei jeder DCF77-Synchronisation messen und ausgleichen: bei der
+ * DS3231 ueber das Aging-Offset-Register, bei der DS1307 in Software (ab und zu eine
+ * Sekunde stellen). Die Korrektur wird im EEPROM gesichert. Damit bleibt die Uhr auch
+ * mit seltenen Synchronisationen (ENABLE_DCF77_SCHEDULER) auf eine Sekunde genau.
+ * Default: ausgeschaltet
+ */
+// #define ENABLE_RTC_DRIFT
+/*
+ * Die RTC ueber einen eigenen, interrupt-getriebenen I2C-Treiber (AsyncTwi) statt ueber
+ * die Wire-Library ansprechen. Das Lesen beim Minutenwechsel haelt loop() (und damit das
+ * Multiplexen ohne MULTIPLEX_IN_ISR) dann nicht mehr auf. Nur fuer die AVR-Hardware-TWI.
+ * Default: ausgeschaltet
+ */
+// #define ENABLE_ASYNC_TWI
+/*
+ * Die Sommerzeit ohne DCF77 selbst umstellen, fuer Uhren ausserhalb der Reichweite des
+ * Senders. OFFLINE_DST_RULE ist TIMESTAMP_DST_EU oder TIMESTAMP_DST_US (siehe TimeStamp.h),
+ * OFFLINE_DST_UTC_OFFSET der Abstand der Normalzeit zu UTC in Minuten (die EU-Regel
+ * schaltet zur gleichen UTC-Zeit, in London also um 1:00 Uhr, in Helsinki um 3:00 Uhr).
+ * Eine DCF77-Synchronisation stellt weiter auf deutsche Zeit.
+ * Default: ausgeschaltet, TIMESTAMP_DST_EU, 60
+ */
+// #define ENABLE_OFFLINE_DST
+   #define OFFLINE_DST_RULE TIMESTAMP_DST_EU
+   #define OFFLINE_DST_UTC_OFFSET 60
 /*
  * Die Timing-Werte fuer den DCF77-Empfaenger.
  * Default: 1700, 185, 85.
@@ -158,6 +346,9 @@
 #ifdef LED_DRIVER_DEFAULT
   #define MYDCF77_MEANSTARTVALUE 7
 #endif
+#ifdef LED_DRIVER_BAM
+  #define MYDCF77_MEANSTARTVALUE 1300
+#endif
 #ifdef LED_DRIVER_UEBERPIXEL
   #define MYDCF77_MEANSTARTVALUE 1300
 #endif
@@ -213,6 +404,9 @@
 #ifdef LED_DRIVER_DEFAULT
   #define LDR_CHECK_RATE 1
 #endif
+#ifdef LED_DRIVER_BAM
+  #define LDR_CHECK_RATE 10
+#endif
 #ifdef LED_DRIVER_UEBERPIXEL
   #define LDR_CHECK_RATE 7
 #endif
@@ -230,20 +424,22 @@
 #endif
 
 
-//#define DPIN(port, pin, mode, _bit) ( \
-//  (static_cast<uint32_t>(&port) << 24) | \
-//  (static_cast<uint32_t>(&pin) << 16) | \
-//  (static_cast<uint32_t>(&mode) << 8) | \
-//  static_cast<uint32_t>(_bit))
+/*
+#define DPIN(port, pin, mode, _bit) ( \
+  (static_cast<uint32_t>(&port) << 24) | \
+  (static_cast<uint32_t>(&pin) << 16) | \
+  (static_cast<uint32_t>(&mode) << 8) | \
+  static_cast<uint32_t>(_bit))
+*/
 #define DPIN(port, pin, mode, _bit) ( \
   ((uint32_t)port << 24) | \
   ((uint32_t)pin << 16) | \
   ((uint32_t)mode << 8) | \
   (uint32_t)_bit)
 #define DPIN_BIT(dpin)  ((uint8_t)1 << (dpin & 7))
-#define DPIN_PORT(dpin) *(volatile uint8_t *)((dpin >> 24) & 0xff)
-#define DPIN_PIN(dpin)  *(volatile uint8_t *)((dpin >> 16) & 0xff)
-#define DPIN_MODE(dpin) *(volatile uint8_t *)((dpin >> 8) & 0xff)
+#define DPIN_PORT(dpin) _SFR_MEM8((dpin >> 24) & 0xff)
+#define DPIN_PIN(dpin)  _SFR_MEM8((dpin >> 16) & 0xff)
+#define DPIN_MODE(dpin) _SFR_MEM8((dpin >> 8) & 0xff)
 
 #define DPIN_OUTPUT(dpin) DPIN_MODE(dpin) |= DPIN_BIT(dpin)
 #define DPIN_INPUT(dpin) DPIN_MODE(dpin) &= ~DPIN_BIT(dpin)
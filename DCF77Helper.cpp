@@ -2,12 +2,14 @@
  * DCF77Helper
  * Klasse um die Qualitaet der DCF77-Samples zu verbessern. Dazu wird der Minutenabstand
  * zwischen den empfangenen DCF77-Samples mit Hilfe der Echtzeituhr verglichen.
+ * Jeder Zeitstempel ist die Zahl der Minuten seit dem 1.1.2000 (4 Bytes), dadurch
+ * wird das Datum mitgeprueft und Mitternacht oder ein Monatswechsel stoeren nicht.
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.8
+ * @version  1.10
  * @created  19.3.2011
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.1:  - Fehler in der Initialisierung behoben.
@@ -18,70 +20,85 @@
  * V 1.6:  - Optimierung hinsichtlich Speicherbedarf.
  * V 1.7:  - Verbessertes Debugging.
  * V 1.8:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.9:  - Gepackte Minuten seit 1.1.2000 in einem festen Ring statt TimeStamps auf dem Heap,
+ *           Samples per Referenz, Abstaende stimmen auch ueber Mitternacht und Monatsgrenzen.
+ * V 1.10: - minutesSince2000() nach TimeStamp verschoben.
  */
 #include "DCF77Helper.h"
+#include "TimeStamp.h"
 
 // #define DEBUG
 #include "Debug.h"
 
 /**
- * Initialisierung und das Array 'falsch' vorbelegen, damit der Zeitabstand
- * der Samples zum Anfang nicht stimmt.
+ * Initialisierung. Bis der Ring voll ist, gelten die Samples als nicht ok.
  */
 DCF77Helper::DCF77Helper() {
     _cursor = 0;
-    for (byte i = 0; i < DCF77HELPER_MAX_SAMPLES; i++) {
-        _zeitstempelDcf77[i] = new TimeStamp(i, i, i, i, i, i);
-        _zeitstempelRtc[i] = new TimeStamp(100, 0, 0, 0, 0, 0);
-    }
+    _count = 0;
 }
 
 /**
  * Einen neuen Sample hinzufuegen.
  */
-void DCF77Helper::addSample(MyDCF77 dcf77, MyRTC rtc) {
-    DEBUG_PRINT(F("Adding sample from dcf77: "));
-    _zeitstempelDcf77[_cursor]->setFrom(dcf77);
-    DEBUG_PRINTLN(_zeitstempelDcf77[_cursor]->asString());
+void DCF77Helper::addSample(MyDCF77& dcf77, MyRTC& rtc) {
+    _zeitstempelDcf77[_cursor] = TimeStamp::minutesSince2000(dcf77.getMinutes(), dcf77.getHours(), dcf77.getDate(), dcf77.getMonth(), dcf77.getYear());
+    _zeitstempelRtc[_cursor] = TimeStamp::minutesSince2000(rtc.getMinutes(), rtc.getHours(), rtc.getDate(), rtc.getMonth(), rtc.getYear());
 
-    DEBUG_PRINT(F("Adding sample from rtc: "));
-    _zeitstempelRtc[_cursor]->setFrom(rtc);
-    DEBUG_PRINTLN(_zeitstempelRtc[_cursor]->asString());
+    DEBUG_PRINT(F("Adding sample from dcf77: "));
+    DEBUG_PRINT(_zeitstempelDcf77[_cursor]);
+    DEBUG_PRINT(F(", rtc: "));
+    DEBUG_PRINTLN(_zeitstempelRtc[_cursor]);
     DEBUG_FLUSH();
 
     _cursor++;
     if (_cursor == DCF77HELPER_MAX_SAMPLES) {
         _cursor = 0;
     }
+    if (_count < DCF77HELPER_MAX_SAMPLES) {
+        _count++;
+    }
 }
 
 /**
- * Die Samples vergleichen
+ * Die Samples vergleichen: Der Ring muss voll sein und die Abstaende
+ * aufeinanderfolgender DCF77-Samples muessen denen der RTC entsprechen.
  */
 boolean DCF77Helper::samplesOk() {
+    if (_count < DCF77HELPER_MAX_SAMPLES) {
+        DEBUG_PRINTLN(F("Not enough samples."));
+        DEBUG_FLUSH();
+        return false;
+    }
+
     boolean ret = true;
-    for (byte i = 0; i < DCF77HELPER_MAX_SAMPLES - 1; i++) {
+    byte i = _cursor;
+    for (byte n = 0; n < DCF77HELPER_MAX_SAMPLES - 1; n++) {
+        byte next = (i + 1 == DCF77HELPER_MAX_SAMPLES) ? 0 : i + 1;
         // Teste den Minutenabstand zwischen den Zeitstempeln...
-        if ((_zeitstempelDcf77[i]->getMinutesOfDay() - _zeitstempelDcf77[i + 1]->getMinutesOfDay()) != (_zeitstempelRtc[i]->getMinutesOfDay() - _zeitstempelRtc[i + 1]->getMinutesOfDay())) {
+        long diffDcf77 = _zeitstempelDcf77[next] - _zeitstempelDcf77[i];
+        long diffRtc = _zeitstempelRtc[next] - _zeitstempelRtc[i];
+        if (diffDcf77 != diffRtc) {
             DEBUG_PRINT(F("Diff #"));
-            DEBUG_PRINT(i);
+            DEBUG_PRINT(n);
             DEBUG_PRINT(F(" distance is wrong ("));
-            DEBUG_PRINT(_zeitstempelDcf77[i]->getMinutesOfDay() - _zeitstempelDcf77[i + 1]->getMinutesOfDay());
+            DEBUG_PRINT(diffDcf77);
             DEBUG_PRINT(F("!="));
-            DEBUG_PRINT(_zeitstempelRtc[i]->getMinutesOfDay() - _zeitstempelRtc[i + 1]->getMinutesOfDay());
+            DEBUG_PRINT(diffRtc);
             DEBUG_PRINTLN(F(")."));
             DEBUG_FLUSH();
             ret = false;
         } else {
             DEBUG_PRINT(F("Diff #"));
-            DEBUG_PRINT(i);
+            DEBUG_PRINT(n);
             DEBUG_PRINT(F(" distance is ok ("));
-            DEBUG_PRINT(_zeitstempelDcf77[i]->getMinutesOfDay() - _zeitstempelDcf77[i + 1]->getMinutesOfDay());
+            DEBUG_PRINT(diffDcf77);
             DEBUG_PRINT(F("=="));
-            DEBUG_PRINT(_zeitstempelRtc[i]->getMinutesOfDay() - _zeitstempelRtc[i + 1]->getMinutesOfDay());
+            DEBUG_PRINT(diffRtc);
             DEBUG_PRINTLN(F(")."));
             DEBUG_FLUSH();
         }
+        i = next;
     }
 
     return ret;
@@ -2,12 +2,14 @@
  * DCF77Helper
  * Klasse um die Qualitaet der DCF77-Samples zu verbessern. Dazu wird der Minutenabstand
  * zwischen den empfangenen DCF77-Samples mit Hilfe der Echtzeituhr verglichen.
+ * Jeder Zeitstempel ist die Zahl der Minuten seit dem 1.1.2000 (4 Bytes), dadurch
+ * wird das Datum mitgeprueft und Mitternacht oder ein Monatswechsel stoeren nicht.
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.8
+ * @version  1.10
  * @created  19.3.2011
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.1:  - Fehler in der Initialisierung behoben.
@@ -18,6 +20,9 @@
  * V 1.6:  - Optimierung hinsichtlich Speicherbedarf.
  * V 1.7:  - Verbessertes Debugging.
  * V 1.8:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.9:  - Gepackte Minuten seit 1.1.2000 in einem festen Ring statt TimeStamps auf dem Heap,
+ *           Samples per Referenz, Abstaende stimmen auch ueber Mitternacht und Monatsgrenzen.
+ * V 1.10: - minutesSince2000() nach TimeStamp verschoben.
  */
 #ifndef DCF77HELPER_H
 #define DCF77HELPER_H
@@ -25,20 +30,20 @@
 #include "Arduino.h"
 #include "MyRTC.h"
 #include "MyDCF77.h"
-#include "TimeStamp.h"
 #include "Configuration.h"
 
 class DCF77Helper {
 public:
     DCF77Helper();
 
-    void addSample(MyDCF77 dcf77, MyRTC rtc);
+    void addSample(MyDCF77& dcf77, MyRTC& rtc);
     boolean samplesOk();
 
 private:
     byte _cursor;
-    TimeStamp *_zeitstempelDcf77[DCF77HELPER_MAX_SAMPLES];
-    TimeStamp *_zeitstempelRtc[DCF77HELPER_MAX_SAMPLES];
+    byte _count;
+    unsigned long _zeitstempelDcf77[DCF77HELPER_MAX_SAMPLES];
+    unsigned long _zeitstempelRtc[DCF77HELPER_MAX_SAMPLES];
 };
 
 #endif
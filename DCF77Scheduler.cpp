@@ -0,0 +1,109 @@
+/**
+ * DCF77Scheduler
+ * Entscheidet, wann der DCF77-Empfaenger laufen muss.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "DCF77Scheduler.h"
+
+// #define DEBUG
+#include "Debug.h"
+
+DCF77Scheduler::DCF77Scheduler() {
+    _receiving = true;
+    _synced = false;
+    _lastSync = 0;
+    _nextSync = 0;
+    _windowStart = 0;
+    _interval = DCF77_SCHEDULER_MIN_INTERVAL;
+}
+
+/**
+ * Einmal pro Minute (oder oefter) aufrufen.
+ *
+ * @param now Minuten seit 2000 nach der RTC.
+ * @param night TRUE, wenn die LEDs nachts aus sind.
+ * @param force TRUE, wenn der Empfaenger auf jeden Fall laufen soll (z.B. im DCF77-Debug-Modus).
+ * @return TRUE, wenn der Empfaenger laufen soll.
+ */
+boolean DCF77Scheduler::update(unsigned long now, boolean night, boolean force) {
+    if (!_synced || force) {
+        _receiving = true;
+        _windowStart = now;
+        return true;
+    }
+
+    // Die Zeit wurde von Hand zurueckgestellt: nicht ewig warten.
+    if ((long)(_nextSync - now) > DCF77_SCHEDULER_MAX_INTERVAL) {
+        _nextSync = now;
+    }
+
+    if (_receiving) {
+        if ((long)(now - _windowStart) >= DCF77_SCHEDULER_WINDOW) {
+            DEBUG_PRINTLN(F("No DCF77 sync in window, retrying later."));
+            DEBUG_FLUSH();
+            _receiving = false;
+            _nextSync = now + DCF77_SCHEDULER_MIN_INTERVAL;
+        }
+    } else {
+        unsigned long start = _nextSync;
+        if (night) {
+            start -= _interval / 4;
+        }
+        if ((long)(now - start) >= 0) {
+            DEBUG_PRINTLN(F("DCF77 sync due."));
+            DEBUG_FLUSH();
+            _receiving = true;
+            _windowStart = now;
+        }
+    }
+    return _receiving;
+}
+
+/**
+ * Die Zeit wurde von DCF77 uebernommen.
+ *
+ * @param now Minuten seit 2000 nach DCF77.
+ * @param offset Abweichung der RTC vor dem Stellen in Sekunden (positiv = RTC vor).
+ */
+void DCF77Scheduler::synced(unsigned long now, long offset) {
+    if (_synced) {
+        // Die Messung ist nur auf etwa eine Sekunde genau, deshalb
+        // eine Sekunde mehr Abweichung annehmen.
+        unsigned long elapsed = now - _lastSync;
+        unsigned long interval = elapsed * DCF77_SCHEDULER_MAX_OFFSET / (abs(offset) + 1);
+        _interval = constrain(interval, DCF77_SCHEDULER_MIN_INTERVAL, DCF77_SCHEDULER_MAX_INTERVAL);
+        DEBUG_PRINT(F("RTC offset "));
+        DEBUG_PRINT(offset);
+        DEBUG_PRINT(F("s after "));
+        DEBUG_PRINT(elapsed);
+        DEBUG_PRINT(F(" min, next sync in "));
+        DEBUG_PRINT(_interval);
+        DEBUG_PRINTLN(F(" min."));
+        DEBUG_FLUSH();
+    }
+    _synced = true;
+    _receiving = false;
+    _lastSync = now;
+    _nextSync = now + _interval;
+}
+
+/**
+ * Der aktuelle Abstand der Synchronisationen in Minuten.
+ */
+word DCF77Scheduler::getInterval() {
+    return _interval;
+}
+
+/**
+ * Die naechste geplante Synchronisation in Minuten seit 2000.
+ */
+unsigned long DCF77Scheduler::getNextSync() {
+    return _nextSync;
+}
@@ -0,0 +1,51 @@
+/**
+ * DCF77Scheduler
+ * Entscheidet, wann der DCF77-Empfaenger laufen muss. Nach einer Synchronisation
+ * wird er abgeschaltet. Aus der Abweichung der RTC bei der naechsten Synchronisation
+ * und der Zeit dazwischen ergibt sich die Drift, daraus der Abstand, nach dem die
+ * Abweichung DCF77_SCHEDULER_MAX_OFFSET Sekunden erreicht. Die RTC (DS3231) driftet
+ * nur ein paar Sekunden im Monat, der Abstand waechst also schnell bis
+ * DCF77_SCHEDULER_MAX_INTERVAL.
+ * Nachts (STD_MODE_NIGHT, LEDs aus und damit weniger Stoerungen) darf bis zu einem
+ * Viertel des Abstands frueher empfangen werden.
+ * Klappt es in DCF77_SCHEDULER_WINDOW Minuten nicht, wird nach
+ * DCF77_SCHEDULER_MIN_INTERVAL Minuten wieder versucht. Bis zur ersten
+ * Synchronisation nach dem Einschalten laeuft der Empfaenger immer.
+ *
+ * Gerechnet wird in Minuten seit 2000 nach der RTC (TimeStamp::minutesSince2000()),
+ * dadurch stoert der Ueberlauf von millis() nicht.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef DCF77SCHEDULER_H
+#define DCF77SCHEDULER_H
+
+#include "Arduino.h"
+#include "Configuration.h"
+
+class DCF77Scheduler {
+public:
+    DCF77Scheduler();
+
+    boolean update(unsigned long now, boolean night, boolean force);
+    void synced(unsigned long now, long offset);
+
+    word getInterval();
+    unsigned long getNextSync();
+
+private:
+    boolean _receiving;
+    boolean _synced;
+    unsigned long _lastSync;
+    unsigned long _nextSync;
+    unsigned long _windowStart;
+    word _interval;
+};
+
+#endif
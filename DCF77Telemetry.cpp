@@ -0,0 +1,183 @@
+/**
+ * DCF77Telemetry
+ * Sammelt Daten zur Empfangsqualitaet des DCF77-Signals.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "DCF77Telemetry.h"
+
+DCF77Telemetry::DCF77Telemetry() {
+    for (byte i = 0; i < DCF77TELEMETRY_BINS; i++) {
+        _histogram[i] = 0;
+    }
+    for (byte i = 0; i < DCF77TELEMETRY_REASONS; i++) {
+        _errors[i] = 0;
+    }
+    _minutes = 0;
+    _decoded = 0;
+    _syncs = 0;
+    _history = 0;
+    for (byte i = 0; i < sizeof(_lastSync); i++) {
+        _lastSync[i] = 0;
+    }
+    _activeMs = 0;
+    _since = 0;
+}
+
+/**
+ * Einen Puls (abgesenkter Traeger) mit seiner Laenge in ms zaehlen.
+ */
+void DCF77Telemetry::pulse(word width) {
+    byte bin = width / DCF77TELEMETRY_BIN_WIDTH;
+    if (bin >= DCF77TELEMETRY_BINS) {
+        bin = DCF77TELEMETRY_BINS - 1;
+    }
+    count(&_histogram[bin]);
+    if (_since == 0) {
+        _since = millis();
+    }
+    _activeMs += width;
+}
+
+/**
+ * Das Ergebnis einer Minute zaehlen.
+ *
+ * @param errors 0, wenn decodiert, sonst MYDCF77_ERROR_xx.
+ */
+void DCF77Telemetry::minute(byte errors) {
+    count(&_minutes);
+    _history <<= 1;
+    if (errors == 0) {
+        count(&_decoded);
+        _history |= 1;
+    }
+    for (byte i = 0; i < DCF77TELEMETRY_PLAUSIBILITY; i++) {
+        if (errors & _BV(i)) {
+            count(&_errors[i]);
+        }
+    }
+}
+
+/**
+ * Das Ergebnis der Plausibilitaetspruefung im DCF77Helper zaehlen und
+ * die Zeit einer erfolgreichen Synchronisation merken.
+ */
+void DCF77Telemetry::sync(boolean ok, byte minutes, byte hours, byte date, byte month, byte year) {
+    if (!ok) {
+        count(&_errors[DCF77TELEMETRY_PLAUSIBILITY]);
+        return;
+    }
+    count(&_syncs);
+    _lastSync[0] = hours;
+    _lastSync[1] = minutes;
+    _lastSync[2] = date;
+    _lastSync[3] = month;
+    _lastSync[4] = year;
+}
+
+/**
+ * Wie viele der letzten vier Minuten decodiert wurden (fuer die Ecken).
+ */
+byte DCF77Telemetry::getRecentSuccesses() {
+    byte n = 0;
+    for (byte i = 0; i < 4; i++) {
+        if (_history & _BV(i)) {
+            n++;
+        }
+    }
+    return n;
+}
+
+/**
+ * Das Histogramm als Balken (eine Spalte pro Fach, von unten, auf das
+ * groesste Fach skaliert) in den Bildschirm-Puffer schreiben.
+ */
+void DCF77Telemetry::renderHistogram(word matrix[16]) {
+    word top = 0;
+    for (byte x = 0; x < DCF77TELEMETRY_BINS; x++) {
+        if (_histogram[x] > top) {
+            top = _histogram[x];
+        }
+    }
+    if (top == 0) {
+        return;
+    }
+    for (byte x = 0; x < DCF77TELEMETRY_BINS; x++) {
+        // angefangene Zeilen aufrunden, damit auch seltene Laengen sichtbar sind
+        byte height = ((unsigned long)_histogram[x] * 10 + top - 1) / top;
+        for (byte y = 10 - height; y < 10; y++) {
+            matrix[y] |= 0b1000000000000000 >> x;
+        }
+    }
+}
+
+/**
+ * Alles maschinenlesbar ueber Serial ausgeben (siehe DCF77Telemetry.h).
+ */
+void DCF77Telemetry::print() {
+    Serial.print(F("DCFH"));
+    for (byte i = 0; i < DCF77TELEMETRY_BINS; i++) {
+        Serial.print(F(","));
+        Serial.print(_histogram[i]);
+    }
+    Serial.println();
+
+    Serial.print(F("DCFM,"));
+    Serial.print(_minutes);
+    Serial.print(F(","));
+    Serial.print(_decoded);
+    for (byte i = 0; i < DCF77TELEMETRY_REASONS; i++) {
+        Serial.print(F(","));
+        Serial.print(_errors[i]);
+    }
+    Serial.println();
+
+    Serial.print(F("DCFS,"));
+    Serial.print(_syncs);
+    Serial.print(F(","));
+    if (_syncs == 0) {
+        Serial.println(F("-"));
+    } else {
+        print2(_lastSync[0], ':');
+        print2(_lastSync[1], ' ');
+        print2(_lastSync[2], '.');
+        print2(_lastSync[3], '.');
+        print2(_lastSync[4], '\n');
+    }
+
+    Serial.print(F("DCFD,"));
+    unsigned long seconds = (millis() - _since) / 1000;
+    // ms pro Sekunde sind Promille
+    Serial.print(seconds ? _activeMs / seconds : 0);
+    Serial.print(F(","));
+    for (char i = 7; i >= 0; i--) {
+        Serial.print((_history >> i) & 1);
+    }
+    Serial.println();
+}
+
+/**
+ * Einen Zaehler erhoehen, ohne ueberzulaufen.
+ */
+void DCF77Telemetry::count(word* counter) {
+    if (*counter != 0xFFFF) {
+        (*counter)++;
+    }
+}
+
+/**
+ * Zweistellig mit fuehrender Null und Trenner ausgeben.
+ */
+void DCF77Telemetry::print2(byte value, char separator) {
+    if (value < 10) {
+        Serial.print('0');
+    }
+    Serial.print(value);
+    Serial.print(separator);
+}
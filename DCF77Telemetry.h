@@ -0,0 +1,82 @@
+/**
+ * DCF77Telemetry
+ * Sammelt Daten zur Empfangsqualitaet des DCF77-Signals, damit man den
+ * Empfaenger ohne Debugger ausrichten kann:
+ * - Histogramm der Pulslaengen (11 Faecher a 25ms, das letzte nimmt alles
+ *   ab 250ms), gute Pulse liegen bei 100ms und 200ms,
+ * - pro Minute das Ergebnis der Decodierung und die Gruende fuer Fehler
+ *   (S-Bit, Z1/Z2, P1-P3, Bereich, Signal, Plausibilitaet im DCF77Helper),
+ * - Zeit der letzten Synchronisation,
+ * - Tastgrad (Anteil der Zeit mit abgesenktem Traeger, gut sind ca. 150 Promille).
+ *
+ * Ausgabe mit 'T' ueber Serial, eine Zeile pro Thema:
+ *
+ *   DCFH,<fach 0>,...,<fach 10>
+ *   DCFM,<minuten>,<ok>,<S>,<Z>,<P1>,<P2>,<P3>,<bereich>,<signal>,<plausibilitaet>
+ *   DCFS,<synchronisationen>,<hh:mm dd.mm.yy der letzten>
+ *   DCFD,<tastgrad promille>,<letzte 8 Minuten, 1 = ok, neueste rechts>
+ *
+ * Histogramm und Tastgrad gibt es nur mit MYDCF77_EDGE_INTERRUPT.
+ * Die Zaehler bleiben bei 65535 stehen.
+ * RAM: ca. 60 Bytes.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef DCF77TELEMETRY_H
+#define DCF77TELEMETRY_H
+
+#include "Arduino.h"
+#include "Configuration.h"
+
+#define DCF77TELEMETRY_BINS      11
+#define DCF77TELEMETRY_BIN_WIDTH 25
+// Fehlergruende: die Bits aus MyDCF77::getDecodeErrors() plus Plausibilitaet
+#define DCF77TELEMETRY_REASONS   8
+#define DCF77TELEMETRY_PLAUSIBILITY 7
+
+#ifdef ENABLE_DCF77_TELEMETRY
+    #define DCF77_TELEMETRY_PULSE(width) dcf77Telemetry.pulse(width)
+    #define DCF77_TELEMETRY_MINUTE(errors) dcf77Telemetry.minute(errors)
+#else
+    #define DCF77_TELEMETRY_PULSE(width)
+    #define DCF77_TELEMETRY_MINUTE(errors)
+#endif
+
+class DCF77Telemetry {
+public:
+    DCF77Telemetry();
+
+    void pulse(word width);
+    void minute(byte errors);
+    void sync(boolean ok, byte minutes, byte hours, byte date, byte month, byte year);
+
+    byte getRecentSuccesses();
+    void renderHistogram(word matrix[16]);
+    void print();
+
+private:
+    word _histogram[DCF77TELEMETRY_BINS];
+    word _minutes;
+    word _decoded;
+    word _errors[DCF77TELEMETRY_REASONS];
+    word _syncs;
+    byte _history;
+    byte _lastSync[5];
+    unsigned long _activeMs;
+    unsigned long _since;
+
+    void count(word* counter);
+    void print2(byte value, char separator);
+};
+
+#ifdef ENABLE_DCF77_TELEMETRY
+extern DCF77Telemetry dcf77Telemetry;
+#endif
+
+#endif
@@ -4,14 +4,17 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.1
+ * @version  1.2
  * @created  21.1.2013
- * @updated  8.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Zwei Argumente zugelassen.
+ * V 1.2:  - Configuration.h eingebunden, damit DEBUG mit SHIFTREGISTER_USART_SPI ins Leere geht.
  */
+#include "Configuration.h"
+
 #ifdef DEBUG
     #define DEBUG_PRINT(x) Serial.print(x)
     #define DEBUG_PRINT2(x, y) Serial.print(x, y)
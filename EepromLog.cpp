@@ -0,0 +1,251 @@
+/**
+ * EepromLog
+ * Ein Log im EEPROM fuer kleine Datensaetze (Einstellungen, Korrektur der RTC).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.1
+ * @created  17.10.2026
+ * @updated  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Schreiben im Hintergrund (poll()), ein Byte pro Aufruf, Zaehler fuer Schreibzugriffe.
+ */
+#include "EepromLog.h"
+#include <EEPROM.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+
+// #define DEBUG
+#include "Debug.h"
+
+/**
+ * Das EEPROM wird erst beim ersten Zugriff durchsucht, so ist egal,
+ * welches globale Objekt zuerst konstruiert wird.
+ */
+EepromLog::EepromLog() {
+    _scanned = false;
+    _cursor = 0;
+    _sequence = 0;
+    _writePage = 0;
+    _writePosition = EEPROMLOG_IDLE;
+    _records = 0;
+    _bytes = 0;
+}
+
+/**
+ * Den gueltigen Datensatz eines Typs lesen. Hoechstens length Bytes werden
+ * nach data kopiert, ist der Satz kuerzer, bleibt der Rest unberuehrt.
+ *
+ * @return Die Zahl der kopierten Bytes (0 = kein Datensatz).
+ */
+byte EepromLog::read(byte type, byte* data, byte length) {
+    if (!_scanned) {
+        scan();
+    }
+    flush();
+    byte page = _latest[type - 1];
+    if (page == 0xFF) {
+        return 0;
+    }
+    int a = address(page);
+    length = min(length, EEPROM.read(a + 5));
+    for (byte i = 0; i < length; i++) {
+        data[i] = EEPROM.read(a + EEPROMLOG_HEADER + i);
+    }
+    return length;
+}
+
+/**
+ * Einen Datensatz anhaengen (nur, wenn er sich geaendert hat). Geschrieben
+ * wird danach mit poll().
+ */
+void EepromLog::write(byte type, const byte* data, byte length) {
+    if (!_scanned) {
+        scan();
+    }
+    flush();
+    length = min(length, EEPROMLOG_MAX_LENGTH);
+
+    _page[0] = _sequence;
+    _page[1] = _sequence >> 8;
+    _page[2] = _sequence >> 16;
+    _page[3] = _sequence >> 24;
+    _page[4] = type;
+    _page[5] = length;
+    for (byte i = 0; i < EEPROMLOG_MAX_LENGTH; i++) {
+        _page[EEPROMLOG_HEADER + i] = (i < length) ? data[i] : 0;
+    }
+
+    // Unveraendert? Dann nichts schreiben.
+    if (_latest[type - 1] != 0xFF) {
+        int a = address(_latest[type - 1]);
+        byte i = 4;
+        while ((i < EEPROMLOG_PAGE_SIZE - 2) && (EEPROM.read(a + i) == _page[i])) {
+            i++;
+        }
+        if (i == EEPROMLOG_PAGE_SIZE - 2) {
+            return;
+        }
+    }
+
+    uint16_t crc = 0xFFFF;
+    for (byte i = 0; i < EEPROMLOG_PAGE_SIZE - 2; i++) {
+        crc = _crc_ccitt_update(crc, _page[i]);
+    }
+    _page[EEPROMLOG_PAGE_SIZE - 2] = lowByte(crc);
+    _page[EEPROMLOG_PAGE_SIZE - 1] = highByte(crc);
+
+    // gueltige Seiten (auch die bisherige dieses Typs) nicht ueberschreiben
+    while (isLatest(_cursor)) {
+        _cursor = (_cursor + 1) % EEPROMLOG_PAGES;
+    }
+
+    DEBUG_PRINT(F("EepromLog: type "));
+    DEBUG_PRINT(type);
+    DEBUG_PRINT(F(" -> page "));
+    DEBUG_PRINTLN(_cursor);
+    DEBUG_FLUSH();
+
+    _writePage = _cursor;
+    _writePosition = 4;
+    _cursor = (_cursor + 1) % EEPROMLOG_PAGES;
+    _sequence++;
+}
+
+/**
+ * Das naechste geaenderte Byte der Seite schreiben, wenn das EEPROM bereit
+ * ist: erst Inhalt und CRC, die Laufnummer zuletzt. Jedes Mal in loop()
+ * aufrufen.
+ *
+ * @return TRUE, solange noch geschrieben wird.
+ */
+boolean EepromLog::poll() {
+    if (_writePosition == EEPROMLOG_IDLE) {
+        return false;
+    }
+    if (!eeprom_is_ready()) {
+        return true;
+    }
+    int a = address(_writePage);
+    while (_writePosition < EEPROMLOG_IDLE) {
+        byte j = _writePosition % EEPROMLOG_PAGE_SIZE;
+        _writePosition++;
+        if (EEPROM.read(a + j) != _page[j]) {
+            // wartet nicht, das EEPROM schreibt im Hintergrund
+            EEPROM.write(a + j, _page[j]);
+            _bytes++;
+            break;
+        }
+    }
+    if (_writePosition < EEPROMLOG_IDLE) {
+        return true;
+    }
+    // fertig, ab jetzt gilt die neue Seite
+    _latest[_page[4] - 1] = _writePage;
+    _records++;
+    return false;
+}
+
+/**
+ * Wird gerade geschrieben?
+ */
+boolean EepromLog::isBusy() {
+    return _writePosition != EEPROMLOG_IDLE;
+}
+
+/**
+ * Ein laufendes Schreiben abwarten.
+ */
+void EepromLog::flush() {
+    while (poll());
+}
+
+/**
+ * Die Zaehler maschinenlesbar ausgeben: 'EEPROM,<Datensaetze>,<Bytes>'.
+ * Die Bytes verteilen sich auf EEPROMLOG_PAGES * EEPROMLOG_PAGE_SIZE Zellen.
+ */
+void EepromLog::printCounters() {
+    Serial.print(F("EEPROM,"));
+    Serial.print(_records);
+    Serial.print(F(","));
+    Serial.println(_bytes);
+}
+
+/**
+ * Alle Seiten durchsuchen: je Typ die gueltige Seite mit der hoechsten
+ * Laufnummer, dahinter wird weitergeschrieben.
+ */
+void EepromLog::scan() {
+    unsigned long latestSequence[EEPROMLOG_TYPES];
+    for (byte t = 0; t < EEPROMLOG_TYPES; t++) {
+        _latest[t] = 0xFF;
+    }
+    _cursor = 0;
+    _sequence = 0;
+    for (byte page = 0; page < EEPROMLOG_PAGES; page++) {
+        if (!isValid(page)) {
+            continue;
+        }
+        unsigned long sequence = readSequence(page);
+        byte t = EEPROM.read(address(page) + 4) - 1;
+        if ((_latest[t] == 0xFF) || (sequence > latestSequence[t])) {
+            _latest[t] = page;
+            latestSequence[t] = sequence;
+        }
+        if (sequence >= _sequence) {
+            _sequence = sequence + 1;
+            _cursor = (page + 1) % EEPROMLOG_PAGES;
+        }
+    }
+    _scanned = true;
+
+    DEBUG_PRINT(F("EepromLog: next page "));
+    DEBUG_PRINT(_cursor);
+    DEBUG_PRINT(F(", sequence "));
+    DEBUG_PRINTLN(_sequence);
+    DEBUG_FLUSH();
+}
+
+/**
+ * Typ, Laenge und CRC der Seite pruefen. Geloeschtes EEPROM (0xFF) ist
+ * nie gueltig.
+ */
+boolean EepromLog::isValid(byte page) {
+    int a = address(page);
+    byte type = EEPROM.read(a + 4);
+    if ((type < 1) || (type > EEPROMLOG_TYPES) || (EEPROM.read(a + 5) > EEPROMLOG_MAX_LENGTH) || (readSequence(page) == 0xFFFFFFFF)) {
+        return false;
+    }
+    uint16_t crc = 0xFFFF;
+    for (byte i = 0; i < EEPROMLOG_PAGE_SIZE - 2; i++) {
+        crc = _crc_ccitt_update(crc, EEPROM.read(a + i));
+    }
+    return crc == word(EEPROM.read(a + EEPROMLOG_PAGE_SIZE - 1), EEPROM.read(a + EEPROMLOG_PAGE_SIZE - 2));
+}
+
+/**
+ * Ist die Seite der gueltige Datensatz eines Typs?
+ */
+boolean EepromLog::isLatest(byte page) {
+    for (byte t = 0; t < EEPROMLOG_TYPES; t++) {
+        if (_latest[t] == page) {
+            return true;
+        }
+    }
+    return false;
+}
+
+unsigned long EepromLog::readSequence(byte page) {
+    int a = address(page);
+    unsigned long sequence = 0;
+    for (byte i = 4; i > 0; i--) {
+        sequence = (sequence << 8) | EEPROM.read(a + i - 1);
+    }
+    return sequence;
+}
+
+int EepromLog::address(byte page) {
+    return EEPROMLOG_START + page * EEPROMLOG_PAGE_SIZE;
+}
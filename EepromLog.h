@@ -0,0 +1,91 @@
+/**
+ * EepromLog
+ * Ein Log im EEPROM fuer kleine Datensaetze (Einstellungen, Korrektur der RTC).
+ * Statt immer dieselben Zellen zu ueberschreiben, wird jeder Datensatz als neue
+ * Seite hinten angehaengt, die Seiten bilden einen Ring. So verteilt sich das
+ * Schreiben auf alle Seiten (gut 60-mal mehr Speicherzyklen).
+ *
+ * Eine Seite (EEPROMLOG_PAGE_SIZE Bytes):
+ *   Laufnummer (4 Bytes), Typ, Laenge, Daten (aufgefuellt mit 0), CRC-16 ueber alles davor.
+ * Gueltig ist pro Typ die Seite mit der hoechsten Laufnummer und stimmender CRC.
+ * Die Laufnummer wird zuletzt geschrieben, eine Seite, deren Schreiben durch einen
+ * Stromausfall abbricht, hat also eine falsche CRC und wird ignoriert; es bleibt
+ * der vorige Stand. Die jeweils gueltigen Seiten werden nie ueberschrieben, beim
+ * Anhaengen springt der Ring ueber sie hinweg.
+ *
+ * Geschrieben wird im Hintergrund: write() merkt sich die Seite, poll() (aus loop())
+ * schreibt jeweils ein Byte, sobald das EEPROM bereit ist. So wartet loop() nie die
+ * 3.3 ms pro Byte ab. read() und ein weiteres write() warten ein laufendes Schreiben ab.
+ *
+ * Die Laenge dient als Version: neue Werte werden hinten an einen Datensatz
+ * angehaengt, beim Laden eines kuerzeren (alten) Satzes behalten sie ihre Defaults.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.1
+ * @created  17.10.2026
+ * @updated  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Schreiben im Hintergrund (poll()), ein Byte pro Aufruf, Zaehler fuer Schreibzugriffe.
+ */
+#ifndef EEPROMLOG_H
+#define EEPROMLOG_H
+
+#include "Arduino.h"
+
+// Die Bytes 0 bis 31 bleiben fuer das alte, feste Format (Migration).
+#define EEPROMLOG_START       32
+#define EEPROMLOG_PAGE_SIZE   16
+#define EEPROMLOG_PAGES       62
+#define EEPROMLOG_HEADER      6
+#define EEPROMLOG_MAX_LENGTH  (EEPROMLOG_PAGE_SIZE - EEPROMLOG_HEADER - 2)
+#define EEPROMLOG_IDLE        (EEPROMLOG_PAGE_SIZE + 4)
+
+// Die Typen der Datensaetze (1 bis EEPROMLOG_TYPES).
+#define EEPROMLOG_TYPES          4
+#define EEPROMLOG_TYPE_SETTINGS  1
+#define EEPROMLOG_TYPE_RTCDRIFT  2
+// Weckzeit, Nachtzeiten und Farbe (passt nicht mehr in den ersten Satz)
+#define EEPROMLOG_TYPE_SETTINGS_EXTRA 3
+
+class EepromLog {
+public:
+    EepromLog();
+
+    byte read(byte type, byte* data, byte length);
+    void write(byte type, const byte* data, byte length);
+    boolean poll();
+    boolean isBusy();
+    void flush();
+
+    void printCounters();
+
+private:
+    boolean _scanned;
+    // die naechste Seite und Laufnummer
+    byte _cursor;
+    unsigned long _sequence;
+    // die gueltige Seite je Typ (0xFF = keine)
+    byte _latest[EEPROMLOG_TYPES];
+
+    // die Seite, die gerade geschrieben wird
+    byte _page[EEPROMLOG_PAGE_SIZE];
+    byte _writePage;
+    // naechstes Byte (ab 4, die Laufnummer zuletzt), EEPROMLOG_IDLE = fertig
+    byte _writePosition;
+
+    unsigned long _records;
+    unsigned long _bytes;
+
+    void scan();
+    boolean isValid(byte page);
+    boolean isLatest(byte page);
+    unsigned long readSequence(byte page);
+    int address(byte page);
+};
+
+extern EepromLog eepromLog;
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * EventQueue
+ * Eine kleine Warteschlange fuer Ereignisse zwischen den Aufgaben des Schedulers.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "EventQueue.h"
+
+EventQueue::EventQueue() {
+    _head = 0;
+    _tail = 0;
+    _lost = 0;
+}
+
+/**
+ * Ein Ereignis hinten anhaengen.
+ *
+ * @return FALSE, wenn die Warteschlange voll war.
+ */
+boolean EventQueue::post(byte type, byte param) {
+    byte next = (_head + 1) & (EVENTQUEUE_SIZE - 1);
+    if (next == _tail) {
+        _lost++;
+        return false;
+    }
+    _types[_head] = type;
+    _params[_head] = param;
+    _head = next;
+    return true;
+}
+
+/**
+ * Das aelteste Ereignis holen.
+ *
+ * @return FALSE, wenn nichts anliegt.
+ */
+boolean EventQueue::get(byte& type, byte& param) {
+    if (_tail == _head) {
+        return false;
+    }
+    type = _types[_tail];
+    param = _params[_tail];
+    _tail = (_tail + 1) & (EVENTQUEUE_SIZE - 1);
+    return true;
+}
+
+/**
+ * Die Zahl der verlorenen Ereignisse (Warteschlange voll).
+ */
+word EventQueue::getLost() {
+    return _lost;
+}
@@ -0,0 +1,57 @@
+/**
+ * EventQueue
+ * Eine kleine Warteschlange fuer Ereignisse zwischen den Aufgaben des Schedulers:
+ * die Tasten, die Fernbedienung, der LDR und der DCF77-Empfaenger melden nur noch,
+ * was passiert ist, ausgewertet wird an einer Stelle (Aufgabe 'Ereignisse').
+ *
+ * Ein Ereignis ist ein Typ und ein Parameter (je ein Byte), der Ring hat
+ * EVENTQUEUE_SIZE Plaetze, statisch angelegt. Ist er voll, geht das neue Ereignis
+ * verloren und wird gezaehlt.
+ *
+ * Der Sekundentakt der RTC bleibt das Flag needsUpdateFromRtc: mehrere Takte
+ * sollen zu einem Neuzeichnen zusammenfallen und duerfen nie verloren gehen.
+ * post() und get() nur aus loop() aufrufen, nicht aus Interrupts.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include "Arduino.h"
+
+// Zweierpotenz, damit der Ring mit einer Maske auskommt.
+#define EVENTQUEUE_SIZE 8
+
+// Eine Taste wurde gedrueckt, Parameter: REMOTE_BUTTON_*.
+#define EVENT_BUTTON        1
+// Die Fernbedienung hat eine Taste erkannt, Parameter: REMOTE_BUTTON_*.
+#define EVENT_IR            2
+// Der DCF77-Empfaenger hat eine Minute vollstaendig empfangen.
+#define EVENT_DCF77_MINUTE  3
+// Der LDR will eine andere Helligkeit, Parameter: die Helligkeit laut LDR.
+#define EVENT_LDR           4
+
+class EventQueue {
+public:
+    EventQueue();
+
+    boolean post(byte type, byte param = 0);
+    boolean get(byte& type, byte& param);
+
+    word getLost();
+
+private:
+    byte _types[EVENTQUEUE_SIZE];
+    byte _params[EVENTQUEUE_SIZE];
+    byte _head;
+    byte _tail;
+    word _lost;
+};
+
+#endif
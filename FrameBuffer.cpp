@@ -0,0 +1,113 @@
+/**
+ * FrameBuffer
+ * Bildspeicher mit Helligkeit pro LED (4 Bit, 0..15) fuer die 11x10-Matrix
+ * plus die Eck-/Alarm-LED am Ende jeder Zeile (Bits 4..0 im word-Bildspeicher).
+ *
+ * RAM: 10 Zeilen * 12 Spalten * 4 Bit = 60 Bytes.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "FrameBuffer.h"
+
+FrameBuffer::FrameBuffer() {
+    clear();
+}
+
+/**
+ * Alle LEDs aus.
+ */
+void FrameBuffer::clear() {
+    for (byte i = 0; i < sizeof(_pixels); i++) {
+        _pixels[i] = 0;
+    }
+}
+
+/**
+ * Die Bitmaske einer Spalte im word-Bildspeicher. Spalte 11 ist
+ * die Eck-/Alarm-LED und belegt die Bits 4..0.
+ */
+word FrameBuffer::columnMask(byte x) {
+    if (x < FRAMEBUFFER_COLS - 1) {
+        return 0b1000000000000000 >> x;
+    }
+    return 0b0000000000011111;
+}
+
+void FrameBuffer::setPixel(byte x, byte y, byte intensity) {
+    byte i = y * FRAMEBUFFER_COLS + x;
+    if (i & 1) {
+        _pixels[i >> 1] = (_pixels[i >> 1] & 0x0F) | (intensity << 4);
+    } else {
+        _pixels[i >> 1] = (_pixels[i >> 1] & 0xF0) | (intensity & 0x0F);
+    }
+}
+
+byte FrameBuffer::getPixel(byte x, byte y) {
+    byte i = y * FRAMEBUFFER_COLS + x;
+    if (i & 1) {
+        return _pixels[i >> 1] >> 4;
+    }
+    return _pixels[i >> 1] & 0x0F;
+}
+
+/**
+ * Einen word-Bildspeicher uebernehmen, gesetzte LEDs bekommen 'intensity'.
+ */
+void FrameBuffer::fromMatrix(word matrix[16], byte intensity) {
+    for (byte y = 0; y < FRAMEBUFFER_ROWS; y++) {
+        for (byte x = 0; x < FRAMEBUFFER_COLS; x++) {
+            setPixel(x, y, (matrix[y] & columnMask(x)) ? intensity : 0);
+        }
+    }
+}
+
+/**
+ * In einen word-Bildspeicher wandeln. LEDs ab 'threshold' sind an.
+ */
+void FrameBuffer::toMatrix(word matrix[16], byte threshold) {
+    for (byte y = 0; y < 16; y++) {
+        matrix[y] = 0;
+    }
+    for (byte y = 0; y < FRAMEBUFFER_ROWS; y++) {
+        for (byte x = 0; x < FRAMEBUFFER_COLS; x++) {
+            if (getPixel(x, y) >= threshold) {
+                matrix[y] |= columnMask(x);
+            }
+        }
+    }
+}
+
+void FrameBuffer::copyFrom(FrameBuffer* other) {
+    for (byte i = 0; i < sizeof(_pixels); i++) {
+        _pixels[i] = other->_pixels[i];
+    }
+}
+
+/**
+ * Eine Zeile in 8 Bitebenen fuer die Bit-Angle-Modulation zerlegen.
+ *
+ * @param levels Die Leuchtdauer (0..255) fuer jede der 16 Helligkeiten.
+ * @param planes Ebene b enthaelt alle LEDs, bei deren Leuchtdauer Bit b gesetzt ist.
+ */
+void FrameBuffer::rowToPlanes(byte y, const byte levels[FRAMEBUFFER_MAX + 1], word planes[8]) {
+    for (byte b = 0; b < 8; b++) {
+        planes[b] = 0;
+    }
+    for (byte x = 0; x < FRAMEBUFFER_COLS; x++) {
+        byte level = levels[getPixel(x, y)];
+        if (level) {
+            word mask = columnMask(x);
+            for (byte b = 0; b < 8; b++, level >>= 1) {
+                if (level & 1) {
+                    planes[b] |= mask;
+                }
+            }
+        }
+    }
+}
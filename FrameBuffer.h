@@ -0,0 +1,47 @@
+/**
+ * FrameBuffer
+ * Bildspeicher mit Helligkeit pro LED (4 Bit, 0..15) fuer die 11x10-Matrix
+ * plus die Eck-/Alarm-LED am Ende jeder Zeile (Bits 4..0 im word-Bildspeicher).
+ *
+ * RAM: 10 Zeilen * 12 Spalten * 4 Bit = 60 Bytes.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include "Arduino.h"
+
+#define FRAMEBUFFER_ROWS 10
+// 11 Spalten plus die Eck-/Alarm-LED (Spalte 11)
+#define FRAMEBUFFER_COLS 12
+#define FRAMEBUFFER_MAX  15
+
+class FrameBuffer {
+public:
+    FrameBuffer();
+
+    void clear();
+
+    void setPixel(byte x, byte y, byte intensity);
+    byte getPixel(byte x, byte y);
+
+    void fromMatrix(word matrix[16], byte intensity);
+    void toMatrix(word matrix[16], byte threshold);
+    void copyFrom(FrameBuffer* other);
+
+    void rowToPlanes(byte y, const byte levels[FRAMEBUFFER_MAX + 1], word planes[8]);
+
+    static word columnMask(byte x);
+
+private:
+    byte _pixels[FRAMEBUFFER_ROWS * FRAMEBUFFER_COLS / 2];
+};
+
+#endif
@@ -0,0 +1,26 @@
+/**
+ * Gamma
+ * Tabelle fuer die Gamma-Korrektur (Gamma 2.2) der Helligkeit.
+ * Eingang ist die empfundene Helligkeit 0..255, Ausgang die
+ * Leuchtdauer 0..255. Werte > 0 liefern mindestens 1, damit
+ * auch die dunkelste Stufe noch leuchtet.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.1
+ * @created  17.10.2026
+ * @updated  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Die Tabelle steht in Gamma.cpp, der Header darf mehrfach eingebunden werden.
+ */
+#ifndef GAMMA_H
+#define GAMMA_H
+
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+
+extern const byte gamma8[256] PROGMEM;
+
+#endif
@@ -4,13 +4,14 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.1
+ * @version  1.2
  * @created  7.2.2015
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.2:  - printSignature() und buttonForCode() rein virtuell.
  */
 #ifndef IRTRANSLATOR_H
 #define IRTRANSLATOR_H
@@ -34,8 +35,8 @@
 
 class IRTranslator {
 public:
-    virtual void printSignature();
-    virtual byte buttonForCode(unsigned long code);
+    virtual void printSignature() = 0;
+    virtual byte buttonForCode(unsigned long code) = 0;
     byte getRed();
     byte getGreen();
     byte getBlue();
@@ -5,9 +5,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.5
+ * @version  1.7
  * @created  18.1.2013
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -16,9 +16,21 @@
  * V 1.3:  - Anpassung auf Helligkeit in Prozent.
  * V 1.4:  - Getter fuer Helligkeit eingefuehrt.
  * V 1.5:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.6:  - writeFrameBufferToMatrix() fuer Bildspeicher mit Helligkeit pro LED eingefuehrt.
+ * V 1.7:  - setFading() eingefuehrt, das Hauptprogramm sagt dem Treiber, wann er ueberblenden soll.
  */
 #include "LedDriver.h"
 
+/**
+ * Einen Bildspeicher mit Helligkeit pro LED ausgeben. Treiber ohne
+ * Graustufen zeigen alle LEDs ab halber Helligkeit an.
+ */
+void LedDriver::writeFrameBufferToMatrix(FrameBuffer* frameBuffer) {
+    word matrix[16];
+    frameBuffer->toMatrix(matrix, FRAMEBUFFER_MAX / 2 + 1);
+    writeScreenBufferToMatrix(matrix, true);
+}
+
 void LedDriver::setColor(byte red, byte green, byte blue) {
     _red = red;
     _green = green;
@@ -37,6 +49,18 @@ byte LedDriver::getBlue() {
     return _blue;
 }
 
+/**
+ * Soll der naechste Aufruf von writeScreenBufferToMatrix() mit onChange
+ * weich ueberblenden (Minutenwechsel in der Uhrzeitanzeige)?
+ */
+void LedDriver::setFading(boolean fading) {
+    _fading = fading;
+}
+
+boolean LedDriver::getFading() {
+    return _fading;
+}
+
 void LedDriver::setPixelInScreenBuffer(byte x, byte y, word matrix[16]) {
     matrix[y] |= 0b1000000000000000 >> x;
 }
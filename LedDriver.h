@@ -5,9 +5,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.5
+ * @version  1.8
  * @created  18.1.2013
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -16,40 +16,49 @@
  * V 1.3:  - Anpassung auf Helligkeit in Prozent.
  * V 1.4:  - Getter fuer Helligkeit eingefuehrt.
  * V 1.5:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.6:  - writeFrameBufferToMatrix() fuer Bildspeicher mit Helligkeit pro LED eingefuehrt.
+ * V 1.7:  - setFading() eingefuehrt, das Hauptprogramm sagt dem Treiber, wann er ueberblenden soll.
+ * V 1.8:  - Die Methoden ohne Implementierung sind rein virtuell (sonst fehlt die vtable ausserhalb von -Os).
  */
 #ifndef LEDDRIVER_H
 #define LEDDRIVER_H
 
 #include "Arduino.h"
+#include "FrameBuffer.h"
 
 class LedDriver {
 public:
-    virtual void init();
+    virtual void init() = 0;
 
-    virtual void printSignature();
+    virtual void printSignature() = 0;
 
-    virtual void writeScreenBufferToMatrix(word matrix[16], boolean onChange);
+    virtual void writeScreenBufferToMatrix(word matrix[16], boolean onChange) = 0;
+    virtual void writeFrameBufferToMatrix(FrameBuffer* frameBuffer);
 
-    virtual void setBrightness(byte brightnessInPercent);
-    virtual byte getBrightness();
+    virtual void setBrightness(byte brightnessInPercent) = 0;
+    virtual byte getBrightness() = 0;
 
     void setColor(byte red, byte green, byte blue);
     byte getRed();
     byte getGreen();
     byte getBlue();
 
-    virtual void setLinesToWrite(byte linesToWrite);
+    void setFading(boolean fading);
+    boolean getFading();
 
-    virtual void shutDown();
-    virtual void wakeUp();
+    virtual void setLinesToWrite(byte linesToWrite) = 0;
 
-    virtual void clearData();
+    virtual void shutDown() = 0;
+    virtual void wakeUp() = 0;
+
+    virtual void clearData() = 0;
 
     void setPixelInScreenBuffer(byte x, byte y, word matrix[16]);
     boolean getPixelFromScreenBuffer(byte x, byte y, word matrix[16]);
 
 private:
     byte _red, _green, _blue;
+    boolean _fading;
 };
 
 #endif
@@ -0,0 +1,292 @@
+/**
+ * LedDriverBAM
+ * Implementierung auf der Basis 74HC595 und UDN2981A (Hardware wie LedDriverDefault)
+ * mit Bit-Angle-Modulation (BAM) fuer die Helligkeit.
+ *
+ * Jede Zeile wird in 8 Bitebenen unterteilt, Ebene b dauert 2^b * BAM_UNIT
+ * Mikrosekunden. Eine Ebene leuchtet, wenn ihr Bit im (gamma-korrigierten)
+ * Helligkeitswert gesetzt ist. Das ergibt 256 Stufen, die CPU wird nur an
+ * den Uebergaengen der Ebenen gebraucht (Timer1-Interrupt). Die drei kurzen
+ * Ebenen (zusammen 7 Einheiten) werden in einem Rutsch in der ISR erledigt.
+ *
+ * Der Bildspeicher ist ein FrameBuffer mit 16 Helligkeiten pro LED. Zu
+ * Beginn jeder Zeile wird sie ueber die Tabelle _levels (Gesamthelligkeit
+ * und Gamma) in die 8 Bitebenen zerlegt. Ueberblendungen macht nicht mehr
+ * der Treiber, sondern die Transition im Hauptprogramm.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.3
+ * @created  17.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Graustufen pro LED ueber FrameBuffer, eigenes Ueberblenden entfernt.
+ * V 1.2:  - backFrame() wartet nicht mehr auf den Pufferwechsel.
+ * V 1.3:  - Die Shift-Register werden in init() eingestellt.
+ */
+#ifndef LED_DRIVER_BAM_H
+#define LED_DRIVER_BAM_H
+
+#include "Arduino.h"
+#include "ShiftRegister.h"
+#include "LedDriver.h"
+#include "Configuration.h"
+#include "Gamma.h"
+#include "FrameBuffer.h"
+
+// Timer1 laeuft mit Prescaler 8 bei 16 MHz, also 2 Ticks pro Mikrosekunde.
+#define BAM_TICKS_PER_US 2
+// So viele kurze Bitebenen werden direkt in der ISR (per delayMicroseconds) abgearbeitet.
+#define BAM_SHORT_PLANES 3
+
+// Hilfsvariable, um das Display auf den Kopf zu stellen
+#ifdef UPSIDE_DOWN
+  #define BAM_DISPLAY_SHIFT  (linesToWrite-1)-
+#else
+  #define BAM_DISPLAY_SHIFT  0+
+#endif
+
+template <uint32_t dataPin, uint32_t clockPin, uint32_t latchPin, uint32_t outputEnablePin, byte linesToWrite>
+class LedDriverBAM: public LedDriver {
+public:
+
+/**
+ * Initialisierung.
+ */
+LedDriverBAM() {
+  DPIN_OUTPUT(outputEnablePin);
+  DPIN_HIGH(outputEnablePin);
+}
+
+/**
+ * init() wird im Hauptprogramm in init() aufgerufen.
+ * Timer1 im CTC-Modus, Prescaler 8. Der Interrupt wird erst mit wakeUp() aktiviert.
+ */
+void init() {
+  shiftRegister.begin();
+  _front = 0;
+  _swapPending = false;
+  _row = 0;
+  _plane = 0;
+  _shiftedRow = 0xFF;
+  TCCR1A = 0;
+  TCCR1B = _BV(WGM12) | _BV(CS11);
+  OCR1A = (BAM_UNIT << BAM_SHORT_PLANES) * BAM_TICKS_PER_US - 1;
+  TCNT1 = 0;
+}
+
+void printSignature() {
+  Serial.println(F("BAM - 74HC595"));
+}
+
+/**
+ * Den Bildschirm-Puffer uebernehmen (alle LEDs volle Helligkeit). Das
+ * Auffrischen erledigt der Timer, Refresh-Aufrufe (onChange == FALSE)
+ * kehren sofort zurueck.
+ */
+void writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
+  if (!onChange) {
+    return;
+  }
+  word shifted[16];
+  for (byte i = 0; i < 16; i++) {
+    shifted[i] = 0;
+  }
+  for (byte i = 0; i < linesToWrite; i++) {
+    shifted[BAM_DISPLAY_SHIFT i] = matrix[i];
+  }
+  _frames[backFrame()].fromMatrix(shifted, FRAMEBUFFER_MAX);
+  publishFrame();
+}
+
+/**
+ * Einen Bildspeicher mit Helligkeit pro LED uebernehmen.
+ */
+void writeFrameBufferToMatrix(FrameBuffer* frameBuffer) {
+#ifdef UPSIDE_DOWN
+  FrameBuffer* back = &_frames[backFrame()];
+  for (byte y = 0; y < linesToWrite; y++) {
+    for (byte x = 0; x < FRAMEBUFFER_COLS; x++) {
+      back->setPixel(x, BAM_DISPLAY_SHIFT y, frameBuffer->getPixel(x, y));
+    }
+  }
+#else
+  _frames[backFrame()].copyFrom(frameBuffer);
+#endif
+  publishFrame();
+}
+
+/**
+ * Aus dem Compare-Match-A-Interrupt von Timer1 aufzurufen.
+ * Schaltet auf die naechste Bitebene (bzw. Zeile) weiter.
+ */
+void bamNextPlane() {
+  DPIN_HIGH(outputEnablePin);
+
+  if (_plane == 0) {
+    if ((_row == 0) && _swapPending) {
+      swapFrames();
+    }
+    _frames[_front].rowToPlanes(_row, _levels, _planes);
+    // Die kurzen Ebenen lohnen keinen eigenen Interrupt...
+    for (byte b = 0; b < BAM_SHORT_PLANES; b++) {
+      if (showPlane(b)) {
+        delayMicroseconds(BAM_UNIT << b);
+        DPIN_HIGH(outputEnablePin);
+      }
+    }
+    _plane = BAM_SHORT_PLANES;
+    TCNT1 = 0;
+  }
+
+  // ... die langen laufen ueber den Timer.
+  OCR1A = (BAM_UNIT << _plane) * BAM_TICKS_PER_US - 1;
+  showPlane(_plane);
+
+  _plane++;
+  if (_plane == 8) {
+    _plane = 0;
+    _row++;
+    if (_row >= linesToWrite) {
+      _row = 0;
+    }
+  }
+}
+
+/**
+ * Die Helligkeit des Displays anpassen. Die Prozent werden auf 0..255
+ * gespreizt, jede der 16 LED-Helligkeiten bekommt ihren Anteil davon
+ * und wird gamma-korrigiert.
+ *
+ * @param brightnessInPercent Die Helligkeit.
+ */
+void setBrightness(byte brightnessInPercent) {
+  _brightnessInPercent = brightnessInPercent;
+  word perceived = ((word)brightnessInPercent * 255 + 50) / 100;
+  for (byte i = 0; i <= FRAMEBUFFER_MAX; i++) {
+    _levels[i] = pgm_read_byte_near(&gamma8[(perceived * i) / FRAMEBUFFER_MAX]);
+  }
+}
+
+/**
+ * Die aktuelle Helligkeit bekommen.
+ */
+byte getBrightness() {
+  return _brightnessInPercent;
+}
+
+/**
+ * Anpassung der Groesse des Bildspeichers (hier ohne Funktion).
+ */
+void setLinesToWrite(byte) {
+}
+
+/**
+ * Das Display ausschalten.
+ */
+void shutDown() {
+  TIMSK1 = 0;
+  DPIN_HIGH(outputEnablePin);
+  _displayOn = false;
+}
+
+/**
+ * Das Display einschalten.
+ */
+void wakeUp() {
+  _displayOn = true;
+  TCNT1 = 0;
+  TIMSK1 = _BV(OCIE1A);
+}
+
+/**
+ * Den Dateninhalt des LED-Treibers loeschen.
+ */
+void clearData() {
+  byte oldSREG = SREG;
+  cli();
+  shiftRegister.prepareShiftregisterWrite();
+  shiftRegister.shiftOut(65535);
+  shiftRegister.shiftOut(0);
+  shiftRegister.finishShiftregisterWrite();
+  _shiftedRow = 0xFF;
+  SREG = oldSREG;
+}
+
+private:
+/**
+ * Der hintere Puffer, in den loop() schreiben darf. Ein noch nicht
+ * abgeholter Wechsel wird zurueckgenommen, danach tauscht die ISR nicht
+ * mehr (der neueste Frame gewinnt, gewartet wird nie).
+ */
+byte backFrame() {
+  _swapPending = false;
+  return _front ^ 1;
+}
+
+/**
+ * Den beschriebenen hinteren Puffer zum Tausch anmelden.
+ */
+void publishFrame() {
+  // Der Puffer muss fertig im RAM stehen, bevor die ISR ihn sehen darf.
+  asm volatile("" ::: "memory");
+  _swapPending = true;
+  if (!_displayOn) {
+    swapFrames();
+  }
+}
+
+/**
+ * Den hinteren Puffer nach vorne holen.
+ */
+void swapFrames() {
+  _front ^= 1;
+  _swapPending = false;
+}
+
+/**
+ * Eine Bitebene der aktuellen Zeile einschalten. Geschoben wird nur,
+ * wenn sich der Inhalt gegenueber der letzten Ebene geaendert hat.
+ *
+ * @return TRUE, wenn die Ebene leuchtet.
+ */
+boolean showPlane(byte plane) {
+  word data = _planes[plane];
+  if ((data == 0) || !_displayOn) {
+    return false;
+  }
+  if ((data != _shiftedData) || (_row != _shiftedRow)) {
+    shiftRegister.prepareShiftregisterWrite();
+    shiftRegister.shiftOut(~data);
+    shiftRegister.shiftOut(1 << _row);
+    shiftRegister.finishShiftregisterWrite();
+    _shiftedData = data;
+    _shiftedRow = _row;
+  }
+  DPIN_LOW(outputEnablePin);
+  return true;
+}
+
+    ShiftRegister<dataPin, clockPin, latchPin> shiftRegister;
+
+    byte _brightnessInPercent;
+    // Leuchtdauer (0..255, gamma-korrigiert) fuer jede LED-Helligkeit.
+    byte _levels[FRAMEBUFFER_MAX + 1];
+    volatile boolean _displayOn;
+
+    // Doppelter Bildspeicher: loop() schreibt den hinteren, die ISR zeigt den vorderen.
+    FrameBuffer _frames[2];
+    volatile byte _front;
+    volatile boolean _swapPending;
+
+    // Bitebenen der aktuellen Zeile.
+    word _planes[8];
+    byte _row;
+    byte _plane;
+    word _shiftedData;
+    byte _shiftedRow;
+};
+
+#endif
@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.4f
+ * @version  1.9
  * @created  18.1.2013
- * @updated  03.4.2015 / Michael Joester
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -16,6 +16,13 @@
  * V 1.3:  - Getter fuer Helligkeit nachgezogen.
  * V 1.4:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
  * V 1.4f: - Michael Joester: Fading ergänzt.
+ * V 1.5:  - Optional Multiplexing per Timer1-Interrupt (MULTIPLEX_IN_ISR) mit doppeltem Bildspeicher,
+ *           Helligkeit ueber Compare-Match auf OutputEnable statt delayMicroseconds().
+ * V 1.6:  - Mit SPI-Hardware wird im Interrupt-Betrieb die naechste Phase geschoben,
+ *           waehrend die aktuelle leuchtet.
+ * V 1.7:  - Ob ueberblendet wird, kommt ueber setFading() statt ueber helperSeconds und mode.
+ * V 1.8:  - writeScreenBufferToMatrix() wartet im Interrupt-Betrieb nicht mehr auf den Pufferwechsel.
+ * V 1.9:  - Die Shift-Register werden in init() eingestellt.
  */
 #ifndef LED_DRIVER_DEFAULT_H
 #define LED_DRIVER_DEFAULT_H
@@ -25,8 +32,6 @@
 #include "LedDriver.h"
 #include "Configuration.h"
 
-extern volatile byte helperSeconds;
-extern byte mode;
 
 
 /* Treiberkonfiguration */
@@ -35,11 +40,19 @@ extern byte mode;
 
 #define FADINGCOUNTERLOAD 3000 // nicht ändern, bitte: Überblendvariable Startwert
 
+#ifdef MULTIPLEX_IN_ISR
+// Timer1 laeuft mit Prescaler 8 bei 16 MHz, also 2 Ticks pro Mikrosekunde.
+#define MULTIPLEX_TICKS_PER_US 2
+// Die Dauer einer Zeile in Mikrosekunden (wie im loop()-Betrieb: An- plus Auszeit).
+#define MULTIPLEX_ROW_DURATION (100 * PWM_DURATION)
+// Kuerzeste Phase in Mikrosekunden. Das Schieben einer Zeile muss darin Platz haben,
+// sonst laeuft der Timer ueber OCR1A hinaus.
+#define MULTIPLEX_MIN_PHASE 40
+#endif
+
 // #define DEBUG
 #include "Debug.h"
 
-#define STD_MODE_NORMAL     0
-
 // Hilfsvariable, um das Display auf den Kopf zu stellen
 #ifdef UPSIDE_DOWN
   #define DISPLAY_SHIFT  (linesToWrite-1)-
@@ -73,6 +86,22 @@ LedDriverDefault() {
  * Ausgangszustand gebracht werden.
  */
 void init() {
+  shiftRegister.begin();
+#ifdef MULTIPLEX_IN_ISR
+  _front = 0;
+  _swapPending = false;
+  _row = 0;
+  _oldPhase = true;
+#ifdef SHIFTREGISTER_HARDWARE
+  _queuedOnTime = 0;
+  _queuedPeriod = MULTIPLEX_MIN_PHASE;
+#endif
+  // Timer1 im CTC-Modus, Prescaler 8. Gestartet wird der Interrupt erst mit wakeUp().
+  TCCR1A = 0;
+  TCCR1B = _BV(WGM12) | _BV(CS11);
+  OCR1A = MULTIPLEX_ROW_DURATION * MULTIPLEX_TICKS_PER_US;
+  TCNT1 = 0;
+#endif
 }
 
 void printSignature() {
@@ -85,11 +114,77 @@ void printSignature() {
  * @param onChange: TRUE, wenn es Aenderungen in dem Bildschirm-Puffer gab,
  *                  FALSE, wenn es ein Refresh-Aufruf war.
  */
+#ifdef MULTIPLEX_IN_ISR
+void writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
+  // Das Auffrischen uebernimmt der Timer, hier wird nur der hintere Puffer beschrieben.
+  if (!onChange) {
+    return;
+  }
+  // Einen noch nicht abgeholten Wechsel zuruecknehmen, danach tauscht die ISR nicht
+  // mehr und der hintere Puffer gehoert loop(). Hat sie vorher getauscht, ist der
+  // hintere Puffer der bisher vordere. Der neueste Frame gewinnt, gewartet wird nie.
+  _swapPending = false;
+
+  byte back = _front ^ 1;
+  for (byte i = 0; i < linesToWrite; i++) {
+    _frames[back][DISPLAY_SHIFT i] = matrix[i];
+  }
+  _fadePending = (getFading() && FADING);
+  _swapPending = true;
+  if (!_displayOn) {
+    // Timer steht, also selbst umschalten.
+    swapFrames();
+  }
+}
+
+/**
+ * Aus dem Compare-Match-A-Interrupt von Timer1 aufzurufen. Schiebt die naechste
+ * (Teil-)Zeile raus und schaltet sie ueber OutputEnable ein. Pro Zeile gibt es
+ * beim Ueberblenden zwei Phasen (alter und neuer Inhalt), sonst nur eine.
+ */
+void multiplexNextPhase() {
+  DPIN_HIGH(outputEnablePin);
+
+  if (_oldPhase) {
+    if (_row == 0) {
+      startFrame();
+    }
+#ifdef SKIP_BLANK_LINES
+    while ((_row < linesToWrite - 1) && (_matrixOld[_row] == 0) && (_frames[_front][_row] == 0)) {
+      _row++;
+    }
+#endif
+    _usedOnOld = 0;
+    if (_delayOldMatrix >= MULTIPLEX_MIN_PHASE) {
+      // Alter Zeileninhalt, nur beim Ueberblenden
+      _usedOnOld = _delayOldMatrix;
+      _oldPhase = false;
+      writeRow(_row, ~_matrixOld[_row], _usedOnOld, _usedOnOld);
+      return;
+    }
+  }
+
+  // Neuer Zeileninhalt plus die Auszeit der Zeile
+  writeRow(_row, ~_frames[_front][_row], _delayNewMatrix, MULTIPLEX_ROW_DURATION - _usedOnOld);
+  _oldPhase = true;
+  _row++;
+  if (_row >= linesToWrite) {
+    _row = 0;
+  }
+}
+
+/**
+ * Aus dem Compare-Match-B-Interrupt von Timer1 aufzurufen. Ende der Anzeit.
+ */
+void multiplexOutputOff() {
+  DPIN_HIGH(outputEnablePin);
+}
+#else
 void writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
   if (onChange) {
     // if (_alpha == 0)
     { //Wenn die obeste linke LED leuchtet, wird die Uhrzeit angezeigt
-      if (((helperSeconds == 0) && (mode == STD_MODE_NORMAL)) && FADING) 
+      if (getFading() && FADING) 
       { //Der Treiber wird im Sekundentakt mit onChange = true aufgerufen. Deswegen muss hier noch das Ende eines Minutenfadens bei Uhrzeitanzeige abgewartet werden
         for (byte i = 0; i < linesToWrite; i++) { 
           _matrixOld[i] = _matrixNew[i]; //Abbild der aktuellen Matrix in Vorversion rüberkopieren
@@ -173,6 +268,7 @@ void writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
       _alpha = 0;
     }
 }
+#endif
 
 /**
  * Die Helligkeit des Displays anpassen.
@@ -203,6 +299,9 @@ void setLinesToWrite(byte) {
  * Das Display ausschalten.
  */
 void shutDown() {
+#ifdef MULTIPLEX_IN_ISR
+  TIMSK1 = 0;
+#endif
   DPIN_HIGH(outputEnablePin);
   _displayOn = false;
 }
@@ -211,18 +310,30 @@ void shutDown() {
  * Das Display einschalten.
  */
 void wakeUp() {
-  DPIN_LOW(outputEnablePin);
   _displayOn = true;
+#ifdef MULTIPLEX_IN_ISR
+  TCNT1 = 0;
+  TIMSK1 = _BV(OCIE1A) | _BV(OCIE1B);
+#else
+  DPIN_LOW(outputEnablePin);
+#endif
 }
 
 /**
  * Den Dateninhalt des LED-Treibers loeschen.
  */
 void clearData() {
+#ifdef MULTIPLEX_IN_ISR
+  byte oldSREG = SREG;
+  cli();
+#endif
   shiftRegister.prepareShiftregisterWrite();
   shiftRegister.shiftOut(65535);
   shiftRegister.shiftOut(0);
   shiftRegister.finishShiftregisterWrite();        
+#ifdef MULTIPLEX_IN_ISR
+  SREG = oldSREG;
+#endif
 }
 
 /*######
@@ -233,13 +344,111 @@ boolean displayStatus() {
 }
 
 private:        
+#ifdef MULTIPLEX_IN_ISR
+/**
+ * Zu Beginn eines Frames (aus der ISR): Puffer tauschen, Ueberblendung
+ * weiterzaehlen und die Anzeiten fuer alten und neuen Inhalt berechnen.
+ */
+void startFrame() {
+  if (_swapPending) {
+    swapFrames();
+  } else if (_alpha >= FADINGDURATION) {
+    _alpha = _alpha - FADINGDURATION;
+  } else {
+    _alpha = 0;
+  }
+  _delayOldMatrix = map(_alpha, 0, FADINGCOUNTERLOAD, 0, ((_brightnessInPercent * PWM_DURATION)));
+  _delayNewMatrix = map(_alpha, FADINGCOUNTERLOAD, 0, 0, ((_brightnessInPercent * PWM_DURATION)));
+}
+
+/**
+ * Den hinteren Puffer nach vorne holen. Beim Ueberblenden wird der
+ * bisherige vordere Puffer zum alten Inhalt.
+ */
+void swapFrames() {
+  if (_fadePending) {
+    for (byte i = 0; i < linesToWrite; i++) {
+      _matrixOld[i] = _frames[_front][i];
+    }
+    _alpha = FADINGCOUNTERLOAD;
+  } else {
+    _alpha = 0;
+  }
+  _front ^= 1;
+  _swapPending = false;
+}
+
+/**
+ * Eine Zeile schieben, einschalten und Timer1 fuer die Phase stellen.
+ * Zeiten in Mikrosekunden.
+ */
+#ifdef SHIFTREGISTER_HARDWARE
+/*
+ * Die SPI-Hardware schiebt, waehrend die CPU weiterlaeuft. Deshalb wird
+ * zuerst die vorab geschobene Phase uebernommen und eingeschaltet, dann die
+ * uebergebene Phase in das Schieberegister des 74HC595 geschoben. Sie
+ * leuchtet erst beim naechsten Aufruf (eine Phase spaeter).
+ */
+void writeRow(byte k, word data, unsigned int onTime, unsigned int period) {
+  if (period < MULTIPLEX_MIN_PHASE) {
+    period = MULTIPLEX_MIN_PHASE;
+  }
+  OCR1A = _queuedPeriod * MULTIPLEX_TICKS_PER_US - 1;
+  OCR1B = _queuedOnTime * MULTIPLEX_TICKS_PER_US;
+  shiftRegister.latch();
+  if (_queuedOnTime && _displayOn) {
+    DPIN_LOW(outputEnablePin);
+  }
+
+  shiftRegister.shiftOut(data);
+  shiftRegister.shiftOut(1 << k);
+  _queuedOnTime = onTime;
+  _queuedPeriod = period;
+}
+#else
+void writeRow(byte k, word data, unsigned int onTime, unsigned int period) {
+  if (period < MULTIPLEX_MIN_PHASE) {
+    period = MULTIPLEX_MIN_PHASE;
+  }
+  // Im CTC-Modus wirkt OCR1A sofort, der Zaehler steht hier schon wieder kurz nach 0.
+  OCR1A = period * MULTIPLEX_TICKS_PER_US - 1;
+  OCR1B = onTime * MULTIPLEX_TICKS_PER_US;
+
+  shiftRegister.prepareShiftregisterWrite();
+  shiftRegister.shiftOut(data);
+  shiftRegister.shiftOut(1 << k);
+  shiftRegister.finishShiftregisterWrite();
+
+  if (onTime && _displayOn) {
+    DPIN_LOW(outputEnablePin);
+  }
+}
+#endif
+#endif
+
     ShiftRegister<dataPin, clockPin, latchPin> shiftRegister;
     
     unsigned int _alpha;
-    byte _brightnessInPercent;
-    boolean _displayOn; //Variable, die den Zustand des Displays beschreibt
+    volatile byte _brightnessInPercent;
+    volatile boolean _displayOn; //Variable, die den Zustand des Displays beschreibt
     word _matrixOld[16];
+#ifdef MULTIPLEX_IN_ISR
+    // Doppelter Bildspeicher: loop() schreibt den hinteren, die ISR zeigt den vorderen.
+    volatile word _frames[2][16];
+    volatile byte _front;
+    volatile boolean _swapPending;
+    volatile boolean _fadePending;
+    byte _row;
+    boolean _oldPhase;
+    unsigned int _usedOnOld;
+#ifdef SHIFTREGISTER_HARDWARE
+    // Die bereits geschobene, noch nicht uebernommene Phase
+    unsigned int _queuedOnTime;
+    unsigned int _queuedPeriod;
+#endif
+#else
     word _matrixNew[16];
+#endif
     unsigned int _delayOldMatrix;
     unsigned int _delayNewMatrix;
 };
@@ -0,0 +1,137 @@
+/**
+ * ModeMachine
+ * Die Modi der Uhr als Zustandsautomat mit einer Tabelle im PROGMEM.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "ModeMachine.h"
+
+/**
+ * Initialisierung.
+ *
+ * @param table: die Tabelle im PROGMEM, eine Zeile pro Modus.
+ *        count: die Zahl der Zeilen.
+ */
+ModeMachine::ModeMachine(const ModeState* table, byte count) {
+    _table = table;
+    _count = count;
+    _mode = 0;
+    _resumeMode = 0;
+    _lastInput = 0;
+}
+
+void ModeMachine::load(byte mode, ModeState* state) {
+    memcpy_P(state, &_table[mode], sizeof(ModeState));
+}
+
+/**
+ * Der aktuelle Modus.
+ */
+byte ModeMachine::getMode() {
+    return _mode;
+}
+
+/**
+ * In einen Modus wechseln: exit() des alten, dann enter() des neuen.
+ * Der gleiche Modus startet nur die Zeit bis zum Timeout neu.
+ */
+void ModeMachine::setMode(byte mode) {
+    _lastInput = millis();
+    if ((mode == _mode) || (mode >= _count)) {
+        return;
+    }
+    ModeState state;
+    load(_mode, &state);
+    boolean wasOff = state.flags & MODE_FLAG_DISPLAY_OFF;
+    if (state.exit) {
+        state.exit();
+    }
+    load(mode, &state);
+    if (!wasOff && (state.flags & MODE_FLAG_DISPLAY_OFF)) {
+        _resumeMode = _mode;
+    }
+    _mode = mode;
+    if (state.enter) {
+        state.enter();
+    }
+}
+
+/**
+ * Die Mode-Taste: zum Folgemodus, Modi mit zutreffendem skip() werden
+ * uebersprungen.
+ */
+void ModeMachine::next() {
+    ModeState state;
+    load(_mode, &state);
+    byte mode = state.next;
+    // hoechstens einmal rundherum, falls alle uebersprungen werden wollen
+    for (byte i = 0; i < _count; i++) {
+        load(mode, &state);
+        if (!state.skip || !state.skip()) {
+            break;
+        }
+        mode = state.next;
+    }
+    setMode(mode);
+}
+
+/**
+ * Zurueck zum Modus vor dem Abschalten der Anzeige.
+ */
+void ModeMachine::resume() {
+    setMode(_resumeMode);
+}
+
+/**
+ * H+ (plus = FALSE) oder M+ (plus = TRUE) im aktuellen Modus.
+ */
+void ModeMachine::button(boolean plus) {
+    _lastInput = millis();
+    ModeState state;
+    load(_mode, &state);
+    if (state.button) {
+        state.button(plus);
+    }
+}
+
+/**
+ * Den Bildschirm-Puffer fuer den aktuellen Modus beschreiben.
+ */
+void ModeMachine::render() {
+    ModeState state;
+    load(_mode, &state);
+    if (state.render) {
+        state.render();
+    }
+}
+
+/**
+ * Nach dem Timeout des Modus ohne Taste zu 'back' wechseln.
+ * Regelmaessig aufrufen.
+ */
+void ModeMachine::poll() {
+    byte timeout = pgm_read_byte(&_table[_mode].timeout);
+    if ((timeout != 0) && (millis() - _lastInput >= timeout * 1000UL)) {
+        setMode(pgm_read_byte(&_table[_mode].back));
+    }
+}
+
+/**
+ * Ist die Anzeige im aktuellen Modus aus?
+ */
+boolean ModeMachine::isDisplayOff() {
+    return pgm_read_byte(&_table[_mode].flags) & MODE_FLAG_DISPLAY_OFF;
+}
+
+/**
+ * Der Uebergang fuer neue Anzeigen im aktuellen Modus.
+ */
+byte ModeMachine::getTransition() {
+    return pgm_read_byte(&_table[_mode].transition);
+}
@@ -0,0 +1,80 @@
+/**
+ * ModeMachine
+ * Die Modi der Uhr als Zustandsautomat mit einer Tabelle im PROGMEM. Jede Zeile
+ * beschreibt einen Modus (die Zeile ist die Nummer des Modus, Zeile 0 ist der
+ * Startmodus):
+ *
+ *   next:       der Folgemodus fuer die Mode-Taste,
+ *   timeout:    nach so vielen Sekunden ohne Taste geht es zu 'back' (0 = nie),
+ *   flags:      MODE_FLAG_*,
+ *   transition: der Uebergang fuer neue Anzeigen in diesem Modus (TRANSITION_*),
+ *   skip:       wenn TRUE, ueberspringt die Mode-Taste diesen Modus,
+ *   enter/exit: beim Betreten/Verlassen des Modus,
+ *   render:     den Bildschirm-Puffer fuer den Modus beschreiben,
+ *   button:     H+ (plus = FALSE) bzw. M+ (plus = TRUE) im Modus.
+ *
+ * Nicht benoetigte Funktionen sind 0. Ein neuer Modus ist damit eine neue Zeile
+ * (und seine Funktionen), statt Aenderungen an fuenf Stellen in loop().
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef MODEMACHINE_H
+#define MODEMACHINE_H
+
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+
+// Die Anzeige ist aus (LED-Treiber schlaeft, kein Refresh).
+#define MODE_FLAG_DISPLAY_OFF 1
+
+typedef void (*ModeAction)();
+typedef void (*ModeButton)(boolean plus);
+typedef boolean (*ModePredicate)();
+
+struct ModeState {
+    byte next;
+    byte timeout;
+    byte back;
+    byte flags;
+    byte transition;
+    ModePredicate skip;
+    ModeAction enter;
+    ModeAction exit;
+    ModeAction render;
+    ModeButton button;
+};
+
+class ModeMachine {
+public:
+    ModeMachine(const ModeState* table, byte count);
+
+    byte getMode();
+    void setMode(byte mode);
+    void next();
+    void resume();
+
+    void button(boolean plus);
+    void render();
+    void poll();
+
+    boolean isDisplayOff();
+    byte getTransition();
+
+private:
+    const ModeState* _table;
+    byte _count;
+    byte _mode;
+    // wohin resume() zurueckkehrt (der Modus vor dem Abschalten der Anzeige)
+    byte _resumeMode;
+    unsigned long _lastInput;
+
+    void load(byte mode, ModeState* state);
+};
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * Modes
+ * Die Tabelle der Modi fuer die ModeMachine (siehe Modes.h).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.1
+ * @created  17.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - PROGMEM auch an der Definition.
+ */
+#include "Modes.h"
+
+const ModeState modeTable[] PROGMEM = {
+    // next, timeout, back, flags, transition,
+    //   skip, enter, exit, render, button
+    // STD_MODE_NORMAL
+    { STD_MODE_ALARM, 0, STD_MODE_NORMAL, 0, TRANSITION_TIME,
+        0, 0, 0, renderTime, 0 },
+    // STD_MODE_ALARM
+    { STD_MODE_SECONDS, 0, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        skipAlarm, enterAlarm, 0, renderAlarm, buttonAlarm },
+    // STD_MODE_SECONDS
+    { STD_MODE_BRIGHTNESS, 0, STD_MODE_NORMAL, 0, TRANSITION_CROSSFADE,
+        0, 0, 0, renderSeconds, 0 },
+    // STD_MODE_BRIGHTNESS
+    { STD_MODE_BLANK, 0, STD_MODE_NORMAL, 0, TRANSITION_CROSSFADE,
+        skipBrightness, 0, 0, renderBrightness, buttonBrightness },
+    // STD_MODE_BLANK
+    { STD_MODE_NORMAL, 0, STD_MODE_NORMAL, MODE_FLAG_DISPLAY_OFF, TRANSITION_NONE,
+        0, displayOff, displayOn, renderBlank, 0 },
+    // STD_MODE_NIGHT
+    { STD_MODE_NORMAL, 0, STD_MODE_NORMAL, MODE_FLAG_DISPLAY_OFF, TRANSITION_NONE,
+        0, displayOff, displayOn, renderBlank, 0 },
+    // EXT_MODE_LDR_MODE
+    { EXT_MODE_CORNERS, EXT_MODE_TIMEOUT, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, saveSettings, renderLdrMode, buttonLdrMode },
+    // EXT_MODE_CORNERS
+    { EXT_MODE_ENABLE_ALARM, EXT_MODE_TIMEOUT, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, saveSettings, renderCorners, buttonCorners },
+    // EXT_MODE_ENABLE_ALARM
+    { EXT_MODE_DCF_IS_INVERTED, EXT_MODE_TIMEOUT, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, saveSettings, renderEnableAlarm, buttonEnableAlarm },
+    // EXT_MODE_DCF_IS_INVERTED
+    { EXT_MODE_LANGUAGE, EXT_MODE_TIMEOUT, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, saveSettings, renderDcfIsInverted, buttonDcfIsInverted },
+    // EXT_MODE_LANGUAGE
+    { EXT_MODE_TIMESET, EXT_MODE_TIMEOUT, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, saveSettings, renderLanguage, buttonLanguage },
+    // EXT_MODE_TIMESET
+    { EXT_MODE_TIME_SHIFT, EXT_MODE_TIMEOUT, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, 0, renderTime, buttonTimeset },
+    // EXT_MODE_TIME_SHIFT
+    { EXT_MODE_TEST, EXT_MODE_TIMEOUT, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, saveSettings, renderTimeShift, buttonTimeShift },
+    // EXT_MODE_TEST (bleibt stehen)
+    { EXT_MODE_DCF_DEBUG, 0, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, 0, renderTest, 0 },
+    // EXT_MODE_DCF_DEBUG (bleibt stehen)
+#ifdef ENABLE_DCF77_TELEMETRY
+    { EXT_MODE_DCF_STATS, 0, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, 0, renderDcfDebug, 0 },
+    // EXT_MODE_DCF_STATS (bleibt stehen)
+    { STD_MODE_NORMAL, 0, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, 0, renderDcfStats, 0 },
+#else
+    { STD_MODE_NORMAL, 0, STD_MODE_NORMAL, 0, TRANSITION_NONE,
+        0, 0, 0, renderDcfDebug, 0 },
+#endif
+};
+static_assert(sizeof(modeTable) / sizeof(ModeState) == MODE_COUNT, "eine Zeile pro Modus");
+
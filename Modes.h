@@ -0,0 +1,100 @@
+/**
+ * Modes
+ * Die Modi der Uhr und ihre Tabelle fuer die ModeMachine. Die Nummer eines
+ * Modus ist seine Zeile in der Tabelle. Die Funktionen stehen in Qlockthree.ino.
+ *
+ * Die Mode-Taste geht reihum durch die Standard-Modi, Alarm und Helligkeit
+ * werden uebersprungen, wenn der Alarm aus ist bzw. der LDR regelt. Die
+ * erweiterten Modi erreicht man mit H+ und M+ zusammen im Modus 'Blank',
+ * die Einstell-Modi darunter kehren nach EXT_MODE_TIMEOUT Sekunden ohne
+ * Taste von selbst zur Zeit zurueck. 'Nacht' wird nur ueber die Nachtzeiten
+ * erreicht. Die Tabelle selbst steht in Modes.cpp.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.1
+ * @created  17.10.2026
+ * @updated  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Tabelle nach Modes.cpp verschoben, hier steht nur noch die Deklaration.
+ */
+#ifndef MODES_H
+#define MODES_H
+
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Configuration.h"
+#include "ModeMachine.h"
+#include "Transition.h"
+
+/**
+   Die Standard-Modi.
+*/
+#define STD_MODE_NORMAL     0
+#define STD_MODE_ALARM      1
+#define STD_MODE_SECONDS    2
+#define STD_MODE_BRIGHTNESS 3
+#define STD_MODE_BLANK      4
+// nicht manuell zu erreichender Modus...
+#define STD_MODE_NIGHT      5
+
+/**
+   Die erweiterten Modi.
+*/
+#define EXT_MODE_START           6
+#define EXT_MODE_LDR_MODE        6
+#define EXT_MODE_CORNERS         7
+#define EXT_MODE_ENABLE_ALARM    8
+#define EXT_MODE_DCF_IS_INVERTED 9
+#define EXT_MODE_LANGUAGE        10
+#define EXT_MODE_TIMESET         11
+#define EXT_MODE_TIME_SHIFT      12
+#define EXT_MODE_TEST            13
+#define EXT_MODE_DCF_DEBUG       14
+#ifdef ENABLE_DCF77_TELEMETRY
+#define EXT_MODE_DCF_STATS       15
+#define MODE_COUNT               16
+#else
+#define MODE_COUNT               15
+#endif
+
+boolean skipAlarm();
+boolean skipBrightness();
+
+void enterAlarm();
+void displayOff();
+void displayOn();
+void saveSettings();
+
+void renderTime();
+void renderAlarm();
+void renderSeconds();
+void renderBrightness();
+void renderBlank();
+void renderLdrMode();
+void renderCorners();
+void renderEnableAlarm();
+void renderDcfIsInverted();
+void renderLanguage();
+void renderTimeShift();
+void renderTest();
+void renderDcfDebug();
+#ifdef ENABLE_DCF77_TELEMETRY
+void renderDcfStats();
+#endif
+
+void buttonAlarm(boolean plus);
+void buttonBrightness(boolean plus);
+void buttonLdrMode(boolean plus);
+void buttonCorners(boolean plus);
+void buttonEnableAlarm(boolean plus);
+void buttonDcfIsInverted(boolean plus);
+void buttonLanguage(boolean plus);
+void buttonTimeset(boolean plus);
+void buttonTimeShift(boolean plus);
+
+extern const ModeState modeTable[] PROGMEM;
+
+#endif
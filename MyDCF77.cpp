@@ -4,18 +4,29 @@
  * Diese Klasse geht nicht von einem 'sauberen' Signal aus,
  * braucht aber eine externe 1-Sekunden-Basis. Sie ermittelt
  * die HIGH/LOWs statistisch.
+ * Mit MYDCF77_EDGE_INTERRUPT werden die Pulse ueber die Zeitstempel
+ * ihrer Flanken erkannt, mit MYDCF77_SOFT_DECODER ueber die Korrelation
+ * mit der Phase von Sekunde und Minute.
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.1
+ * @version  1.7
  * @created  14.1.2015
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:   - Erstellt.
  * V 1.1:   - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.2:   - Flanken mit Zeitstempel aus dem Pin-Change-Interrupt (MYDCF77_EDGE_INTERRUPT).
+ * V 1.3:   - Dekoder mit Phasenkorrelation und Bit-Sicherheiten fuer schwache Signale (MYDCF77_SOFT_DECODER).
+ * V 1.4:   - Telegramm als gepacktes 64-Bit-Wort, Felder und Paritaeten aus Tabellen, Bereichspruefung der Felder.
+ * V 1.5:   - Gruende fuer verworfene Minuten (getDecodeErrors()) und Daten fuer die DCF77Telemetry.
+ * V 1.6:   - enable(): Pin-Change-Interrupt aus, solange der Empfaenger schlaeft, alte Flanken verwerfen.
+ * V 1.7:   - asString() mit strcat() statt strncat().
  */
 #include "MyDCF77.h"
+#include <avr/pgmspace.h>
+#include "DCF77Telemetry.h"
 
 // #define DEBUG
 #include "Debug.h"
@@ -34,12 +45,50 @@ MyDCF77::MyDCF77(byte signalPin, byte statusLedPin) {
     digitalWrite(_statusLedPin, LOW);
 
     clearBits();
+    _decodeErrors = 0;
+
+#ifdef MYDCF77_EDGE_INTERRUPT
+    _edgeLevels = 0;
+    _edgeHead = 0;
+    _edgeTail = 0;
+    _inPulse = false;
+    _pulseStart = 0;
+    _pulseEnd = 0;
+    _telegramDecoded = false;
+#ifdef MYDCF77_SOFT_DECODER
+    _active = false;
+    _activeSince = 0;
+    _lastSecondStart = 0;
+    _phase = 0xFF;
+    for (byte i = 0; i < MYDCF77_SOFT_BINS; i++) {
+        _phaseHits[i] = 0;
+    }
+    for (byte i = 0; i < sizeof(_secondBins); i++) {
+        _secondBins[i] = 0;
+    }
+    for (byte i = 0; i < 60; i++) {
+        _minuteHits[i] = 0;
+    }
+    _slot = 0;
+    _nextMinutes = 0xFF;
+    for (byte i = 0; i < MYDCF77_TELEGRAMMLAENGE; i++) {
+        _soft[i] = 0;
+    }
+#endif
 
+    // Pin-Change-Interrupt nur fuer den Signal-Pin einschalten. Die
+    // passende ISR (PCINT0/1/2) steht in der Qlockthree.ino.
+    _pinInput = portInputRegister(digitalPinToPort(_signalPin));
+    _pinMask = digitalPinToBitMask(_signalPin);
+    *digitalPinToPCMSK(_signalPin) |= _BV(digitalPinToPCMSKbit(_signalPin));
+    *digitalPinToPCICR(_signalPin) |= _BV(digitalPinToPCICRbit(_signalPin));
+#else
     for (byte i = 0; i < MYDCF77_MEANCOUNT; i++) {
         _meanvalues[i] = MYDCF77_MEANSTARTVALUE;
     }
     _meanpointer = 0;
     _highcount = 0;
+#endif
 }
 
 /**
@@ -53,6 +102,41 @@ void MyDCF77::statusLed(boolean on) {
     }
 }
 
+/**
+ * Den Empfang ein- oder ausschalten (den Empfaenger selbst schaltet
+ * PIN_DCF77_PON). Aus ist auch der Pin-Change-Interrupt aus. Beim
+ * Einschalten werden liegengebliebene Flanken und der angefangene Puls
+ * verworfen, ihre Zeitstempel koennen Stunden alt sein.
+ */
+void MyDCF77::enable(boolean on) {
+#ifdef MYDCF77_EDGE_INTERRUPT
+    if (!on) {
+        *digitalPinToPCMSK(_signalPin) &= ~_BV(digitalPinToPCMSKbit(_signalPin));
+        return;
+    }
+    // Der Interrupt ist noch aus, der Puffer gehoert uns.
+    _edgeHead = 0;
+    _edgeTail = 0;
+    _inPulse = false;
+    _pulseStart = millis();
+    _pulseEnd = _pulseStart;
+#ifdef MYDCF77_SOFT_DECODER
+    _active = false;
+    for (byte i = 0; i < sizeof(_secondBins); i++) {
+        _secondBins[i] = 0;
+    }
+#endif
+    clearBits();
+    // Bis zum ersten Minutenanfang ist die Minute unvollstaendig.
+    _bitError = true;
+    *digitalPinToPCMSK(_signalPin) |= _BV(digitalPinToPCMSKbit(_signalPin));
+#else
+    if (on) {
+        clearBits();
+    }
+#endif
+}
+
 /**
  * Liegt ein Signal vom Empfaenger an?
  */
@@ -76,13 +160,355 @@ boolean MyDCF77::signal(boolean signalIsInverted) {
 
 /**
  * Aufsammeln der Zustaende des DCF77-Signals.
+ * Mit MYDCF77_EDGE_INTERRUPT werden hier nur die im Interrupt gesammelten
+ * Flanken ausgewertet, wie oft poll() laeuft, ist dann egal (solange
+ * nicht mehr als MYDCF77_EDGE_BUFFER Flanken dazwischen liegen).
  */
 void MyDCF77::poll(boolean signalIsInverted) {
+#ifdef MYDCF77_SOFT_DECODER
+    // Erst den Kopf, dann die Zeit lesen, damit alle Flanken davor liegen.
+    byte head = _edgeHead;
+    unsigned long now = millis();
+    while (_edgeTail != head) {
+        boolean level = bitRead(_edgeLevels, _edgeTail);
+        sample(level != signalIsInverted, now - (word)((word)now - _edgeTimes[_edgeTail]));
+        _edgeTail = (_edgeTail + 1) & (MYDCF77_EDGE_BUFFER - 1);
+    }
+    if (_active) {
+        markActive(_activeSince, now);
+        _activeSince = now;
+    }
+
+    if (_phase == 0xFF) {
+        // Noch nicht eingerastet, einmal pro Sekunde nachsehen.
+        if (now - _lastSecondStart >= 1000) {
+            _lastSecondStart = now;
+            for (byte i = 0; i < sizeof(_secondBins); i++) {
+                _secondBins[i] = 0;
+            }
+            _phase = secondPhase();
+        }
+        return;
+    }
+    unsigned long start = now - (now - (unsigned long)_phase * MYDCF77_SOFT_BIN) % 1000;
+    if ((now - start >= MYDCF77_SOFT_EVALUATE) && (start - _lastSecondStart > 500)) {
+        _lastSecondStart = start;
+        evaluateSecond();
+        _phase = secondPhase();
+    }
+#elif defined(MYDCF77_EDGE_INTERRUPT)
+    while (_edgeTail != _edgeHead) {
+        // der Eintrag gehoert uns, bis _edgeTail weiterzaehlt
+        boolean level = bitRead(_edgeLevels, _edgeTail);
+        edge(level != signalIsInverted, _edgeTimes[_edgeTail]);
+        _edgeTail = (_edgeTail + 1) & (MYDCF77_EDGE_BUFFER - 1);
+    }
+#else
     if (signal(signalIsInverted)) {
         _highcount++;
     }
+#endif
+}
+
+#ifdef MYDCF77_EDGE_INTERRUPT
+/**
+ * Aus dem Pin-Change-Interrupt aufzurufen. Merkt sich Pegel und Zeitpunkt
+ * der Flanke, ausgewertet wird in poll(). Ist der Puffer voll, geht die
+ * Flanke verloren (dann stimmt die Minute nicht und wird verworfen).
+ */
+void MyDCF77::edgeInterrupt() {
+    byte next = (_edgeHead + 1) & (MYDCF77_EDGE_BUFFER - 1);
+    if (next == _edgeTail) {
+        return;
+    }
+    _edgeTimes[_edgeHead] = millis();
+    if (*_pinInput & _pinMask) {
+        _edgeLevels |= _BV(_edgeHead);
+    } else {
+        _edgeLevels &= ~_BV(_edgeHead);
+    }
+    _edgeHead = next;
 }
 
+/**
+ * Eine Flanke auswerten. active ist TRUE am Anfang eines Pulses (Absenkung
+ * des Traegers), time der Zeitstempel in Millisekunden (darf ueberlaufen).
+ * Ein Puls wird erst beim Anfang des naechsten ausgewertet, so koennen
+ * kurze Aussetzer im Puls noch uebersprungen werden.
+ * Oeffentlich, damit man aufgezeichnete Flanken einspielen kann.
+ */
+void MyDCF77::edge(boolean active, word time) {
+    if (!active) {
+        if (_inPulse) {
+            _inPulse = false;
+            _pulseEnd = time;
+        }
+        return;
+    }
+
+    if (_inPulse) {
+        return;
+    }
+    if ((word)(time - _pulseEnd) < MYDCF77_PULSE_MIN) {
+        // kurzer Aussetzer, der Puls geht weiter
+        _inPulse = true;
+        return;
+    }
+    if ((word)(time - _pulseStart) < MYDCF77_PERIOD_MIN) {
+        // Stoerung zwischen zwei Pulsen
+        return;
+    }
+
+    // Der letzte Puls ist vorbei, also jetzt auswerten...
+    word width = _pulseEnd - _pulseStart;
+    DCF77_TELEMETRY_PULSE(width);
+    DEBUG_PRINT(F("pulse = "));
+    DEBUG_PRINT(width);
+    if ((width < MYDCF77_PULSE_MIN) || (width > MYDCF77_PULSE_MAX)) {
+        _bitError = true;
+        DEBUG_PRINTLN(F("; ERROR"));
+    } else if (_bitsPointer < MYDCF77_TELEGRAMMLAENGE) {
+        setBit(_bitsPointer, width > MYDCF77_PULSE_THRESHOLD);
+        DEBUG_PRINTLN(getBit(_bitsPointer) ? F("; HIGH") : F("; LOW"));
+    } else {
+        // Schaltsekunde oder verpasster Minutenanfang
+        _bitError = true;
+        DEBUG_PRINTLN(F("; TOO MANY"));
+    }
+    if (_bitsPointer <= MYDCF77_TELEGRAMMLAENGE) {
+        _bitsPointer++;
+    }
+
+    // ...und in der 59. Sekunde fehlt der Puls: eine neue Minute beginnt.
+    if ((word)(time - _pulseStart) > MYDCF77_MINUTE_GAP) {
+        DEBUG_PRINTLN(F("PAUSE"));
+        if (!_bitError && (_bitsPointer == MYDCF77_TELEGRAMMLAENGE)) {
+            _telegramDecoded = decode();
+        } else {
+            _decodeErrors = MYDCF77_ERROR_SIGNAL;
+        }
+        DCF77_TELEMETRY_MINUTE(_decodeErrors);
+        clearBits();
+    }
+
+    _inPulse = true;
+    _pulseStart = time;
+}
+
+#ifdef MYDCF77_SOFT_DECODER
+/**
+ * Einen Pegelwechsel mit vollem Zeitstempel einsortieren.
+ */
+void MyDCF77::sample(boolean active, unsigned long time) {
+    if (_active && !active) {
+        markActive(_activeSince, time);
+        DCF77_TELEMETRY_PULSE(time - _activeSince);
+    }
+    if (!_active && active) {
+        _activeSince = time;
+    }
+    _active = active;
+}
+
+/**
+ * Das Signal war von from bis to aktiv: die Faecher der laufenden Sekunde
+ * markieren. Jedes Fach zaehlt pro Sekunde hoechstens einen Treffer fuer
+ * die Phase, egal wie oft poll() dazwischen laeuft.
+ */
+void MyDCF77::markActive(unsigned long from, unsigned long to) {
+    if ((long)(to - from) < 0) {
+        return;
+    }
+    unsigned long bin = from / MYDCF77_SOFT_BIN;
+    unsigned long last = to / MYDCF77_SOFT_BIN;
+    if (last - bin >= MYDCF77_SOFT_BINS) {
+        bin = last - MYDCF77_SOFT_BINS + 1;
+    }
+    for (; bin <= last; bin++) {
+        byte b = bin % MYDCF77_SOFT_BINS;
+        if (!(_secondBins[b >> 3] & _BV(b & 7))) {
+            _secondBins[b >> 3] |= _BV(b & 7);
+            if (_phaseHits[b] == 255) {
+                for (byte i = 0; i < MYDCF77_SOFT_BINS; i++) {
+                    _phaseHits[i] >>= 1;
+                }
+            }
+            _phaseHits[b]++;
+        }
+    }
+}
+
+/**
+ * Wie viele der 100ms ab Fach from waren in dieser Sekunde aktiv (0..5)?
+ */
+byte MyDCF77::countBins(byte from) {
+    byte count = 0;
+    for (byte i = 0; i < MYDCF77_SOFT_PULSE; i++) {
+        byte b = (from + i) % MYDCF77_SOFT_BINS;
+        if (_secondBins[b >> 3] & _BV(b & 7)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * Die Phase der Sekunde: das Fach, ab dem die Treffer am staerksten
+ * ansteigen (die Sekundenmarke). 0xFF, solange sie sich nicht abhebt.
+ */
+byte MyDCF77::secondPhase() {
+    int best = 0;
+    byte phase = 0xFF;
+    for (byte b = 0; b < MYDCF77_SOFT_BINS; b++) {
+        int rise = 0;
+        for (byte i = 0; i < MYDCF77_SOFT_PULSE; i++) {
+            rise += _phaseHits[(b + i) % MYDCF77_SOFT_BINS];
+            rise -= _phaseHits[(b + MYDCF77_SOFT_BINS - 1 - i) % MYDCF77_SOFT_BINS];
+        }
+        if (rise > best) {
+            best = rise;
+            phase = b;
+        }
+    }
+    if (best < MYDCF77_SOFT_LOCK) {
+        return 0xFF;
+    }
+    return phase;
+}
+
+/**
+ * Die Phase der Minute: die Sekunde, in der die Sekundenmarke ueber
+ * die letzten Minuten am seltensten da war. 0xFF, solange unklar.
+ */
+byte MyDCF77::minutePhase() {
+    word sum = 0;
+    byte min = 255;
+    byte mark = 0xFF;
+    for (byte i = 0; i < 60; i++) {
+        sum += _minuteHits[i];
+        if (_minuteHits[i] < min) {
+            min = _minuteHits[i];
+            mark = i;
+        }
+    }
+    byte average = sum / 60;
+    if ((average < 100) || ((word)min * 4 > average)) {
+        return 0xFF;
+    }
+    return mark;
+}
+
+/**
+ * Eine Sekunde an der eingerasteten Phase auswerten: Sekundenmarke
+ * (erste 100ms) fuer die Phase der Minute, Datenbit (zweite 100ms) als
+ * Sicherheit von -100 (sicher 0) bis +100 (sicher 1).
+ */
+void MyDCF77::evaluateSecond() {
+    byte presence = countBins(_phase);
+    byte data = countBins((_phase + MYDCF77_SOFT_PULSE) % MYDCF77_SOFT_BINS);
+    for (byte i = 0; i < sizeof(_secondBins); i++) {
+        _secondBins[i] = 0;
+    }
+
+    _slot = (_slot + 1) % 60;
+    _minuteHits[_slot] = _minuteHits[_slot] - (_minuteHits[_slot] >> 2) + presence * 10;
+    byte mark = minutePhase();
+    if (mark == 0xFF) {
+        _bitsPointer = 0;
+        return;
+    }
+
+    // Die Sekunde nach der fehlenden Marke ist Bit 0.
+    byte bit = (_slot + 119 - mark) % 60;
+    if (bit == 0) {
+        DEBUG_PRINTLN(F("PAUSE"));
+        _telegramDecoded = decodeSoft();
+        DCF77_TELEMETRY_MINUTE(_decodeErrors);
+        if (_telegramDecoded) {
+            _nextMinutes = (_minutes + 1) % 60;
+        } else if (_nextMinutes != 0xFF) {
+            _nextMinutes = (_nextMinutes + 1) % 60;
+        }
+        // Stunden und Datum aendern sich selten: deren Sicherheit halb in die
+        // naechste Minute mitnehmen. Die Minuten zaehlen weiter, dafuer gibt
+        // es eine Vorhersage.
+        for (byte i = 0; i < MYDCF77_TELEGRAMMLAENGE; i++) {
+            _soft[i] = (i < 29) ? 0 : _soft[i] / 2;
+        }
+        if (_nextMinutes != 0xFF) {
+            predictMinutes(_nextMinutes);
+        }
+    }
+    if (bit < MYDCF77_TELEGRAMMLAENGE) {
+        int soft = _soft[bit] + ((int)data * 2 - MYDCF77_SOFT_PULSE) * 20;
+        _soft[bit] = constrain(soft, -127, 127);
+        setBit(bit, _soft[bit] > 0);
+        _bitsPointer = bit;
+        DEBUG_PRINT(F("bit "));
+        DEBUG_PRINT(bit);
+        DEBUG_PRINT(F(" = "));
+        DEBUG_PRINTLN((int)_soft[bit]);
+    }
+}
+
+/**
+ * Die erwartete Minute (BCD plus Paritaet P1) als schwache Sicherheit
+ * vorbelegen, die Sekunden der neuen Minute koennen sie ueberstimmen.
+ */
+void MyDCF77::predictMinutes(byte minutes) {
+    byte bcd = ((minutes / 10) << 4) | (minutes % 10);
+    byte parity = 0;
+    for (byte i = 0; i < 7; i++) {
+        byte b = (bcd >> i) & 1;
+        parity ^= b;
+        _soft[21 + i] = b ? MYDCF77_SOFT_PREDICTION : -MYDCF77_SOFT_PREDICTION;
+    }
+    _soft[28] = parity ? MYDCF77_SOFT_PREDICTION : -MYDCF77_SOFT_PREDICTION;
+}
+
+/**
+ * Stimmt die Paritaet von first bis last (inklusive Paritaetsbit) nicht,
+ * das unsicherste Bit kippen.
+ */
+void MyDCF77::repairParity(byte first, byte last) {
+    byte weakest = first;
+    for (byte i = first; i <= last; i++) {
+        if (abs(_soft[i]) < abs(_soft[weakest])) {
+            weakest = i;
+        }
+    }
+    if (parity(first, last)) {
+        setBit(weakest, !getBit(weakest));
+    }
+}
+
+/**
+ * Die gesammelte Minute entscheiden: Bits nach Vorzeichen, Paritaeten
+ * reparieren, und nur bei genug mittlerer Sicherheit dekodieren.
+ */
+boolean MyDCF77::decodeSoft() {
+    word confidence = 0;
+    for (byte i = 0; i < MYDCF77_TELEGRAMMLAENGE; i++) {
+        setBit(i, _soft[i] > 0);
+        if (i >= 17) {
+            confidence += abs(_soft[i]);
+        }
+    }
+    confidence /= MYDCF77_TELEGRAMMLAENGE - 17;
+    DEBUG_PRINT(F("confidence = "));
+    DEBUG_PRINTLN(confidence);
+    if (confidence < MYDCF77_SOFT_CONFIDENCE) {
+        _decodeErrors = MYDCF77_ERROR_SIGNAL;
+        return false;
+    }
+    repairParity(21, 28);
+    repairParity(29, 35);
+    repairParity(36, 58);
+    return decode();
+}
+#endif
+#endif
+
 /**
  * Eine Sekunde startet. Muss von einem externen
  * Zeitgeber, z. B. einer RTC, aufgerufen werden.
@@ -94,6 +520,12 @@ void MyDCF77::poll(boolean signalIsInverted) {
  * alte Informationen.
  */
 boolean MyDCF77::newSecond() {
+#ifdef MYDCF77_EDGE_INTERRUPT
+    // Die Sekunden kommen aus den Flanken, hier nur das Ergebnis abholen.
+    boolean decoded = _telegramDecoded;
+    _telegramDecoded = false;
+    return decoded;
+#else
     boolean retVal = false;
 
     if (_highcount != 0) {
@@ -116,10 +548,10 @@ boolean MyDCF77::newSecond() {
         DEBUG_PRINT(_highcount);
 
         if (_highcount > average) {
-            _bits[_bitsPointer] = 1;
+            setBit(_bitsPointer, true);
             DEBUG_PRINTLN(F("; HIGH"));
         } else {
-            _bits[_bitsPointer] = 0;
+            setBit(_bitsPointer, false);
             DEBUG_PRINTLN(F("; LOW"));
         }
         _bitsPointer++;
@@ -130,6 +562,7 @@ boolean MyDCF77::newSecond() {
         // Pause
         DEBUG_PRINTLN(F("PAUSE"));
         retVal = decode();
+        DCF77_TELEMETRY_MINUTE(_decodeErrors);
         _bitsPointer = 0;
         clearBits();
     }
@@ -137,13 +570,14 @@ boolean MyDCF77::newSecond() {
     _highcount = 0;
 
     return retVal;
+#endif
 }
 
 /**
  * Ein Bit im Array zum Debuggen (Anzeigen) bekommen.
  */
 byte MyDCF77::getBitAtPos(byte pos) {
-    return _bits[pos];
+    return getBit(pos);
 }
 
 /**
@@ -153,235 +587,97 @@ byte MyDCF77::getBitPointer() {
     return _bitsPointer;
 }
 
+/**
+ * Die Felder des Telegramms: erstes Bit, Anzahl Bits (BCD) und erlaubter Bereich.
+ */
+struct MyDCF77Field {
+    byte first;
+    byte length;
+    byte min;
+    byte max;
+};
+
+extern const MyDCF77Field MYDCF77_FIELDS[] PROGMEM;
+const MyDCF77Field MYDCF77_FIELDS[] = {
+    {21, 7, 0, 59}, // Minuten
+    {29, 6, 0, 23}, // Stunden
+    {36, 6, 1, 31}, // Tag
+    {42, 3, 1, 7},  // Wochentag
+    {45, 5, 1, 12}, // Monat
+    {50, 8, 0, 99}  // Jahr
+};
+
+#define MYDCF77_FIELD_COUNT (sizeof(MYDCF77_FIELDS) / sizeof(MyDCF77Field))
+
+/**
+ * Die Paritaeten P1 (Minuten), P2 (Stunden) und P3 (Datum): erstes und letztes
+ * Bit, das letzte ist jeweils das Paritaetsbit.
+ */
+extern const byte MYDCF77_PARITIES[][2] PROGMEM;
+const byte MYDCF77_PARITIES[][2] = {
+    {21, 28},
+    {29, 35},
+    {36, 58}
+};
+
 /**
  * Decodierung des Telegramms...
  */
 boolean MyDCF77::decode() {
-    int c = 0; // bitcount for checkbit
-    boolean ok = true;
+    _decodeErrors = 0;
+    byte values[MYDCF77_FIELD_COUNT];
 
     DEBUG_PRINTLN(F("Decoding telegram..."));
     DEBUG_FLUSH();
 
-    if (_bits[20] != 1) {
-        ok = false;
+    if (!getBit(20)) {
+        _decodeErrors |= MYDCF77_ERROR_S;
         DEBUG_PRINTLN(F("Check-bit S failed."));
         DEBUG_FLUSH();
     }
 
-    if (_bits[17] == _bits[18]) {
-        ok = false;
+    if (getBit(17) == getBit(18)) {
+        _decodeErrors |= MYDCF77_ERROR_Z;
         DEBUG_PRINTLN(F("Check Z1 != Z2 failed."));
         DEBUG_FLUSH();
     }
 
-    //
-    // minutes
-    //
-    _minutes = 0;
-    c = 0;
-    if (_bits[21] == 1) {
-        c++;
-        _minutes += _bits[21] * 1;
-    }
-    if (_bits[22] == 1) {
-        c++;
-        _minutes += _bits[22] * 2;
-    }
-    if (_bits[23] == 1) {
-        c++;
-        _minutes += _bits[23] * 4;
-    }
-    if (_bits[24] == 1) {
-        c++;
-        _minutes += _bits[24] * 8;
-    }
-    if (_bits[25] == 1) {
-        c++;
-        _minutes += _bits[25] * 10;
-    }
-    if (_bits[26]) {
-        c++;
-        _minutes += _bits[26] * 20;
-    }
-    if (_bits[27]) {
-        c++;
-        _minutes += _bits[27] * 40;
-    }
-    DEBUG_PRINT(F("Minutes: "));
-    DEBUG_PRINTLN(_minutes);
-    DEBUG_FLUSH();
-    if ((c + _bits[28]) % 2 != 0) {
-        ok = false;
-        DEBUG_PRINTLN(F("Check-bit P1: minutes failed."));
-        DEBUG_FLUSH();
-    }
-
-    //
-    // hour
-    //
-    _hours = 0;
-    c = 0;
-    if (_bits[29] == 1) {
-        c++;
-        _hours += _bits[29] * 1;
-    }
-    if (_bits[30] == 1) {
-        c++;
-        _hours += _bits[30] * 2;
-    }
-    if (_bits[31] == 1) {
-        c++;
-        _hours += _bits[31] * 4;
-    }
-    if (_bits[32] == 1) {
-        c++;
-        _hours += _bits[32] * 8;
-    }
-    if (_bits[33] == 1) {
-        c++;
-        _hours += _bits[33] * 10;
-    }
-    if (_bits[34] == 1) {
-        c++;
-        _hours += _bits[34] * 20;
-    }
-    DEBUG_PRINT(F("Hours: "));
-    DEBUG_PRINTLN(_hours);
-    DEBUG_FLUSH();
-    if ((c + _bits[35]) % 2 != 0) {
-        ok = false;
-        DEBUG_PRINTLN(F("Check-bit P2: hours failed."));
-        DEBUG_FLUSH();
-    }
-
-    //
-    // date
-    //
-    _date = 0;
-    c = 0;
-    if (_bits[36] == 1) {
-        c++;
-        _date += _bits[36] * 1;
-    }
-    if (_bits[37] == 1) {
-        c++;
-        _date += _bits[37] * 2;
-    }
-    if (_bits[38] == 1) {
-        c++;
-        _date += _bits[38] * 4;
-    }
-    if (_bits[39] == 1) {
-        c++;
-        _date += _bits[39] * 8;
-    }
-    if (_bits[40] == 1) {
-        c++;
-        _date += _bits[40] * 10;
-    }
-    if (_bits[41] == 1) {
-        c++;
-        _date += _bits[41] * 20;
-    }
-    DEBUG_PRINT(F("Date: "));
-    DEBUG_PRINTLN(_date);
-    DEBUG_FLUSH();
-
-    //
-    // day of week
-    //
-    _dayOfWeek = 0;
-    if (_bits[42] == 1) {
-        c++;
-        _dayOfWeek += _bits[42] * 1;
-    }
-    if (_bits[43] == 1) {
-        c++;
-        _dayOfWeek += _bits[43] * 2;
-    }
-    if (_bits[44] == 1) {
-        c++;
-        _dayOfWeek += _bits[44] * 4;
+    for (byte i = 0; i < sizeof(MYDCF77_PARITIES) / sizeof(MYDCF77_PARITIES[0]); i++) {
+        if (parity(pgm_read_byte(&MYDCF77_PARITIES[i][0]), pgm_read_byte(&MYDCF77_PARITIES[i][1]))) {
+            _decodeErrors |= MYDCF77_ERROR_P1 << i;
+            DEBUG_PRINT(F("Check-bit P"));
+            DEBUG_PRINT(i + 1);
+            DEBUG_PRINTLN(F(" failed."));
+            DEBUG_FLUSH();
+        }
     }
-    DEBUG_PRINT(F("Day of week: "));
-    DEBUG_PRINTLN(_dayOfWeek);
-    DEBUG_FLUSH();
 
-    //
-    // month
-    //
-    _month = 0;
-    if (_bits[45] == 1) {
-        c++;
-        _month += _bits[45] * 1;
-    }
-    if (_bits[46] == 1) {
-        c++;
-        _month += _bits[46] * 2;
-    }
-    if (_bits[47] == 1) {
-        c++;
-        _month += _bits[47] * 4;
-    }
-    if (_bits[48] == 1) {
-        c++;
-        _month += _bits[48] * 8;
-    }
-    if (_bits[49] == 1) {
-        c++;
-        _month += _bits[49] * 10;
+    for (byte i = 0; i < MYDCF77_FIELD_COUNT; i++) {
+        byte bcd = bitsAt(pgm_read_byte(&MYDCF77_FIELDS[i].first), pgm_read_byte(&MYDCF77_FIELDS[i].length));
+        values[i] = (bcd >> 4) * 10 + (bcd & 0x0F);
+        if (((bcd & 0x0F) > 9) || (values[i] < pgm_read_byte(&MYDCF77_FIELDS[i].min)) || (values[i] > pgm_read_byte(&MYDCF77_FIELDS[i].max))) {
+            _decodeErrors |= MYDCF77_ERROR_RANGE;
+            DEBUG_PRINT(F("Range check of field "));
+            DEBUG_PRINT(i);
+            DEBUG_PRINTLN(F(" failed."));
+            DEBUG_FLUSH();
+        }
     }
-    DEBUG_PRINT(F("Month: "));
-    DEBUG_PRINTLN(_month);
-    DEBUG_FLUSH();
 
-    //
-    // year
-    //
-    _year = 0;
-    if (_bits[50] == 1) {
-        c++;
-        _year += _bits[50] * 1;
-    }
-    if (_bits[51] == 1) {
-        c++;
-        _year += _bits[51] * 2;
-    }
-    if (_bits[52] == 1) {
-        c++;
-        _year += _bits[52] * 4;
-    }
-    if (_bits[53] == 1) {
-        c++;
-        _year += _bits[53] * 8;
-    }
-    if (_bits[54] == 1) {
-        c++;
-        _year += _bits[54] * 10;
-    }
-    if (_bits[55] == 1) {
-        c++;
-        _year += _bits[55] * 20;
-    }
-    if (_bits[56] == 1) {
-        c++;
-        _year += _bits[56] * 40;
-    }
-    if (_bits[57] == 1) {
-        c++;
-        _year += _bits[57] * 80;
-    }
-    DEBUG_PRINT(F("Year: "));
-    DEBUG_PRINTLN(_year);
-    DEBUG_FLUSH();
-    if ((c + _bits[58]) % 2 != 0) {
-        ok = false;
-        DEBUG_PRINTLN(F("Check-bit P3: date failed."));
+    boolean ok = (_decodeErrors == 0);
+    if (ok) {
+        _minutes = values[0];
+        _hours = values[1];
+        _date = values[2];
+        _dayOfWeek = values[3];
+        _month = values[4];
+        _year = values[5];
+        _summerTime = getBit(17);
+        _leapSecond = getBit(19);
+        DEBUG_PRINT(F("Decoded: "));
+        DEBUG_PRINTLN(asString());
         DEBUG_FLUSH();
-    }
-
-    if (!ok) {
+    } else {
         // discard date...
         _minutes = 0;
         _hours = 0;
@@ -389,11 +685,56 @@ boolean MyDCF77::decode() {
         _dayOfWeek = 0;
         _month = 0;
         _year = 0;
+        _summerTime = false;
+        _leapSecond = false;
     }
 
     return ok;
 }
 
+/**
+ * Ein Bit des Telegramms bekommen.
+ */
+byte MyDCF77::getBit(byte pos) {
+    return (((const byte*)&_telegram)[pos >> 3] >> (pos & 7)) & 1;
+}
+
+/**
+ * Ein Bit des Telegramms setzen.
+ */
+void MyDCF77::setBit(byte pos, boolean value) {
+    byte* b = ((byte*)&_telegram) + (pos >> 3);
+    if (value) {
+        *b |= _BV(pos & 7);
+    } else {
+        *b &= ~_BV(pos & 7);
+    }
+}
+
+/**
+ * Bis zu 8 Bits ab first als Zahl bekommen (das erste Bit ist das
+ * niederwertigste). Liest nur die zwei betroffenen Bytes statt das
+ * ganze 64-Bit-Wort zu schieben.
+ */
+byte MyDCF77::bitsAt(byte first, byte length) {
+    const byte* b = ((const byte*)&_telegram) + (first >> 3);
+    word w = b[0] | (b[1] << 8);
+    return (w >> (first & 7)) & ((1 << length) - 1);
+}
+
+/**
+ * Die Paritaet der Bits von first bis last (inklusive).
+ *
+ * @return 1, wenn die Anzahl der Einsen ungerade ist.
+ */
+byte MyDCF77::parity(byte first, byte last) {
+    byte p = 0;
+    for (byte i = first; i <= last; i++) {
+        p ^= getBit(i);
+    }
+    return p;
+}
+
 /**
  * Das Zeittelegramm als String bekommen
  */
@@ -404,38 +745,38 @@ char* MyDCF77::asString() {
     // build the string...
     if (_hours < 10) {
         sprintf(temp, "0%d:", _hours);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     } else {
         sprintf(temp, "%d:", _hours);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     }
 
     if (_minutes < 10) {
         sprintf(temp, "0%d ", _minutes);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     } else {
         sprintf(temp, "%d ", _minutes);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     }
 
     if (_date < 10) {
         sprintf(temp, "0%d.", _date);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     } else {
         sprintf(temp, "%d.", _date);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     }
 
     if (_month < 10) {
         sprintf(temp, "0%d.", _month);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     } else {
         sprintf(temp, "%d.", _month);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     }
 
     sprintf(temp, "%d", _year);
-    strncat(_cDateTime, temp, strlen(temp));
+    strcat(_cDateTime, temp);
 
     return _cDateTime;
 }
@@ -444,10 +785,11 @@ char* MyDCF77::asString() {
  * Das Bits-Array loeschen.
  */
 void MyDCF77::clearBits() {
-    for (byte i = 0; i < MYDCF77_TELEGRAMMLAENGE; i++) {
-        _bits[i] = 0;
-    }
+    _telegram = 0;
     _bitsPointer = 0;
+#ifdef MYDCF77_EDGE_INTERRUPT
+    _bitError = false;
+#endif
 }
 
 //
@@ -477,3 +819,24 @@ byte MyDCF77::getMonth() {
 byte MyDCF77::getYear() {
     return _year;
 }
+
+/**
+ * Sommerzeit (MESZ, Bit Z1) laut letztem Telegramm?
+ */
+boolean MyDCF77::isSummerTime() {
+    return _summerTime;
+}
+
+/**
+ * Schaltsekunde am Ende der Stunde angekuendigt (Bit A2)?
+ */
+boolean MyDCF77::isLeapSecondAnnounced() {
+    return _leapSecond;
+}
+
+/**
+ * Warum die letzte Minute verworfen wurde (MYDCF77_ERROR_xx), 0 wenn sie ok war.
+ */
+byte MyDCF77::getDecodeErrors() {
+    return _decodeErrors;
+}
@@ -4,16 +4,27 @@
  * Diese Klasse geht nicht von einem 'sauberen' Signal aus,
  * braucht aber eine externe 1-Sekunden-Basis. Sie ermittelt
  * die HIGH/LOWs statistisch.
+ * Mit MYDCF77_EDGE_INTERRUPT bekommt jede Flanke im Pin-Change-Interrupt
+ * einen Zeitstempel (millis(), Timer0) und die Pulse werden ueber ihre
+ * Laenge erkannt (100ms = 0, 200ms = 1, fehlender Puls = Minutenanfang).
+ * Mit MYDCF77_SOFT_DECODER wird stattdessen auf die Phase der Sekunde und
+ * der Minute eingerastet (Korrelation ueber viele Sekunden) und jedes Bit
+ * bekommt eine Sicherheit, die ueber mehrere Minuten gesammelt wird.
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.1
+ * @version  1.6
  * @created  14.1.2015
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.0:   - Erstellt.
  * V 1.1:   - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.2:   - Flanken mit Zeitstempel aus dem Pin-Change-Interrupt (MYDCF77_EDGE_INTERRUPT).
+ * V 1.3:   - Dekoder mit Phasenkorrelation und Bit-Sicherheiten fuer schwache Signale (MYDCF77_SOFT_DECODER).
+ * V 1.4:   - Telegramm als gepacktes 64-Bit-Wort, Felder und Paritaeten aus Tabellen, Bereichspruefung der Felder.
+ * V 1.5:   - Gruende fuer verworfene Minuten (getDecodeErrors()) und Daten fuer die DCF77Telemetry.
+ * V 1.6:   - enable(): Pin-Change-Interrupt aus, solange der Empfaenger schlaeft, alte Flanken verwerfen.
  */
 #ifndef MYDCF77_H
 #define MYDCF77_H
@@ -21,14 +32,60 @@
 #include "Arduino.h"
 #include "Configuration.h"
 
+#ifdef MYDCF77_EDGE_INTERRUPT
+// Platz fuer Flanken zwischen zwei Aufrufen von poll() (Zweierpotenz, hoechstens 8)
+#define MYDCF77_EDGE_BUFFER     8
+// Kuerzere Pulse (und kuerzere Aussetzer im Puls) sind Stoerungen
+#define MYDCF77_PULSE_MIN       40
+// Grenze zwischen 0 (100ms) und 1 (200ms)
+#define MYDCF77_PULSE_THRESHOLD 150
+// Laengere Pulse sind Stoerungen
+#define MYDCF77_PULSE_MAX       300
+// Ein Puls, der frueher nach dem letzten kommt, ist eine Stoerung
+#define MYDCF77_PERIOD_MIN      900
+// Kommt der Puls spaeter, fehlte einer: Minutenanfang
+#define MYDCF77_MINUTE_GAP      1500
+#endif
+
+#ifdef MYDCF77_SOFT_DECODER
+// Raster fuer die Phase der Sekunde: 50 Faecher a 20ms
+#define MYDCF77_SOFT_BIN        20
+#define MYDCF77_SOFT_BINS       50
+// Faecher fuer 100ms (Sekundenmarke und Datenbit)
+#define MYDCF77_SOFT_PULSE      5
+// So deutlich muss sich die Sekundenmarke abheben (in Treffern), damit eingerastet ist
+#define MYDCF77_SOFT_LOCK       16
+// Ausgewertet wird eine Sekunde so lange nach ihrem Anfang (nach dem Datenbit)
+#define MYDCF77_SOFT_EVALUATE   250
+// Mindestens so viel mittlere Sicherheit (0..127) pro Bit, sonst wird die Minute verworfen
+#define MYDCF77_SOFT_CONFIDENCE 40
+// Sicherheit der vorhergesagten Minute (eine saubere Sekunde zaehlt 100)
+#define MYDCF77_SOFT_PREDICTION 60
+#endif
+
+// Warum die letzte Minute verworfen wurde (getDecodeErrors())
+#define MYDCF77_ERROR_S      0x01
+#define MYDCF77_ERROR_Z      0x02
+#define MYDCF77_ERROR_P1     0x04
+#define MYDCF77_ERROR_P2     0x08
+#define MYDCF77_ERROR_P3     0x10
+#define MYDCF77_ERROR_RANGE  0x20
+// Kaputte Pulse, falsche Anzahl Bits oder zu unsicher
+#define MYDCF77_ERROR_SIGNAL 0x40
+
 class MyDCF77 {
 public:
     MyDCF77(byte signalPin, byte statusLedPin);
 
     void statusLed(boolean on);
+    void enable(boolean on);
 
     void poll(boolean signalIsInverted);
     boolean newSecond();
+#ifdef MYDCF77_EDGE_INTERRUPT
+    void edgeInterrupt();
+    void edge(boolean active, word time);
+#endif
 
     byte getBitAtPos(byte pos);
     byte getBitPointer();
@@ -41,6 +98,10 @@ public:
     byte getMonth();
     byte getYear();
 
+    boolean isSummerTime();
+    boolean isLeapSecondAnnounced();
+    byte getDecodeErrors();
+
     char* asString();
 
     boolean signal(boolean signalIsInverted);
@@ -49,9 +110,46 @@ private:
     byte _signalPin;
     byte _statusLedPin;
 
+#ifdef MYDCF77_EDGE_INTERRUPT
+    volatile uint8_t* _pinInput;
+    byte _pinMask;
+    volatile word _edgeTimes[MYDCF77_EDGE_BUFFER];
+    volatile byte _edgeLevels;
+    volatile byte _edgeHead;
+    byte _edgeTail;
+
+    boolean _inPulse;
+    word _pulseStart;
+    word _pulseEnd;
+    boolean _bitError;
+    boolean _telegramDecoded;
+#ifdef MYDCF77_SOFT_DECODER
+    boolean _active;
+    unsigned long _activeSince;
+    unsigned long _lastSecondStart;
+    byte _phase;
+    byte _phaseHits[MYDCF77_SOFT_BINS];
+    byte _secondBins[(MYDCF77_SOFT_BINS + 7) / 8];
+    byte _minuteHits[60];
+    byte _slot;
+    byte _nextMinutes;
+    char _soft[MYDCF77_TELEGRAMMLAENGE];
+
+    void sample(boolean active, unsigned long time);
+    void markActive(unsigned long from, unsigned long to);
+    byte countBins(byte from);
+    void evaluateSecond();
+    byte secondPhase();
+    byte minutePhase();
+    void predictMinutes(byte minutes);
+    void repairParity(byte first, byte last);
+    boolean decodeSoft();
+#endif
+#else
     word _highcount;
     word _meanvalues[MYDCF77_MEANCOUNT];
     byte _meanpointer;
+#endif
 
     byte _minutes;
     byte _hours;
@@ -60,13 +158,21 @@ private:
     byte _dayOfWeek;
     byte _month;
     byte _year;
+    boolean _summerTime;
+    boolean _leapSecond;
+    byte _decodeErrors;
 
     char _cDateTime[17];
 
-    byte _bits[MYDCF77_TELEGRAMMLAENGE];
+    // Bit n des Telegramms ist Bit n des Worts (8 statt 59 Bytes).
+    uint64_t _telegram;
     byte _bitsPointer;
 
     boolean decode();
+    byte getBit(byte pos);
+    void setBit(byte pos, boolean value);
+    byte bitsAt(byte first, byte length);
+    byte parity(byte first, byte last);
 
     void clearBits();
 };
@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  2.1
+ * @version  2.5
  * @created  1.3.2011
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.1:  - dayOfMonth nach date umbenannt.
@@ -21,8 +21,19 @@
  * V 2.0:  - DS1307 nach MyRTC umbenannt, weil es jetzt nicht mehr nur um die DS1307 geht.
  *         - Getrennte Logik fuer das Rachtencksignal (SQW) eingefuehrt, danke an Erich M.
  * V 2.1:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 2.2:  - Aging-Offset-Register der DS3231 lesen und schreiben.
+ * V 2.3:  - Zwischengespeicherte Zeit: Sekunden aus dem SQW-Takt (tick(), refresh()), gelesen wird nur beim
+ *           Minutenwechsel. writeTime() schreibt nur geaenderte Register in einem Rutsch. Zaehler fuer I2C-Zugriffe.
+ * V 2.4:  - I2C-Zugriffe in readRegisters()/writeRegisters() zusammengefasst. Mit ENABLE_ASYNC_TWI laeuft das
+ *           Lesen beim Minutenwechsel im Hintergrund (refresh() stoesst an, poll() holt ab).
+ * V 2.5:  - Jahr beim Zuruecksetzen zweistellig (14 statt 2014).
  */
+#include "Configuration.h"
+#ifdef ENABLE_ASYNC_TWI
+#include "AsyncTwi.h"
+#else
 #include <Wire.h> // Wire library fuer I2C
+#endif
 #include "MyRTC.h"
 
 // #define DEBUG
@@ -34,6 +45,16 @@
 MyRTC::MyRTC(int address, byte statusLedPin) {
     _address = address;
     _statusLedPin = statusLedPin;
+    _ticks = 0;
+    _valid = false;
+    _dirty = 0;
+    _transactionsLastHour = 0;
+    _transactionsThisHour = 0;
+    _transactions = 0;
+#ifdef ENABLE_ASYNC_TWI
+    _reading = false;
+    _failures = 0;
+#endif
     pinMode(_statusLedPin, OUTPUT);
     digitalWrite(_statusLedPin, LOW);
 }
@@ -50,48 +71,111 @@ void MyRTC::statusLed(boolean on) {
 }
 
 /**
- * Die Uhrzeit auslesen und in den Variablen ablegen
+ * Aus dem Interrupt des SQW-Signals aufrufen: eine Sekunde ist vergangen.
  */
-void MyRTC::readTime() {
-    byte returnStatus, count, result, retries = 0;
-    do {
-        // Reset the register pointer
-        Wire.beginTransmission(_address);
-        Wire.write((uint8_t) 0x00);
-        result = Wire.endTransmission(false); // false, damit der Bus nicht freigegeben wird und eventuell andere dazwischen kommen (in Multi-MCU-Umgebungen)
-        DEBUG_PRINT(F("Wire.endTransmission(false) = "));
-        DEBUG_PRINTLN(result);
-
-        count = Wire.requestFrom(_address, 7);
-        DEBUG_PRINT(F("Wire.requestFrom(_address, 7) = "));
-        DEBUG_PRINTLN(count);
-        DEBUG_FLUSH();
-
-        if (count == 7) {
-            // Success
-            // A few of these need masks because certain bits are control bits
-            _seconds = bcdToDec(Wire.read() & 0x7f);
-            _minutes = bcdToDec(Wire.read());
-            _hours = bcdToDec(Wire.read() & 0x3f); // Need to change this if 12 hour am/pm
-            _dayOfWeek = bcdToDec(Wire.read());
-            _date = bcdToDec(Wire.read());
-            _month = bcdToDec(Wire.read());
-            _year = bcdToDec(Wire.read());
-        } else {
-            // Fail
-            // keine 7 Byte zurueck gekommen? Buffer verwerfen...
-            for (int i = 0; i < count; i++) {
-                Wire.read();
-            }
-            retries++;
+void MyRTC::tick() {
+    _ticks++;
+}
+
+/**
+ * Die zwischengespeicherte Zeit um die Takte seit dem letzten Aufruf
+ * weiterzaehlen. Nur beim Minutenwechsel (oder wenn noch nichts gelesen
+ * wurde) wird die RTC wirklich gelesen, dann stimmen Minuten, Stunden
+ * und Datum ohne eigene Rechnung.
+ * Mit ENABLE_ASYNC_TWI wird das Lesen nur angestossen, bis poll() es
+ * abholt, bleiben die Sekunden auf 59 stehen.
+ */
+void MyRTC::refresh() {
+    noInterrupts();
+    byte ticks = _ticks;
+    _ticks = 0;
+    interrupts();
+    _seconds += ticks;
+    if (!_valid || (_seconds > 59)) {
+#ifdef ENABLE_ASYNC_TWI
+        if (!_reading) {
+            countTransaction();
+            twi.startRead(_address, 0x00, 7);
+            _reading = true;
+        }
+        if (_seconds > 59) {
+            _seconds = 59;
         }
+#else
+        readTime();
+#endif
+    }
+}
 
-        result = Wire.endTransmission(true); // true, jetzt den Bus freigeben.
-        DEBUG_PRINT(F("Wire.endTransmission(true) = "));
-        DEBUG_PRINTLN(result);
-    } while ((count != 7) && (retries < 8));
+/**
+ * Ein von refresh() angestossenes Lesen abholen. Jedes Mal in loop()
+ * aufrufen.
+ *
+ * @return TRUE, wenn eine neue Zeit gelesen wurde.
+ */
+boolean MyRTC::poll() {
+#ifdef ENABLE_ASYNC_TWI
+    if (!_reading || twi.isBusy()) {
+        return false;
+    }
+    _reading = false;
+    byte data[7];
+    if (twi.getData(data, 7)) {
+        _failures = 0;
+        timeRead(data);
+        return true;
+    }
+    // beim naechsten refresh() wieder versuchen, nach 8 Fehlern aufgeben
+    _failures++;
+    if (_failures < 8) {
+        _valid = false;
+        return false;
+    }
+    _failures = 0;
+    timeRead(NULL);
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Die Uhrzeit auslesen und in den Variablen ablegen
+ */
+void MyRTC::readTime() {
+    byte data[7];
+    byte retries = 0;
+    while (!readRegisters(0x00, data, 7) && (retries < 8)) {
+        retries++;
+    }
+    timeRead((retries < 8) ? data : NULL);
+}
 
-    if (retries == 8) {
+/**
+ * Die gelesenen Register 0 bis 6 uebernehmen (NULL = es konnte nichts
+ * gelesen werden).
+ */
+void MyRTC::timeRead(const byte* data) {
+    byte lastHours = _hours;
+    _valid = (data != NULL);
+    if (_valid) {
+        // A few of these need masks because certain bits are control bits
+        if (data[0] & 0x80) {
+            // Clock-Halt-Bit der DS1307: beim naechsten writeTime() loeschen
+            _dirty |= _BV(0);
+        }
+        _seconds = bcdToDec(data[0] & 0x7f);
+        _minutes = bcdToDec(data[1]);
+        _hours = bcdToDec(data[2] & 0x3f); // Need to change this if 12 hour am/pm
+        _dayOfWeek = bcdToDec(data[3]);
+        _date = bcdToDec(data[4]);
+        _month = bcdToDec(data[5]);
+        _year = bcdToDec(data[6]);
+        if (_hours != lastHours) {
+            _transactionsLastHour = _transactionsThisHour;
+            _transactionsThisHour = 0;
+        }
+    } else {
         // Es konnte nichts gelesen werden
         _seconds = 11;
         _minutes = 11;
@@ -99,7 +183,7 @@ void MyRTC::readTime() {
         _dayOfWeek = 1;
         _date = 1;
         _month = 1;
-        _year = 2014;
+        _year = 14;
     }
 
     DEBUG_PRINT(F("Time: "));
@@ -112,41 +196,186 @@ void MyRTC::readTime() {
 }
 
 /**
- * Die Uhrzeit aus den Variablen in die DS1307 schreiben
+ * Die geaenderten Register (vom ersten bis zum letzten geaenderten) in einem
+ * Rutsch in die RTC schreiben. Achtung: Das Schreiben der Sekunden setzt den
+ * Teiler der RTC zurueck.
  */
 void MyRTC::writeTime() {
-    Wire.beginTransmission(_address);
-    Wire.write((uint8_t) 0x00); // 0 to bit 7 starts the clock
-    Wire.write(decToBcd(_seconds));
-    Wire.write(decToBcd(_minutes));
-    Wire.write(decToBcd(_hours)); // If you want 12 hour am/pm you need to set
-    // bit 6 (also need to change readDateDs1307)
-    Wire.write(decToBcd(_dayOfWeek));
-    Wire.write(decToBcd(_date));
-    Wire.write(decToBcd(_month));
-    Wire.write(decToBcd(_year));
-    // Wire.write(0b00010000); // 1Hz Rechteck auf SQW fuer den Display-Update-Interrupt...
-    Wire.endTransmission();
+    if (_dirty == 0) {
+        return;
+    }
+    byte first = 0;
+    while (!(_dirty & _BV(first))) {
+        first++;
+    }
+    byte last = 6;
+    while (!(_dirty & _BV(last))) {
+        last--;
+    }
+    byte data[7];
+    for (byte reg = first; reg <= last; reg++) {
+        // 24-Stunden-Modus, Bit 6 der Stunden bleibt 0; 0 in Bit 7 der Sekunden startet die Uhr
+        data[reg - first] = decToBcd(getRegister(reg));
+    }
+    writeRegisters(first, data, last - first + 1);
+    _dirty = 0;
+    _valid = true;
+}
+
+/**
+ * Der zwischengespeicherte Wert eines Zeit-Registers (0 = Sekunden ... 6 = Jahr).
+ */
+byte MyRTC::getRegister(byte reg) {
+    switch (reg) {
+        case 0:
+            return _seconds;
+        case 1:
+            return _minutes;
+        case 2:
+            return _hours;
+        case 3:
+            return _dayOfWeek;
+        case 4:
+            return _date;
+        case 5:
+            return _month;
+        default:
+            return _year;
+    }
 }
 
 /**
  * SQW fuer DS1307.
  */
 void MyRTC::enableSQWOnDS1307() {
-    Wire.beginTransmission(_address);
-    Wire.write(0x07); // Datenregister
-    Wire.write(0b00010000); // enable 1HZ square wave output
-    Wire.endTransmission();
+    byte control = 0b00010000; // enable 1HZ square wave output
+    writeRegisters(0x07, &control, 1);
 }
 
 /**
  * SQW fuer DS3231.
  */
 void MyRTC::enableSQWOnDS3231() {
+    byte control = 0b0000000; // enable 1HZ square wave output
+    writeRegisters(0x0E, &control, 1);
+}
+
+/**
+ * Das Aging-Offset-Register der DS3231 lesen (1 LSB ca. 0.1 ppm,
+ * positiv = langsamer).
+ */
+char MyRTC::readAgingOffset() {
+    byte offset;
+    if (!readRegisters(0x10, &offset, 1)) {
+        return 0;
+    }
+    return offset;
+}
+
+/**
+ * Das Aging-Offset-Register der DS3231 schreiben. Es wirkt ab der naechsten
+ * Temperaturmessung (spaetestens nach 64 Sekunden).
+ */
+void MyRTC::writeAgingOffset(char offset) {
+    byte data = offset;
+    writeRegisters(0x10, &data, 1);
+}
+
+/**
+ * count Register ab reg lesen (blockierend).
+ *
+ * @return FALSE, wenn nicht alle Bytes kamen.
+ */
+boolean MyRTC::readRegisters(byte reg, byte* data, byte count) {
+    countTransaction();
+#ifdef ENABLE_ASYNC_TWI
+    // ein laufendes Lesen von refresh() wird damit hinfaellig
+    _reading = false;
+    twi.startRead(_address, reg, count);
+    while (twi.isBusy());
+    return twi.getData(data, count);
+#else
+    // Reset the register pointer
     Wire.beginTransmission(_address);
-    Wire.write(0x0E); // Datenregister
-    Wire.write(0b0000000); // enable 1HZ square wave output
+    Wire.write(reg);
+    byte result = Wire.endTransmission(false); // false, damit der Bus nicht freigegeben wird und eventuell andere dazwischen kommen (in Multi-MCU-Umgebungen)
+    DEBUG_PRINT(F("Wire.endTransmission(false) = "));
+    DEBUG_PRINTLN(result);
+    (void) result; // ohne DEBUG nicht gebraucht
+
+    byte received = Wire.requestFrom(_address, (int) count);
+    DEBUG_PRINT(F("Wire.requestFrom(_address, count) = "));
+    DEBUG_PRINTLN(received);
+    DEBUG_FLUSH();
+
+    for (byte i = 0; i < received; i++) {
+        // zu wenig Bytes zurueck gekommen? Buffer trotzdem leeren...
+        byte value = Wire.read();
+        if (i < count) {
+            data[i] = value;
+        }
+    }
+
+    result = Wire.endTransmission(true); // true, jetzt den Bus freigeben.
+    DEBUG_PRINT(F("Wire.endTransmission(true) = "));
+    DEBUG_PRINTLN(result);
+    return (received == count);
+#endif
+}
+
+/**
+ * count Register ab reg schreiben. Mit ENABLE_ASYNC_TWI wird nur
+ * angestossen, nicht auf das Ende gewartet.
+ */
+void MyRTC::writeRegisters(byte reg, const byte* data, byte count) {
+    countTransaction();
+#ifdef ENABLE_ASYNC_TWI
+    _reading = false;
+    twi.startWrite(_address, reg, data, count);
+#else
+    Wire.beginTransmission(_address);
+    Wire.write(reg);
+    for (byte i = 0; i < count; i++) {
+        Wire.write(data[i]);
+    }
     Wire.endTransmission();
+#endif
+}
+
+/**
+ * Einen I2C-Zugriff zaehlen.
+ */
+void MyRTC::countTransaction() {
+    _transactions++;
+    if (_transactionsThisHour != 0xFFFF) {
+        _transactionsThisHour++;
+    }
+}
+
+/**
+ * Die I2C-Zugriffe in der letzten vollen Stunde (nach der RTC).
+ */
+word MyRTC::getTransactionsLastHour() {
+    return _transactionsLastHour;
+}
+
+/**
+ * Die I2C-Zugriffe in der laufenden Stunde.
+ */
+word MyRTC::getTransactionsThisHour() {
+    return _transactionsThisHour;
+}
+
+/**
+ * Die Zaehler maschinenlesbar ausgeben: 'I2C,<letzte Stunde>,<diese Stunde>,<gesamt>'.
+ */
+void MyRTC::printCounters() {
+    Serial.print(F("I2C,"));
+    Serial.print(_transactionsLastHour);
+    Serial.print(F(","));
+    Serial.print(_transactionsThisHour);
+    Serial.print(F(","));
+    Serial.println(_transactions);
 }
 
 /**
@@ -220,21 +449,32 @@ void MyRTC::set(const char* date, const char* time) {
     _hours = conv2d(time);
     _minutes = conv2d(time + 3);
     _seconds = conv2d(time + 6);
+    _dirty = 0b01110111; // alles ausser dem Wochentag
 }
 
 //
 // Setter/Getter
 //
 
+/**
+ * Die Sekunden werden immer geschrieben, auch wenn sie gleich sind: Das
+ * setzt den Teiler der RTC zurueck (z.B. beim Stellen nach DCF77).
+ * Die anderen Setter markieren ein Register nur, wenn es sich aendert.
+ */
 void MyRTC::setSeconds(byte seconds) {
     _seconds = seconds;
+    _dirty |= _BV(0);
 }
 
 void MyRTC::setMinutes(byte minutes) {
-    _minutes = minutes;
+    if (!_valid || (_minutes != minutes)) {
+        _minutes = minutes;
+        _dirty |= _BV(1);
+    }
 }
 
 void MyRTC::incMinutes() {
+    _dirty |= _BV(1);
     _minutes++;
     if (_minutes > 59) {
         _minutes = 0;
@@ -242,10 +482,14 @@ void MyRTC::incMinutes() {
 }
 
 void MyRTC::setHours(byte hours) {
-    _hours = hours;
+    if (!_valid || (_hours != hours)) {
+        _hours = hours;
+        _dirty |= _BV(2);
+    }
 }
 
 void MyRTC::incHours() {
+    _dirty |= _BV(2);
     _hours++;
     if (_hours > 23) {
         _hours = 0;
@@ -253,19 +497,31 @@ void MyRTC::incHours() {
 }
 
 void MyRTC::setDayOfWeek(byte dayOfWeek) {
-    _dayOfWeek = dayOfWeek;
+    if (!_valid || (_dayOfWeek != dayOfWeek)) {
+        _dayOfWeek = dayOfWeek;
+        _dirty |= _BV(3);
+    }
 }
 
 void MyRTC::setDate(byte date) {
-    _date = date;
+    if (!_valid || (_date != date)) {
+        _date = date;
+        _dirty |= _BV(4);
+    }
 }
 
 void MyRTC::setMonth(byte month) {
-    _month = month;
+    if (!_valid || (_month != month)) {
+        _month = month;
+        _dirty |= _BV(5);
+    }
 }
 
 void MyRTC::setYear(byte year) {
-    _year = year;
+    if (!_valid || (_year != year)) {
+        _year = year;
+        _dirty |= _BV(6);
+    }
 }
 
 byte MyRTC::getSeconds() {
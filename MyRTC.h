@@ -1,12 +1,17 @@
 /**
  * MyRTC
  * Klasse fuer den Zugriff auf die DS1307/DS3231 Echtzeituhr.
+ * Die Zeit wird zwischengespeichert: tick() zaehlt im Interrupt die Takte des
+ * SQW-Signals, refresh() zaehlt damit die Sekunden weiter und liest die RTC nur,
+ * wenn eine neue Minute anfaengt (jeder I2C-Zugriff haelt das Multiplexen auf).
+ * Mit ENABLE_ASYNC_TWI laeuft dieses Lesen ueber AsyncTwi im Hintergrund,
+ * loop() holt das Ergebnis mit poll() ab.
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  2.1
+ * @version  2.4
  * @created  1.3.2011
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.1:  - dayOfMonth nach date umbenannt.
@@ -21,11 +26,17 @@
  * V 2.0:  - DS1307 nach MyRTC umbenannt, weil es jetzt nicht mehr nur um die DS1307 geht.
  *         - Getrennte Logik fuer das Rachtencksignal (SQW) eingefuehrt, danke an Erich M.
  * V 2.1:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 2.2:  - Aging-Offset-Register der DS3231 lesen und schreiben.
+ * V 2.3:  - Zwischengespeicherte Zeit: Sekunden aus dem SQW-Takt (tick(), refresh()), gelesen wird nur beim
+ *           Minutenwechsel. writeTime() schreibt nur geaenderte Register in einem Rutsch. Zaehler fuer I2C-Zugriffe.
+ * V 2.4:  - I2C-Zugriffe in readRegisters()/writeRegisters() zusammengefasst. Mit ENABLE_ASYNC_TWI laeuft das
+ *           Lesen beim Minutenwechsel im Hintergrund (refresh() stoesst an, poll() holt ab).
  */
 #ifndef MYRTC_H
 #define MYRTC_H
 
 #include "Arduino.h"
+#include "Configuration.h"
 
 class MyRTC {
 public:
@@ -33,12 +44,18 @@ public:
 
     void statusLed(boolean on);
 
+    void tick();
+    void refresh();
+    boolean poll();
     void readTime();
     void writeTime();
 
     void enableSQWOnDS1307();
     void enableSQWOnDS3231();
 
+    char readAgingOffset();
+    void writeAgingOffset(char offset);
+
     void set(const char* date, const char* time);
     void setSeconds(byte seconds);
     void setMinutes(byte minutes);
@@ -60,10 +77,27 @@ public:
     byte getMonth();
     byte getYear();
 
+    word getTransactionsLastHour();
+    word getTransactionsThisHour();
+    void printCounters();
+
 private:
     int _address;
     byte _statusLedPin;
 
+    volatile byte _ticks;
+    boolean _valid;
+    // Register 0 bis 6, die seit dem letzten writeTime() geaendert wurden
+    byte _dirty;
+    word _transactionsLastHour;
+    word _transactionsThisHour;
+    unsigned long _transactions;
+#ifdef ENABLE_ASYNC_TWI
+    // refresh() hat ein Lesen angestossen
+    boolean _reading;
+    byte _failures;
+#endif
+
     byte _seconds;
     byte _minutes;
     byte _hours;
@@ -72,6 +106,11 @@ private:
     byte _month;
     byte _year;
 
+    void timeRead(const byte* data);
+    byte getRegister(byte reg);
+    boolean readRegisters(byte reg, byte* data, byte count);
+    void writeRegisters(byte reg, const byte* data, byte count);
+    void countTransaction();
     byte decToBcd(byte val);
     byte bcdToDec(byte val);
     uint8_t conv2d(const char* p);
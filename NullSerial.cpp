@@ -0,0 +1,19 @@
+/**
+ * NullSerial
+ * Ersatz fuer Serial, wenn die USART anderweitig belegt ist (siehe NullSerial.h).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "Configuration.h"
+
+#ifdef SHIFTREGISTER_USART_SPI
+
+NullSerial nullSerial;
+
+#endif
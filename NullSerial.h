@@ -0,0 +1,45 @@
+/**
+ * NullSerial
+ * Ersatz fuer Serial, wenn die USART anderweitig belegt ist
+ * (SHIFTREGISTER_USART_SPI). Configuration.h leitet Serial dann hierher
+ * um, alle Ausgaben verschwinden und es kommen keine Eingaben. So kann
+ * weder Serial.begin() noch eine Ausgabe die USART umstellen oder in UDR0
+ * schreiben, waehrend sie die Shift-Register beschreibt.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.1
+ * @created  17.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - nullSerial wird nur noch einmal (NullSerial.cpp) angelegt.
+ */
+#ifndef NULLSERIAL_H
+#define NULLSERIAL_H
+
+#include "Arduino.h"
+
+class NullSerial {
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    void flush() {}
+    long parseInt() { return 0; }
+    void setTimeout(unsigned long) {}
+    size_t write(uint8_t) { return 1; }
+
+    template <class T> size_t print(T) { return 0; }
+    template <class T> size_t print(T, int) { return 0; }
+    size_t println() { return 0; }
+    template <class T> size_t println(T) { return 0; }
+    template <class T> size_t println(T, int) { return 0; }
+};
+
+extern NullSerial nullSerial;
+
+#endif
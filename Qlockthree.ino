@@ -4,9 +4,9 @@
 
    @mc       Arduino/RBBB (ATMEGA328)
    @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
-   @version  3.4.8
+   @version  3.5.0
    @created  1.11.2011
-   @updated  23.11.2015
+   @updated  17.10.2026
 
    Versionshistorie:
    V 1.1:   - DCF77 auf reine Zeit ohne Strings umgestellt.
@@ -163,8 +163,55 @@
             - Library fuer MAX7219 (LedControl) ausgelagert, sie muss jetzt im Librarys-Ordner liegen.
    V 3.4.8. - HelperSeconds-Behandlung in Interrupt-Funktion verschoben, damit die nicht aufgrund von Tastendruecken hochgezaehlt werden, danke an Meikel.
    V 3.4.9. - Rewrite des LedDriverDefault. Mittels C++-Templates, Toggling und Optimierung für Compiler ist die Framerate jetzt 114Hz (statt 60Hz vorher)
+   V 3.5.0. - LedDriverDefault kann per Timer1-Interrupt multiplexen (MULTIPLEX_IN_ISR in Configuration.h), dann bremst die Anzeige loop() nicht mehr aus.
+            - LedDriverBAM: gleiche Hardware wie der Default-Treiber, Helligkeit per Bit-Angle-Modulation in 256 gamma-korrigierten Stufen.
+            - Shift-Register optional ueber Hardware-SPI bzw. USART-SPI (SHIFTREGISTER_SPI, SHIFTREGISTER_USART_SPI in Configuration.h).
+                Mit Hardware-SPI liegt der Lautsprecher an A2, mit USART-SPI entfallen Serial und die SQW-LED.
+            - Graustufen-Bildspeicher (FrameBuffer) und Uebergaenge (Transition) statt des festen Ueberblendens im Treiber (ENABLE_TRANSITIONS in Configuration.h,
+                nur mit LED_DRIVER_BAM).
+            - Laufzeitmessung der heissen Stellen mit dem Kostenmodell des Host-HAL (tests/bench_profile.cpp).
+            - Nur die gewuenschten Sprachen werden gelinkt und sind im Modus 'Sprache' waehlbar (ENABLE_LANGUAGE_XX in Configuration.h).
+            - Der Bildschirm-Puffer geht nur noch an den LED-Treiber, wenn er sich geaendert hat (ChangeDetector). Die Zaehler
+                gibt es mit 'D' ueber Serial.
+            - DCF77-Pulse ueber Zeitstempel der Flanken aus dem Pin-Change-Interrupt statt Zaehlen in loop() (MYDCF77_EDGE_INTERRUPT
+                in Configuration.h).
+            - Optionaler DCF77-Soft-Decoder: Phasenregelung auf die Sekunde, Minutenmarke per Korrelation, Sicherheit pro Bit ueber
+                mehrere Minuten (MYDCF77_SOFT_DECODER in Configuration.h).
+            - DCF77-Empfangsstatistik: Pulslaengen, Fehlergruende, letzte Synchronisation und Tastgrad mit 'T' ueber Serial und
+                als Balken im Modus 'DCF77-Statistik' (ENABLE_DCF77_TELEMETRY in Configuration.h).
+            - DCF77-Empfaenger nur an, wenn nach der gemessenen Drift der RTC eine Synchronisation faellig ist, bevorzugt
+                nachts (ENABLE_DCF77_SCHEDULER in Configuration.h). Solange er schlaeft, ist auch sein Pin-Change-Interrupt aus.
+            - Drift der RTC bei jeder DCF77-Synchronisation messen und ausgleichen (DS3231: Aging-Offset, DS1307: in Software),
+                die Korrektur liegt im EEPROM (ENABLE_RTC_DRIFT in Configuration.h).
+            - Die Zeit der RTC wird zwischengespeichert und ueber das SQW-Signal weitergezaehlt, gelesen wird nur beim Minutenwechsel,
+                geschrieben nur die geaenderten Register. Die I2C-Zugriffe pro Stunde gibt es mit 'I' ueber Serial.
+            - Optional eigener I2C-Treiber (AsyncTwi) statt Wire: das Lesen der RTC beim Minutenwechsel laeuft im TWI-Interrupt,
+                loop() wartet nicht mehr auf den Bus (ENABLE_ASYNC_TWI in Configuration.h).
+            - Kalender in TimeStamp (Schaltjahre, Minuten seit 2000, Wochentag, Sommerzeit nach EU- oder US-Regel), damit
+                stellt die Uhr die Sommerzeit auch ohne DCF77 um (ENABLE_OFFLINE_DST in Configuration.h).
+            - Einstellungen im EEPROM als Log ueber 62 Seiten mit Laufnummer und CRC (EepromLog): verteilt das Schreiben,
+                uebersteht Stromausfaelle beim Speichern, alte Einstellungen werden uebernommen.
+            - Einstellungen werden gesammelt 3 Sekunden nach der letzten Aenderung (oder beim Verlassen der erweiterten
+                Modi) gespeichert, ein Byte pro Durchlauf von loop(). Die Schreibzugriffe gibt es mit 'E' ueber Serial.
+            - Weckzeit, Nachtzeiten und Farbe werden in den Einstellungen gespeichert und ueberstehen einen Stromausfall.
+                Die Nachtzeiten lassen sich mit 'N hhmm hhmm' (aus, an) ueber Serial stellen, 'N' allein gibt sie aus.
+            - DCF77-Telegramm als gepacktes 64-Bit-Wort mit Tabellen fuer Felder und Paritaeten, unsinnige Felder (z.B. Minute 65)
+                werden verworfen.
+            - DCF77Helper: Abstaende der Samples ueber Minuten seit 2000 (auch ueber Mitternacht und mit Datum), fester Ring
+                statt TimeStamps auf dem Heap.
+            - loop() als kooperativer Scheduler: Refresh bei jedem Durchlauf, danach reihum hoechstens eine faellige Aufgabe
+                (Tasten, Fernbedienung, LDR, Anzeige, ...) in ihrem eigenen Takt, Tasten, Fernbedienung, LDR und DCF77-Minute
+                als Ereignisse. Die groesste Luecke zwischen zwei Refreshs gibt es mit 'L' ueber Serial. Einen geaenderten
+                Bildschirmpuffer gibt der naechste Refresh an den Treiber, nicht die Aufgabe selbst.
+            - Die Modi als Tabelle im PROGMEM (Modes.h/.cpp, ModeMachine): Folgemodus, Ueberspringen, Betreten/Verlassen, Rendern
+                und Tasten pro Modus. Die Einstell-Modi kehren nach EXT_MODE_TIMEOUT Sekunden ohne Taste zur Zeit zurueck.
+            - Die Firmware laeuft mit dem Host-HAL (host/) auch unter Linux: virtuelle Zeit, Register, Timer, Pins, I2C,
+                EEPROM und eine DS1307. CMakeLists.txt baut sie dort, die Tests liegen in tests/.
 */
+#include "Configuration.h"
+#ifndef ENABLE_ASYNC_TWI
 #include <Wire.h> // Wire library fuer I2C
+#endif
 #include <avr/pgmspace.h>
 #include <avr/wdt.h>
 #include <EEPROM.h>
@@ -173,9 +220,9 @@
 #include <Adafruit_NeoPixel.h>
 #include <Adafruit_DotStar.h>
 #include <LPD8806.h>
-#include "Configuration.h"
 #include "LedDriver.h"
 #include "LedDriverDefault.h"
+#include "LedDriverBAM.h"
 #include "IRTranslator.h"
 #include "IRTranslatorSparkfun.h"
 #include "IRTranslatorMooncandles.h"
@@ -187,13 +234,26 @@
 #include "AnalogButton.h"
 #include "LDR.h"
 #include "DCF77Helper.h"
+#include "TimeStamp.h"
 #include "Renderer.h"
 #include "Staben.h"
 #include "Alarm.h"
 #include "Settings.h"
 #include "Zahlen.h"
-
-#define FIRMWARE_VERSION "V 3.4.9 vom 23.11.2015"
+#include "FrameBuffer.h"
+#include "Transition.h"
+#include "ChangeDetector.h"
+#include "DCF77Telemetry.h"
+#include "DCF77Scheduler.h"
+#include "RtcDrift.h"
+#include "AsyncTwi.h"
+#include "EepromLog.h"
+#include "EventQueue.h"
+#include "Scheduler.h"
+#include "ModeMachine.h"
+#include "Modes.h"
+
+#define FIRMWARE_VERSION "V 3.5.0 vom 17.10.2026"
 
 /*
    Den DEBUG-Schalter gibt es in allen Bibiliotheken. Wird er eingeschaltet, werden ueber den
@@ -207,6 +267,11 @@
 // da auch ohne DEBUG Meldungen ausgegeben werden!
 #define SERIAL_SPEED 115200
 
+/*
+   Das Log im EEPROM fuer die Einstellungen (und die Korrektur der RTC).
+*/
+EepromLog eepromLog;
+
 /*
    Die persistenten (im EEPROM gespeicherten) Einstellungen.
 */
@@ -219,11 +284,13 @@ Settings settings;
    Sind alle Werte auf 0 wird das Display nie abgeschaltet. Nach einer Minute kann man das
    Display manuell wieder ein- / ausschalten.
    Achtung! Wenn sich die Uhr nachmittags abschaltet ist sie in der falschen Tageshaelfte!
+   Die Zeiten liegen in den Einstellungen (EEPROM) und werden in setup() gesetzt, die
+   Defaults (3 Uhr aus, 4:30 Uhr an) stehen in Settings.h.
 */
-// um 3 Uhr Display abschalten (Minuten, Stunden, -, -, -, -)
-TimeStamp offTime(0, 3, 0, 0, 0, 0);
-// um 4:30 Uhr Display wieder anschalten (Minuten, Stunden, -, -, -, -)
-TimeStamp onTime(30, 4, 0, 0, 0, 0);
+// Display abschalten (Minuten, Stunden, -, -, -, -)
+TimeStamp offTime(0, 0, 0, 0, 0, 0);
+// Display wieder anschalten (Minuten, Stunden, -, -, -, -)
+TimeStamp onTime(0, 0, 0, 0, 0, 0);
 
 /**
    Der Renderer, der die Woerter auf die Matrix ausgibt.
@@ -237,13 +304,44 @@ Renderer renderer;
 
    Data: 10; Clock: 12; Latch: 11; OutputEnable: 3
    LinesToWrite: 10
+
+   Mit SHIFTREGISTER_SPI muessen Data und Clock an MOSI/SCK, der
+   Lautsprecher an A2:
+   Data: 11; Clock: 13; Latch: 10; OutputEnable: 3
+   Mit SHIFTREGISTER_USART_SPI an TXD/XCK, ohne SQW-LED und Serial:
+   Data: 1; Clock: 4; Latch: 11; OutputEnable: 3
 */
 #ifdef LED_DRIVER_DEFAULT
+#if defined(SHIFTREGISTER_SPI)
+LedDriverDefault <
+  DPIN(37, 35, 36, 3),
+  DPIN(37, 35, 36, 5),
+  DPIN(37, 35, 36, 2),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+#elif defined(SHIFTREGISTER_USART_SPI)
+LedDriverDefault <
+  DPIN(43, 41, 42, 1),
+  DPIN(43, 41, 42, 4),
+  DPIN(37, 35, 36, 3),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+#else
 LedDriverDefault <
   DPIN(37, 35, 36, 2),
   DPIN(37, 35, 36, 4),
   DPIN(37, 35, 36, 3),
   DPIN(43, 41, 42, 3), 10 > ledDriver;
+#endif
+
+#ifdef MULTIPLEX_IN_ISR
+// Naechste Zeile (bzw. Ueberblend-Phase) ausgeben...
+ISR(TIMER1_COMPA_vect) {
+  ledDriver.multiplexNextPhase();
+}
+// ... und nach der Anzeit wieder ausschalten.
+ISR(TIMER1_COMPB_vect) {
+  ledDriver.multiplexOutputOff();
+}
+#endif
 
 #define PIN_MODE 7
 #define PIN_M_PLUS 5
@@ -262,11 +360,84 @@ LedDriverDefault <
 
 #define PIN_DCF77_PON A0
 
+#ifdef SHIFTREGISTER_USART_SPI
+// D4 ist XCK
+#define PIN_SQW_LED -1
+#else
+#define PIN_SQW_LED 4
+#endif
+#define PIN_DCF77_LED 8
+
+#ifdef SHIFTREGISTER_SPI
+// D13 ist SCK
+#define PIN_SPEAKER A2
+#else
+#define PIN_SPEAKER 13
+#endif
+#endif
+
+/**
+   Der LED-Treiber fuer 74HC595-Shift-Register mit Bit-Angle-Modulation.
+   Gleiche Verkabelung wie LED_DRIVER_DEFAULT (auch mit SHIFTREGISTER_SPI
+   bzw. SHIFTREGISTER_USART_SPI), belegt aber Timer1.
+
+   Data: 10; Clock: 12; Latch: 11; OutputEnable: 3
+   LinesToWrite: 10
+*/
+#ifdef LED_DRIVER_BAM
+#if defined(SHIFTREGISTER_SPI)
+LedDriverBAM <
+  DPIN(37, 35, 36, 3),
+  DPIN(37, 35, 36, 5),
+  DPIN(37, 35, 36, 2),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+#elif defined(SHIFTREGISTER_USART_SPI)
+LedDriverBAM <
+  DPIN(43, 41, 42, 1),
+  DPIN(43, 41, 42, 4),
+  DPIN(37, 35, 36, 3),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+#else
+LedDriverBAM <
+  DPIN(37, 35, 36, 2),
+  DPIN(37, 35, 36, 4),
+  DPIN(37, 35, 36, 3),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+#endif
+
+ISR(TIMER1_COMPA_vect) {
+  ledDriver.bamNextPlane();
+}
+
+#define PIN_MODE 7
+#define PIN_M_PLUS 5
+#define PIN_H_PLUS 6
+
+#define BUTTONS_PRESSING_AGAINST HIGH
+
+#define PIN_IR_RECEIVER A1
+
+#define PIN_LDR A3
+#define IS_INVERTED true
+
+#define PIN_SQW_SIGNAL 2
+#define PIN_DCF77_SIGNAL 9
+
+#define PIN_DCF77_PON A0
+
+#ifdef SHIFTREGISTER_USART_SPI
+#define PIN_SQW_LED -1
+#else
 #define PIN_SQW_LED 4
+#endif
 #define PIN_DCF77_LED 8
 
+#ifdef SHIFTREGISTER_SPI
+#define PIN_SPEAKER A2
+#else
 #define PIN_SPEAKER 13
 #endif
+#endif
 
 /**
    Der LED-Treiber fuer 4 MAX7219-Treiber wie im Ueberpixel.
@@ -436,12 +607,31 @@ IRTranslatorLunartec irTranslator;
    Die Real-Time-Clock mit der Status-LED fuer das SQW-Signal.
 */
 MyRTC rtc(0x68, PIN_SQW_LED);
-volatile byte helperSeconds;
+#ifdef ENABLE_ASYNC_TWI
+// Der I2C-Bus ohne Warten, ersetzt die Wire-Library.
+AsyncTwi twi;
+ISR(TWI_vect) {
+  twi.interrupt();
+}
+#endif
 
 /**
    Der Funkempfaenger (DCF77-Signal der PTB Braunschweig).
 */
 MyDCF77 dcf77(PIN_DCF77_SIGNAL, PIN_DCF77_LED);
+#ifdef MYDCF77_EDGE_INTERRUPT
+// Die Flanken des DCF77-Signals, der Vektor haengt am Port des Pins.
+#if (PIN_DCF77_SIGNAL >= 8) && (PIN_DCF77_SIGNAL <= 13)
+ISR(PCINT0_vect) {
+#elif (PIN_DCF77_SIGNAL <= 7)
+ISR(PCINT2_vect) {
+#else
+ISR(PCINT1_vect) {
+#endif
+  dcf77.edgeInterrupt();
+}
+#endif
+
 DCF77Helper dcf77Helper;
 
 /**
@@ -453,7 +643,6 @@ Alarm alarm(PIN_SPEAKER);
    Der Helligkeitssensor
 */
 LDR ldr(PIN_LDR, IS_INVERTED);
-unsigned long lastBrightnessCheck;
 
 /**
    Die Helligkeit zum Anzeigen mit den Balken.
@@ -469,36 +658,9 @@ Button extModeDoubleButton(PIN_M_PLUS, PIN_H_PLUS, BUTTONS_PRESSING_AGAINST);
 Button modeChangeButton(PIN_MODE, BUTTONS_PRESSING_AGAINST);
 
 /**
-   Die Standard-Modi.
-*/
-#define STD_MODE_NORMAL     0
-#define STD_MODE_ALARM      1
-#define STD_MODE_SECONDS    2
-#define STD_MODE_BRIGHTNESS 3
-#define STD_MODE_BLANK      4
-#define STD_MODE_COUNT      4
-// nicht manuell zu erreichender Modus...
-#define STD_MODE_NIGHT      7
-
-/**
-   Die erweiterten Modi.
+   Die Modi (Modes.h) als Zustandsautomat.
 */
-#define EXT_MODE_START           10
-#define EXT_MODE_LDR_MODE        10
-#define EXT_MODE_CORNERS         11
-#define EXT_MODE_ENABLE_ALARM    12
-#define EXT_MODE_DCF_IS_INVERTED 13
-#define EXT_MODE_LANGUAGE        14
-#define EXT_MODE_TIMESET         15
-#define EXT_MODE_TIME_SHIFT      16
-#define EXT_MODE_TEST            17
-#define EXT_MODE_DCF_DEBUG       18
-#define EXT_MODE_COUNT           18
-
-// Startmode...
-byte mode = STD_MODE_NORMAL;
-// Merker fuer den Modus vor der Abschaltung...
-byte lastMode = mode;
+ModeMachine modes(modeTable, MODE_COUNT);
 
 // Ueber die Wire-Library festgelegt:
 // Arduino analog input 4 = I2C SDA
@@ -506,10 +668,24 @@ byte lastMode = mode;
 
 // Die Matrix, eine Art Bildschirmspeicher
 word matrix[16];
+// Der Bildschirmpuffer hat sich geaendert, der naechste Refresh gibt ihn an den Treiber.
+boolean matrixChanged = false;
 
 // Hilfsvariable, da I2C und Interrupts nicht zusammenspielen
 volatile boolean needsUpdateFromRtc = true;
 
+// Nur geaenderte Bildschirm-Puffer gehen an den LED-Treiber
+ChangeDetector changeDetector;
+
+#ifdef ENABLE_TRANSITIONS
+// Der Bildspeicher mit Helligkeit pro LED, in den die Uebergaenge rendern
+FrameBuffer frameBuffer;
+Transition transition;
+// Der Modus, dessen Anzeige zuletzt gerendert wurde
+byte renderedMode = STD_MODE_NORMAL;
+unsigned long lastTransitionStep = 0;
+#endif
+
 // Fuer den Bildschirm-Test
 byte x, y;
 
@@ -517,6 +693,58 @@ byte x, y;
 word frames = 0;
 unsigned long lastFpsCheck = 0;
 
+#ifdef ENABLE_DCF77_TELEMETRY
+// Empfangsstatistik
+DCF77Telemetry dcf77Telemetry;
+#endif
+
+#ifdef ENABLE_DCF77_SCHEDULER
+// Wann der DCF77-Empfaenger laufen muss
+DCF77Scheduler dcf77Scheduler;
+#endif
+// Laeuft der DCF77-Empfaenger?
+boolean dcfEnabled = false;
+
+#ifdef ENABLE_RTC_DRIFT
+// Ausgleich der Drift der RTC
+RtcDrift rtcDrift;
+#endif
+
+#ifdef ENABLE_OFFLINE_DST
+// Steckt in der Zeit der RTC gerade die Sommerzeit?
+boolean summerTime = false;
+void manageSummerTime();
+#endif
+
+// Die Zeile des Befehls 'N' wird ohne Warten gesammelt, bis das Zeilenende
+// kommt (oder eine Sekunde lang nichts mehr).
+#define SERIAL_LINE_TIMEOUT 1000
+char serialLine[16];
+byte serialLineLength = 0;
+boolean serialLineActive = false;
+unsigned long serialLineStart = 0;
+void nightCommand(const char* line);
+
+// Die Aufgaben fuer den Scheduler und die Ereignisse zwischen ihnen
+Scheduler scheduler;
+EventQueue events;
+
+void taskRefresh();
+void taskSerial();
+void taskStorage();
+void taskLdr();
+void taskUpdate();
+#ifdef ENABLE_TRANSITIONS
+void taskTransition();
+#endif
+void taskButtons();
+#ifndef REMOTE_NO_REMOTE
+void taskIr();
+#endif
+void taskEvents();
+void taskClock();
+void taskStatusLeds();
+
 void enableDcf(boolean enable);
 void manageNewDCF77Data();
 void doubleExtModePressed();
@@ -528,6 +756,9 @@ void setDisplayBrighter();
 void setDisplayToResume();
 void setDisplayToBlank();
 void setDisplayToToggle();
+#ifdef ENABLE_TRANSITIONS
+byte transitionForMode();
+#endif
 
 /**
    Aenderung der Anzeige als Funktion fuer den Interrupt, der ueber das SQW-Signal
@@ -537,13 +768,10 @@ void setDisplayToToggle();
 */
 void updateFromRtc() {
   needsUpdateFromRtc = true;
-  // die Zeit verursacht ein kurzes Flackern. Wir muessen
-  // sie aber nicht immer lesen, im Modus 'normal' alle 60 Sekunden,
-  // im Modus 'seconds' alle Sekunde, sonst garnicht.
-  helperSeconds++;
-  if (helperSeconds >= 60) {
-    helperSeconds = 0;
-  }
+  // das Lesen der Zeit verursacht ein kurzes Flackern. Deshalb zaehlt
+  // die RTC-Klasse die Sekunden selbst weiter und liest nur beim
+  // Minutenwechsel.
+  rtc.tick();
 }
 
 /**
@@ -551,9 +779,14 @@ void updateFromRtc() {
    Kopiert von: http://playground.arduino.cc/Code/AvailableMemory
 */
 int freeRam() {
+#ifdef __AVR__
   extern int __heap_start, *__brkval;
   int v;
   return (int) &v - (__brkval == 0 ? (int) &__heap_start : (int) __brkval);
+#else
+  // Auf dem Host (host/) gibt es keinen Stack im RAM des Arduino.
+  return 0;
+#endif
 }
 
 /**
@@ -569,14 +802,20 @@ void setup() {
   pinMode(PIN_DCF77_PON, OUTPUT);
   enableDcf(false);
 
+  // Weckzeit und Nachtzeiten aus den Einstellungen (schon beim Konstruieren geladen)...
+  alarm.getAlarmTime()->set(settings.getAlarmTime() % 60, settings.getAlarmTime() / 60, 0, 0, 0, 0);
+  offTime.set(settings.getNightOff() % 60, settings.getNightOff() / 60, 0, 0, 0, 0);
+  onTime.set(settings.getNightOn() % 60, settings.getNightOn() / 60, 0, 0, 0, 0);
+
   if (settings.getEnableAlarm()) {
     // als Wecker Display nicht abschalten...
-    TimeStamp offTime(0, 0, 0, 0, 0, 0);
-    TimeStamp onTime(0, 0, 0, 0, 0, 0);
+    offTime.set(0, 0, 0, 0, 0, 0);
+    onTime.set(0, 0, 0, 0, 0, 0);
   }
 
   // LED-Treiber initialisieren
   ledDriver.init();
+  ledDriver.setColor(settings.getRed(), settings.getGreen(), settings.getBlue());
   // Inhalt des Led-Treibers loeschen...
   ledDriver.clearData();
   // und Inhalt des Bildspeichers loeschen
@@ -585,7 +824,11 @@ void setup() {
   ledDriver.setLinesToWrite(10);
 
   // starte Wire-Library als I2C-Bus Master
+#ifdef ENABLE_ASYNC_TWI
+  twi.begin();
+#else
   Wire.begin();
+#endif
 
   // RTC-Interrupt-Pin konfigurieren
   pinMode(PIN_SQW_SIGNAL, INPUT);
@@ -643,7 +886,15 @@ void setup() {
 #endif
 
   rtc.writeTime();
-  helperSeconds = rtc.getSeconds();
+#ifdef ENABLE_RTC_DRIFT
+  rtcDrift.begin(rtc);
+  Serial.print(F("RTC-Korrektur (0.1 ppm): "));
+  Serial.println(rtcDrift.getCorrection());
+#endif
+#ifdef ENABLE_OFFLINE_DST
+  // Geraten: die RTC zeigt die Zeit, die gerade gilt (nur in der doppelten Stunde im Herbst falsch).
+  summerTime = TimeStamp::isSummerTime(OFFLINE_DST_RULE, TimeStamp::minutesSince2000(rtc.getMinutes(), rtc.getHours(), rtc.getDate(), rtc.getMonth(), rtc.getYear()), rtc.getYear(), OFFLINE_DST_UTC_OFFSET);
+#endif
   Serial.print(F("RTC-Time: "));
   Serial.print(rtc.getHours());
   Serial.print(F(":"));
@@ -720,6 +971,23 @@ void setup() {
   // Display einschalten...
   ledDriver.wakeUp();
   ledDriver.setBrightness(settings.getBrightness());
+
+  // Die Aufgaben mit ihrem Takt in Millisekunden (0 = so oft wie moeglich)...
+  scheduler.setRefresh(taskRefresh);
+  scheduler.add(taskUpdate, 0);
+  scheduler.add(taskEvents, 0);
+#ifdef ENABLE_TRANSITIONS
+  scheduler.add(taskTransition, 0);
+#endif
+  scheduler.add(taskButtons, 10);
+#ifndef REMOTE_NO_REMOTE
+  scheduler.add(taskIr, 10);
+#endif
+  scheduler.add(taskLdr, LDR_CHECK_RATE);
+  scheduler.add(taskSerial, 10);
+  scheduler.add(taskStorage, 4);
+  scheduler.add(taskClock, 100);
+  scheduler.add(taskStatusLeds, 20);
 }
 
 // Do a manual reset, i.e. disable watchdog and interrupts, initialize stack pointer to 
@@ -727,6 +995,7 @@ void setup() {
 // checks the reset reason and fast-starts the sketch if it was caused by watchdog.
 void launchBootloader() {
     wdt_disable();
+#ifdef __AVR__
     __asm__ __volatile__ (
       "cli\n"
       "ldi r30, lo8(%[ramend])\n"
@@ -741,22 +1010,92 @@ void launchBootloader() {
       [ramend] "i" (RAMEND),
       [bootloader] "i" (0x7e00 >> 1)
     );
+#endif
 }
 
 /**
-   loop() wird endlos auf alle Ewigkeit vom Microcontroller durchlaufen
+   loop() wird endlos auf alle Ewigkeit vom Microcontroller durchlaufen.
+   Die Arbeit steckt in den Aufgaben unten, der Scheduler ruft bei jedem
+   Durchlauf den Refresh und danach hoechstens eine faellige Aufgabe auf.
 */
 void loop() {
+  scheduler.run();
+}
+
+/**
+   Die Matrix auf die LEDs multiplexen, hier 'Refresh-Zyklen'. Laeuft bei jedem
+   Durchlauf, ebenso das Abtasten des DCF77-Signals (der Decoder zaehlt die
+   Durchlaeufe mit hohem Pegel).
+*/
+void taskRefresh() {
+  //
+  // FPS
+  //
+#ifdef DEBUG
+  frames++;
+  if (lastFpsCheck > millis()) {
+    lastFpsCheck = millis();
+  }
+  if (lastFpsCheck + 1000 < millis()) {
+    DEBUG_PRINT("FPS: ");
+    DEBUG_PRINTLN(frames);
+    lastFpsCheck = millis();
+    frames = 0;
+  }
+#endif
+
+  if (!modes.isDisplayOff()) {
+    ledDriver.writeScreenBufferToMatrix(matrix, matrixChanged);
+    matrixChanged = false;
+  }
+
   //
-  // Reset via serial command
+  // DCF77-Empfaenger anticken...
   //
-  if (Serial.available() > 0)
+  if (dcfEnabled) {
+    dcf77.poll(settings.getDcfSignalIsInverted());
+  }
+}
+
+/**
+   Befehle ueber Serial.
+*/
+void taskSerial() {
+  if (!serialLineActive && (Serial.available() > 0))
   {
     char cmd = Serial.read();
     if (cmd == 'R') // reboot on 'R'
     {
       launchBootloader();
     }
+    if (cmd == 'D') // frame diff counters on 'D'
+    {
+      changeDetector.printCounters();
+    }
+    if (cmd == 'I') // i2c counters on 'I'
+    {
+      rtc.printCounters();
+    }
+    if (cmd == 'E') // eeprom write counters on 'E'
+    {
+      eepromLog.printCounters();
+    }
+    if (cmd == 'L') // scheduler counters and worst refresh gap on 'L'
+    {
+      scheduler.printCounters();
+    }
+    if (cmd == 'N') // night off/on times on 'N hhmm hhmm' (0 0 = never), 'N' alone prints them
+    {
+      serialLineActive = true;
+      serialLineLength = 0;
+      serialLineStart = millis();
+    }
+#ifdef ENABLE_DCF77_TELEMETRY
+    if (cmd == 'T') // dcf77 telemetry on 'T'
+    {
+      dcf77Telemetry.print();
+    }
+#endif
     if (cmd == '0')
     {
       for (int i = 0; i < 100; ++i) // repeat the check for a short peroid
@@ -773,356 +1112,340 @@ void loop() {
     }
   }
 
-  //
-  // FPS
-  //
-#ifdef DEBUG
-  frames++;
-  if (lastFpsCheck > millis()) {
-    lastFpsCheck = millis();
+  // die Zeile nach 'N' sammeln, was schon da ist gleich mit
+  if (serialLineActive)
+  {
+    while (Serial.available() > 0)
+    {
+      char c = Serial.read();
+      if ((c == '\n') || (c == '\r'))
+      {
+        serialLineActive = false;
+        break;
+      }
+      // zu lang: die Zeile ist ungueltig, der Rest wird bis zum Zeilenende verworfen
+      if (serialLineLength < sizeof(serialLine) - 1)
+      {
+        serialLine[serialLineLength] = c;
+      }
+      if (serialLineLength < sizeof(serialLine))
+      {
+        serialLineLength++;
+      }
+    }
+    if (millis() - serialLineStart >= SERIAL_LINE_TIMEOUT)
+    {
+      serialLineActive = false;
+    }
+    if (!serialLineActive)
+    {
+      if (serialLineLength < sizeof(serialLine))
+      {
+        serialLine[serialLineLength] = '\0';
+        nightCommand(serialLine);
+      }
+      else
+      {
+        Serial.println(F("NIGHT,ERROR"));
+      }
+    }
   }
-  if (lastFpsCheck + 1000 < millis()) {
-    DEBUG_PRINT("FPS: ");
-    DEBUG_PRINTLN(frames);
-    lastFpsCheck = millis();
-    frames = 0;
+}
+
+/**
+   Eine Uhrzeit hhmm (eine bis vier Ziffern, davor Leerzeichen) aus der Zeile
+   lesen und dahinter weitermachen.
+
+   @return Minuten seit Mitternacht, -1 wenn keine gueltige Uhrzeit dasteht.
+*/
+int parseNightTime(const char*& line) {
+  while (*line == ' ') {
+    line++;
   }
-#endif
+  int value = 0;
+  byte digits = 0;
+  while ((*line >= '0') && (*line <= '9')) {
+    if (++digits > 4) {
+      return -1;
+    }
+    value = value * 10 + (*line - '0');
+    line++;
+  }
+  if ((digits == 0) || (value / 100 > 23) || (value % 100 > 59)) {
+    return -1;
+  }
+  return (value / 100) * 60 + value % 100;
+}
 
-  //
-  // Dimmung.
-  //
-  if (settings.getUseLdr()) {
-    if (millis() < lastBrightnessCheck) {
-      // wir hatten einen Ueberlauf...
-      lastBrightnessCheck = millis();
+/**
+   Der Rest der Zeile nach 'N': ohne Zeiten nur ausgeben, sonst genau zwei
+   Uhrzeiten (aus, an) uebernehmen. Fehlt eine oder passt eine nicht, bleibt
+   alles beim Alten.
+*/
+void nightCommand(const char* line) {
+  const char* rest = line;
+  while (*rest == ' ') {
+    rest++;
+  }
+  if (*rest != '\0') {
+    int off = parseNightTime(rest);
+    int on = (off >= 0) ? parseNightTime(rest) : -1;
+    while (*rest == ' ') {
+      rest++;
     }
-    if (lastBrightnessCheck + LDR_CHECK_RATE < millis()) { // langsam nachsehen...
-      byte lv = ldr.value();
-      if (ledDriver.getBrightness() > lv) {
-        ledDriver.setBrightness(ledDriver.getBrightness() - 1);
-      }
-      else if (ledDriver.getBrightness() < lv) {
-        ledDriver.setBrightness(ledDriver.getBrightness() + 1);
-      }
-      lastBrightnessCheck = millis();
+    if ((on < 0) || (*rest != '\0')) {
+      Serial.println(F("NIGHT,ERROR"));
+      return;
+    }
+    settings.setNightOff(off);
+    settings.setNightOn(on);
+    // als Wecker bleibt das Display an (wie in setup())
+    if (!settings.getEnableAlarm()) {
+      offTime.set(off % 60, off / 60, 0, 0, 0, 0);
+      onTime.set(on % 60, on / 60, 0, 0, 0, 0);
     }
   }
+  Serial.print(F("NIGHT,"));
+  Serial.print(settings.getNightOff());
+  Serial.print(F(","));
+  Serial.println(settings.getNightOn());
+}
 
-  //
-  // needsUpdateFromRtc wird via Interrupt gesetzt ueber fallende
-  // Flanke des SQW-Signals von der RTC.
-  // Oder falls eine Tasten-Aktion eine sofortige Aktualisierung des Displays braucht.
-  //
+/**
+   Einstellungen gesammelt speichern, ein Byte pro Aufruf.
+*/
+void taskStorage() {
+  settings.poll();
+  eepromLog.poll();
+}
+
+/**
+   Dimmung: meldet, wenn der LDR eine andere Helligkeit will.
+*/
+void taskLdr() {
+  if (settings.getUseLdr()) {
+    byte lv = ldr.value();
+    if (ledDriver.getBrightness() != lv) {
+      events.post(EVENT_LDR, lv);
+    }
+  }
+}
+
+/**
+   Anzeige aktualisieren.
+   needsUpdateFromRtc wird via Interrupt gesetzt ueber fallende
+   Flanke des SQW-Signals von der RTC.
+   Oder falls eine Tasten-Aktion eine sofortige Aktualisierung des Displays braucht.
+   Ist das im Hintergrund angestossene Lesen der RTC fertig (ENABLE_ASYNC_TWI),
+   wird nur neu gerendert, die Arbeit pro Sekunde ist schon getan.
+*/
+void taskUpdate() {
+  boolean needsRender = rtc.poll();
   if (needsUpdateFromRtc) {
     needsUpdateFromRtc = false;
-    if (dcf77.newSecond()) {
-      manageNewDCF77Data();
+    needsRender = true;
+    boolean dcf77Captured = dcf77.newSecond();
+    if (dcf77Captured) {
+      // Auswerten und Stellen der RTC in einer eigenen Aufgabe, nicht vor dem Rendern.
+      events.post(EVENT_DCF77_MINUTE);
     }
 
     //
-    // Zeit einlesen...
+    // Zeit weiterzaehlen (gelesen wird nur beim Minutenwechsel)...
     //
-    switch (mode) {
-      case STD_MODE_NORMAL:
-      case EXT_MODE_TIMESET:
-      case STD_MODE_ALARM:
-        if (alarm.isActive()) {
-          rtc.readTime();
-        }
-        if (helperSeconds == 0) {
-          rtc.readTime();
-          helperSeconds = rtc.getSeconds();
-        }
-        break;
-      case STD_MODE_SECONDS:
-      case STD_MODE_BLANK:
-      case STD_MODE_NIGHT:
-        rtc.readTime();
-        helperSeconds = rtc.getSeconds();
-        break;
-        // andere Modi egal...
+    rtc.refresh();
+#if defined(ENABLE_RTC_DRIFT) && !defined(DS3231)
+    // Software-Korrektur der DS1307 direkt nach dem Takt.
+    rtcDrift.tick(rtc);
+#endif
+#ifdef ENABLE_OFFLINE_DST
+    manageSummerTime();
+#endif
+
+#ifdef ENABLE_DCF77_SCHEDULER
+    // Den DCF77-Empfaenger nur laufen lassen, wenn eine Synchronisation faellig ist.
+    boolean dcfDebug = (modes.getMode() == EXT_MODE_DCF_DEBUG);
+#ifdef EXT_MODE_DCF_STATS
+    dcfDebug |= (modes.getMode() == EXT_MODE_DCF_STATS);
+#endif
+    boolean receive = dcf77Scheduler.update(TimeStamp::minutesSince2000(rtc.getMinutes(), rtc.getHours(), rtc.getDate(), rtc.getMonth(), rtc.getYear()), modes.getMode() == STD_MODE_NIGHT, dcfDebug);
+    if (receive != dcfEnabled) {
+      enableDcf(receive);
     }
+#endif
+  }
+
+  if (needsRender) {
+    // Zum Minutenwechsel in der Uhrzeitanzeige darf der Treiber weich ueberblenden.
+    ledDriver.setFading((rtc.getSeconds() == 0) && (modes.getMode() == STD_MODE_NORMAL));
 
     //
     // Bildschirmpuffer beschreiben...
     //
-    switch (mode) {
-      case STD_MODE_NORMAL:
-      case EXT_MODE_TIMESET:
-        renderer.clearScreenBuffer(matrix);
-        renderer.setMinutes(rtc.getHours() + settings.getTimeShift(), rtc.getMinutes(), settings.getLanguage(), matrix);
-        renderer.setCorners(rtc.getMinutes(), settings.getRenderCornersCw(), matrix);
-        break;
-      case EXT_MODE_TIME_SHIFT:
-        renderer.clearScreenBuffer(matrix);
-        if (settings.getTimeShift() < 0) {
-          for (byte x = 0; x < 3; x++) {
-            ledDriver.setPixelInScreenBuffer(x, 1, matrix);
-          }
-        }
-        else if (settings.getTimeShift() > 0) {
-          for (byte x = 0; x < 3; x++) {
-            ledDriver.setPixelInScreenBuffer(x, 1, matrix);
-          }
-          for (byte y = 0; y < 3; y++) {
-            ledDriver.setPixelInScreenBuffer(1, y, matrix);
-          }
-        }
-        for (byte i = 0; i < 7; i++) {
-          matrix[3 + i] |= pgm_read_byte_near(&(ziffern[abs(settings.getTimeShift()) % 10][i])) << 5;
-          if (abs(settings.getTimeShift()) > 9) {
-            matrix[3 + i] |= pgm_read_byte_near(&(ziffern[1][i])) << 10;
-          }
-        }
-        break;
-      case STD_MODE_ALARM:
-        renderer.clearScreenBuffer(matrix);
-        if (alarm.getShowAlarmTimeTimer() == 0) {
-          renderer.setMinutes(rtc.getHours() + settings.getTimeShift(), rtc.getMinutes(), settings.getLanguage(), matrix);
-          renderer.setCorners(rtc.getMinutes(), settings.getRenderCornersCw(), matrix);
-          matrix[4] |= 0b0000000000011111; // Alarm-LED
-        } else {
-          renderer.setMinutes(alarm.getAlarmTime()->getHours() + settings.getTimeShift(), alarm.getAlarmTime()->getMinutes(), settings.getLanguage(), matrix);
-          renderer.setCorners(alarm.getAlarmTime()->getMinutes(), settings.getRenderCornersCw(), matrix);
-          renderer.cleanWordsForAlarmSettingMode(settings.getLanguage(), matrix); // ES IST weg
-          if (alarm.getShowAlarmTimeTimer() % 2 == 0) {
-            matrix[4] |= 0b0000000000011111; // Alarm-LED
-          }
-          alarm.decShowAlarmTimeTimer();
-        }
-        break;
-      case STD_MODE_SECONDS:
-        renderer.clearScreenBuffer(matrix);
-        for (byte i = 0; i < 7; i++) {
-          matrix[1 + i] |= pgm_read_byte_near(&(ziffern[rtc.getSeconds() / 10][i])) << 11;
-          matrix[1 + i] |= pgm_read_byte_near(&(ziffern[rtc.getSeconds() % 10][i])) << 5;
-        }
-        break;
-      case EXT_MODE_LDR_MODE:
-        renderer.clearScreenBuffer(matrix);
-        if (settings.getUseLdr()) {
-          for (byte i = 0; i < 5; i++) {
-            matrix[2 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 8;
-          }
-        } else {
-          for (byte i = 0; i < 5; i++) {
-            matrix[2 + i] |= pgm_read_byte_near(&(staben['M' - 'A'][i])) << 8;
-          }
-        }
-        break;
-      case STD_MODE_BLANK:
-      case STD_MODE_NIGHT:
-        renderer.clearScreenBuffer(matrix);
-        break;
-      case STD_MODE_BRIGHTNESS:
-        renderer.clearScreenBuffer(matrix);
-        brightnessToDisplay = map(settings.getBrightness(), 1, 100, 0, 9);
-        for (byte xb = 0; xb < brightnessToDisplay; xb++) {
-          for (byte yb = 0; yb <= xb; yb++) {
-            matrix[9 - yb] |= 1 << (14 - xb);
-          }
-        }
-        break;
-      case EXT_MODE_CORNERS:
-        renderer.clearScreenBuffer(matrix);
-        if (settings.getRenderCornersCw()) {
-          for (byte i = 0; i < 5; i++) {
-            matrix[2 + i] |= pgm_read_byte_near(&(staben['C' - 'A'][i])) << 11;
-            matrix[2 + i] |= pgm_read_byte_near(&(staben['W' - 'A'][i])) << 5;
-          }
-        } else {
-          for (byte i = 0; i < 5; i++) {
-            matrix[0 + i] |= pgm_read_byte_near(&(staben['C' - 'A'][i])) << 8;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['C' - 'A'][i])) << 11;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['W' - 'A'][i])) << 5;
-          }
-        }
-        break;
-      case EXT_MODE_ENABLE_ALARM:
-        renderer.clearScreenBuffer(matrix);
-        if (settings.getEnableAlarm()) {
-          for (byte i = 0; i < 5; i++) {
-            matrix[0 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 11;
-            matrix[0 + i] |= pgm_read_byte_near(&(staben['L' - 'A'][i])) << 5;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 11;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 5;
-          }
-        } else {
-          for (byte i = 0; i < 5; i++) {
-            matrix[0 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 11;
-            matrix[0 + i] |= pgm_read_byte_near(&(staben['L' - 'A'][i])) << 5;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 5;
-          }
-        }
-        break;
-      case EXT_MODE_DCF_IS_INVERTED:
-        renderer.clearScreenBuffer(matrix);
-        if (settings.getDcfSignalIsInverted()) {
-          for (byte i = 0; i < 5; i++) {
-            matrix[0 + i] |= pgm_read_byte_near(&(staben['R' - 'A'][i])) << 11;
-            matrix[0 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 5;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['I' - 'A'][i])) << 11;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 5;
-          }
-        } else {
-          for (byte i = 0; i < 5; i++) {
-            matrix[0 + i] |= pgm_read_byte_near(&(staben['R' - 'A'][i])) << 11;
-            matrix[0 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 5;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 11;
-            matrix[5 + i] |= pgm_read_byte_near(&(staben['O' - 'A'][i])) << 5;
-          }
-        }
-        break;
-      case EXT_MODE_LANGUAGE:
-        renderer.clearScreenBuffer(matrix);
-        for (byte i = 0; i < 5; i++) {
-          switch (settings.getLanguage()) {
-            case LANGUAGE_DE_DE:
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 5;
-              break;
-            case LANGUAGE_DE_SW:
-              matrix[0 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
-              matrix[0 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 5;
-              matrix[5 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 11;
-              matrix[5 + i] |= pgm_read_byte_near(&(staben['W' - 'A'][i])) << 5;
-              break;
-            case LANGUAGE_DE_BA:
-              matrix[0 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
-              matrix[0 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 5;
-              matrix[5 + i] |= pgm_read_byte_near(&(staben['B' - 'A'][i])) << 11;
-              matrix[5 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 5;
-              break;
-            case LANGUAGE_DE_SA:
-              matrix[0 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
-              matrix[0 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 5;
-              matrix[5 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 11;
-              matrix[5 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 5;
-              break;
-            case LANGUAGE_CH:
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['C' - 'A'][i])) << 11;
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['H' - 'A'][i])) << 5;
-              break;
-            case LANGUAGE_EN:
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 11;
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 5;
-              break;
-            case LANGUAGE_FR:
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['F' - 'A'][i])) << 11;
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['R' - 'A'][i])) << 5;
-              break;
-            case LANGUAGE_IT:
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['I' - 'A'][i])) << 11;
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['T' - 'A'][i])) << 5;
-              break;
-            case LANGUAGE_NL:
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 11;
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['L' - 'A'][i])) << 5;
-              break;
-            case LANGUAGE_ES:
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 11;
-              matrix[2 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 5;
-              break;
-          }
-        }
-        break;
-      case EXT_MODE_TEST:
-        renderer.clearScreenBuffer(matrix);
-        renderer.setCorners(helperSeconds % 5, settings.getRenderCornersCw(), matrix);
-        if (settings.getEnableAlarm()) {
-          matrix[4] |= 0b0000000000011111; // Alarm-LED
-        }
-        for (int i = 0; i < 11; i++) {
-          ledDriver.setPixelInScreenBuffer(x, i, matrix);
-        }
-        x++;
-        if (x > 10) {
-          x = 0;
-        }
-        break;
-      case EXT_MODE_DCF_DEBUG:
-        renderer.clearScreenBuffer(matrix);
-        renderer.setCorners(dcf77.getBitPointer() % 5, settings.getRenderCornersCw(), matrix);
-        break;
+    modes.render();
+
+    // Der Puffer wird jede Sekunde neu gerendert, die Anzeige aendert sich aber
+    // meist nicht. Nur echte Aenderungen gehen an den Treiber, so wird kein
+    // laufendes Ueberblenden abgebrochen und nichts unnoetig rausgeschoben.
+#ifdef ENABLE_TRANSITIONS
+    // Den Uebergang zur neuen Anzeige starten, die weiteren Schritte rendert taskTransition().
+    byte transitionType = transitionForMode();
+    if (changeDetector.hasChanged(matrix)) {
+      if (transition.start(transitionType, matrix)) {
+        transition.nextStep(&frameBuffer);
+        ledDriver.writeFrameBufferToMatrix(&frameBuffer);
+        lastTransitionStep = millis();
+      } else {
+        // gleicher Inhalt, aber erzwungen (z.B. neue Farbe)
+        matrixChanged = true;
+      }
     }
-
-    // Update mit onChange = true, weil sich hier (aufgrund needsUpdateFromRtc) immer was geaendert hat.
-    // Entweder weil wir eine Sekunde weiter sind, oder weil eine Taste gedrueckt wurde.
-    ledDriver.writeScreenBufferToMatrix(matrix, true);
+#else
+    // Mit dem Refresh uebernehmen, ein eigener Durchlauf des Treibers (ein ganzes
+    // Bild) wuerde den naechsten Refresh um diese Aufgabe verzoegern.
+    if (changeDetector.hasChanged(matrix)) {
+      matrixChanged = true;
+    }
+#endif
   }
+}
 
-  /*
-
-     Tasten abfragen (Code mit 3.3.0 ausgelagert, wegen der Fernbedienung)
+#ifdef ENABLE_TRANSITIONS
+/**
+   Den naechsten Schritt eines laufenden Uebergangs ausgeben.
+*/
+void taskTransition() {
+  if (transition.isRunning() && (millis() - lastTransitionStep >= TRANSITION_STEP_DURATION)) {
+    lastTransitionStep = millis();
+    transition.nextStep(&frameBuffer);
+    ledDriver.writeFrameBufferToMatrix(&frameBuffer);
+  }
+}
+#endif
 
-  */
+/**
+   Tasten abfragen (Code mit 3.3.0 ausgelagert, wegen der Fernbedienung).
+   Die Tasten melden sich mit den Codes der Fernbedienung.
+*/
+void taskButtons() {
   // M+ und H+ im STD_MODE_BLANK gedrueckt?
-  if ((mode == STD_MODE_BLANK) && extModeDoubleButton.pressed()) {
-    doubleExtModePressed();
+  if ((modes.getMode() == STD_MODE_BLANK) && extModeDoubleButton.pressed()) {
+    events.post(EVENT_BUTTON, REMOTE_BUTTON_EXTMODE);
   }
 
   // Taste Minuten++ (brighness++) gedrueckt?
   if (minutesPlusButton.pressed()) {
-    minutePlusPressed();
+    events.post(EVENT_BUTTON, REMOTE_BUTTON_MINUTE_PLUS);
   }
 
   // Taste Stunden++ (brightness--) gedrueckt?
   if (hoursPlusButton.pressed()) {
-    hourPlusPressed();
+    events.post(EVENT_BUTTON, REMOTE_BUTTON_HOUR_PLUS);
   }
 
   // Taste Moduswechsel gedrueckt?
   if (modeChangeButton.pressed()) {
-    modePressed();
+    events.post(EVENT_BUTTON, REMOTE_BUTTON_MODE);
   }
+}
 
-  /*
-
-     Tasten der Fernbedienung abfragen...
-
-  */
 #ifndef REMOTE_NO_REMOTE
-  if (irrecv.decode(&irDecodeResults)) {
+/**
+   Tasten der Fernbedienung abfragen...
+*/
+void taskIr() {
+  boolean irDecoded = irrecv.decode(&irDecodeResults);
+  if (irDecoded) {
     DEBUG_PRINT(F("Decoded successfully as "));
     DEBUG_PRINTLN2(irDecodeResults.value, HEX);
-    needsUpdateFromRtc = true;
-    switch (irTranslator.buttonForCode(irDecodeResults.value)) {
-      case REMOTE_BUTTON_MODE:
-        modePressed();
-        break;
-      case REMOTE_BUTTON_MINUTE_PLUS:
-        minutePlusPressed();
-        break;
-      case REMOTE_BUTTON_HOUR_PLUS:
-        hourPlusPressed();
-        break;
-      case REMOTE_BUTTON_BRIGHTER:
-        setDisplayBrighter();
-        break;
-      case REMOTE_BUTTON_DARKER:
-        setDisplayDarker();
-        break;
-      case REMOTE_BUTTON_EXTMODE:
-        doubleExtModePressed();
-        break;
-      case REMOTE_BUTTON_TOGGLEBLANK:
-        setDisplayToToggle();
+    events.post(EVENT_IR, irTranslator.buttonForCode(irDecodeResults.value));
+    irrecv.resume();
+  }
+}
+#endif
+
+/**
+   Eine Taste (am Gehaeuse oder auf der Fernbedienung) ausfuehren.
+*/
+void buttonPressed(byte button) {
+  switch (button) {
+    case REMOTE_BUTTON_MODE:
+      modePressed();
+      break;
+    case REMOTE_BUTTON_MINUTE_PLUS:
+      minutePlusPressed();
+      break;
+    case REMOTE_BUTTON_HOUR_PLUS:
+      hourPlusPressed();
+      break;
+    case REMOTE_BUTTON_BRIGHTER:
+      setDisplayBrighter();
+      break;
+    case REMOTE_BUTTON_DARKER:
+      setDisplayDarker();
+      break;
+    case REMOTE_BUTTON_EXTMODE:
+      doubleExtModePressed();
+      break;
+    case REMOTE_BUTTON_TOGGLEBLANK:
+      setDisplayToToggle();
+      break;
+    case REMOTE_BUTTON_BLANK:
+      setDisplayToBlank();
+      break;
+    case REMOTE_BUTTON_RESUME:
+      setDisplayToResume();
+      break;
+#ifndef REMOTE_NO_REMOTE
+    case REMOTE_BUTTON_SETCOLOR:
+      ledDriver.setColor(irTranslator.getRed(), irTranslator.getGreen(), irTranslator.getBlue());
+      settings.setColor(irTranslator.getRed(), irTranslator.getGreen(), irTranslator.getBlue());
+      // neue Farbe, also den Puffer nochmal ausgeben
+      changeDetector.invalidate();
+      needsUpdateFromRtc = true;
+      break;
+#endif
+  }
+}
+
+/**
+   Die gemeldeten Ereignisse auswerten.
+*/
+void taskEvents() {
+  byte type;
+  byte param;
+  while (events.get(type, param)) {
+    switch (type) {
+      case EVENT_BUTTON:
+        buttonPressed(param);
         break;
-      case REMOTE_BUTTON_BLANK:
-        setDisplayToBlank();
+      case EVENT_IR:
+        needsUpdateFromRtc = true;
+        buttonPressed(param);
         break;
-      case REMOTE_BUTTON_RESUME:
-        setDisplayToResume();
+      case EVENT_DCF77_MINUTE:
+        manageNewDCF77Data();
         break;
-      case REMOTE_BUTTON_SETCOLOR:
-        ledDriver.setColor(irTranslator.getRed(), irTranslator.getGreen(), irTranslator.getBlue());
+      case EVENT_LDR:
+        // langsam nachziehen, eine Stufe pro Meldung...
+        if (settings.getUseLdr()) {
+          if (ledDriver.getBrightness() > param) {
+            ledDriver.setBrightness(ledDriver.getBrightness() - 1);
+          }
+          else if (ledDriver.getBrightness() < param) {
+            ledDriver.setBrightness(ledDriver.getBrightness() + 1);
+          }
+        }
         break;
     }
-    irrecv.resume();
   }
-#endif
+}
+
+/**
+   Nachtabschaltung, Wecker und die Rueckkehr aus den Einstell-Modi.
+*/
+void taskClock() {
+  modes.poll();
 
   /*
 
@@ -1131,13 +1454,11 @@ void loop() {
 
   */
   if ((offTime.getMinutesOfDay() != 0) && (onTime.getMinutesOfDay() != 0)) {
-    if ((mode != STD_MODE_NIGHT) && (offTime.getMinutesOfDay() == rtc.getMinutesOfDay())) {
-      mode = STD_MODE_NIGHT;
-      ledDriver.shutDown();
+    if ((modes.getMode() != STD_MODE_NIGHT) && (offTime.getMinutesOfDay() == rtc.getMinutesOfDay())) {
+      modes.setMode(STD_MODE_NIGHT);
     }
-    if ((mode == STD_MODE_NIGHT) && (onTime.getMinutesOfDay() == rtc.getMinutesOfDay())) {
-      mode = lastMode;
-      ledDriver.wakeUp();
+    if ((modes.getMode() == STD_MODE_NIGHT) && (onTime.getMinutesOfDay() == rtc.getMinutesOfDay())) {
+      modes.resume();
     }
   }
 
@@ -1146,7 +1467,7 @@ void loop() {
      Alarm?
 
   */
-  if ((mode == STD_MODE_ALARM) && (alarm.getShowAlarmTimeTimer() == 0) && !alarm.isActive()) {
+  if ((modes.getMode() == STD_MODE_ALARM) && (alarm.getShowAlarmTimeTimer() == 0) && !alarm.isActive()) {
     if (alarm.getAlarmTime()->getMinutesOf12HoursDay(0) == rtc.getMinutesOf12HoursDay()) {
       alarm.activate();
     }
@@ -1156,7 +1477,7 @@ void loop() {
     if (alarm.getAlarmTime()->getMinutesOf12HoursDay(MAX_BUZZ_TIME_IN_MINUTES) == rtc.getMinutesOf12HoursDay()) {
       alarm.deactivate();
       alarm.buzz(false);
-      mode = STD_MODE_NORMAL;
+      modes.setMode(STD_MODE_NORMAL);
     }
     // Krach machen...
     if (rtc.getSeconds() % 2 == 0) {
@@ -1165,34 +1486,439 @@ void loop() {
       alarm.buzz(false);
     }
   }
+}
 
-  /*
+/**
+   Status-LEDs ausgeben
+*/
+void taskStatusLeds() {
+#ifdef ENABLE_DCF_LED
+  dcf77.statusLed(dcfEnabled && dcf77.signal(settings.getDcfSignalIsInverted()));
+#endif
+#ifdef ENABLE_SQW_LED
+  rtc.statusLed(digitalRead(PIN_SQW_SIGNAL) == HIGH);
+#endif
+}
 
-     Die Matrix auf die LEDs multiplexen, hier 'Refresh-Zyklen'.
+/**
+   Die Zeit (auch im Modus 'Zeit stellen').
+*/
+void renderTime() {
+  renderer.clearScreenBuffer(matrix);
+  renderer.setMinutes(rtc.getHours() + settings.getTimeShift(), rtc.getMinutes(), settings.getLanguage(), matrix);
+  renderer.setCorners(rtc.getMinutes(), settings.getRenderCornersCw(), matrix);
+}
 
-  */
-  if ((mode != STD_MODE_BLANK) && (mode != STD_MODE_NIGHT)) {
-    ledDriver.writeScreenBufferToMatrix(matrix, false);
+/**
+   Die Zeitverschiebung in Stunden.
+*/
+void renderTimeShift() {
+  renderer.clearScreenBuffer(matrix);
+  if (settings.getTimeShift() < 0) {
+    for (byte x = 0; x < 3; x++) {
+      ledDriver.setPixelInScreenBuffer(x, 1, matrix);
+    }
   }
+  else if (settings.getTimeShift() > 0) {
+    for (byte x = 0; x < 3; x++) {
+      ledDriver.setPixelInScreenBuffer(x, 1, matrix);
+    }
+    for (byte y = 0; y < 3; y++) {
+      ledDriver.setPixelInScreenBuffer(1, y, matrix);
+    }
+  }
+  for (byte i = 0; i < 7; i++) {
+    matrix[3 + i] |= pgm_read_byte_near(&(ziffern[abs(settings.getTimeShift()) % 10][i])) << 5;
+    if (abs(settings.getTimeShift()) > 9) {
+      matrix[3 + i] |= pgm_read_byte_near(&(ziffern[1][i])) << 10;
+    }
+  }
+}
 
-  /*
+/**
+   Die Zeit mit Alarm-LED, nach einer Taste blinkend die Weckzeit.
+*/
+void renderAlarm() {
+  renderer.clearScreenBuffer(matrix);
+  if (alarm.getShowAlarmTimeTimer() == 0) {
+    renderer.setMinutes(rtc.getHours() + settings.getTimeShift(), rtc.getMinutes(), settings.getLanguage(), matrix);
+    renderer.setCorners(rtc.getMinutes(), settings.getRenderCornersCw(), matrix);
+    matrix[4] |= 0b0000000000011111; // Alarm-LED
+  } else {
+    renderer.setMinutes(alarm.getAlarmTime()->getHours() + settings.getTimeShift(), alarm.getAlarmTime()->getMinutes(), settings.getLanguage(), matrix);
+    renderer.setCorners(alarm.getAlarmTime()->getMinutes(), settings.getRenderCornersCw(), matrix);
+    renderer.cleanWordsForAlarmSettingMode(settings.getLanguage(), matrix); // ES IST weg
+    if (alarm.getShowAlarmTimeTimer() % 2 == 0) {
+      matrix[4] |= 0b0000000000011111; // Alarm-LED
+    }
+    alarm.decShowAlarmTimeTimer();
+  }
+}
 
-     Status-LEDs ausgeben
+/**
+   Die Sekunden als Ziffern.
+*/
+void renderSeconds() {
+  renderer.clearScreenBuffer(matrix);
+  for (byte i = 0; i < 7; i++) {
+    matrix[1 + i] |= pgm_read_byte_near(&(ziffern[rtc.getSeconds() / 10][i])) << 11;
+    matrix[1 + i] |= pgm_read_byte_near(&(ziffern[rtc.getSeconds() % 10][i])) << 5;
+  }
+}
 
-  */
-#ifdef ENABLE_DCF_LED
-  dcf77.statusLed(dcf77.signal(settings.getDcfSignalIsInverted()));
+/**
+   Helligkeit automatisch ('A') oder manuell ('M').
+*/
+void renderLdrMode() {
+  renderer.clearScreenBuffer(matrix);
+  if (settings.getUseLdr()) {
+    for (byte i = 0; i < 5; i++) {
+      matrix[2 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 8;
+    }
+  } else {
+    for (byte i = 0; i < 5; i++) {
+      matrix[2 + i] |= pgm_read_byte_near(&(staben['M' - 'A'][i])) << 8;
+    }
+  }
+}
+
+/**
+   Nichts (Anzeige aus).
+*/
+void renderBlank() {
+  renderer.clearScreenBuffer(matrix);
+}
+
+/**
+   Die Helligkeit als Balken.
+*/
+void renderBrightness() {
+  renderer.clearScreenBuffer(matrix);
+  brightnessToDisplay = map(settings.getBrightness(), 1, 100, 0, 9);
+  for (byte xb = 0; xb < brightnessToDisplay; xb++) {
+    for (byte yb = 0; yb <= xb; yb++) {
+      matrix[9 - yb] |= 1 << (14 - xb);
+    }
+  }
+}
+
+/**
+   Die Laufrichtung der Eck-LEDs.
+*/
+void renderCorners() {
+  renderer.clearScreenBuffer(matrix);
+  if (settings.getRenderCornersCw()) {
+    for (byte i = 0; i < 5; i++) {
+      matrix[2 + i] |= pgm_read_byte_near(&(staben['C' - 'A'][i])) << 11;
+      matrix[2 + i] |= pgm_read_byte_near(&(staben['W' - 'A'][i])) << 5;
+    }
+  } else {
+    for (byte i = 0; i < 5; i++) {
+      matrix[0 + i] |= pgm_read_byte_near(&(staben['C' - 'A'][i])) << 8;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['C' - 'A'][i])) << 11;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['W' - 'A'][i])) << 5;
+    }
+  }
+}
+
+/**
+   Alarm eingeschaltet (AL EN) oder nicht (AL DA).
+*/
+void renderEnableAlarm() {
+  renderer.clearScreenBuffer(matrix);
+  if (settings.getEnableAlarm()) {
+    for (byte i = 0; i < 5; i++) {
+      matrix[0 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 11;
+      matrix[0 + i] |= pgm_read_byte_near(&(staben['L' - 'A'][i])) << 5;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 11;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 5;
+    }
+  } else {
+    for (byte i = 0; i < 5; i++) {
+      matrix[0 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 11;
+      matrix[0 + i] |= pgm_read_byte_near(&(staben['L' - 'A'][i])) << 5;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 5;
+    }
+  }
+}
+
+/**
+   DCF77-Signal invertiert (RS IN) oder nicht (RS NO).
+*/
+void renderDcfIsInverted() {
+  renderer.clearScreenBuffer(matrix);
+  if (settings.getDcfSignalIsInverted()) {
+    for (byte i = 0; i < 5; i++) {
+      matrix[0 + i] |= pgm_read_byte_near(&(staben['R' - 'A'][i])) << 11;
+      matrix[0 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 5;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['I' - 'A'][i])) << 11;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 5;
+    }
+  } else {
+    for (byte i = 0; i < 5; i++) {
+      matrix[0 + i] |= pgm_read_byte_near(&(staben['R' - 'A'][i])) << 11;
+      matrix[0 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 5;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 11;
+      matrix[5 + i] |= pgm_read_byte_near(&(staben['O' - 'A'][i])) << 5;
+    }
+  }
+}
+
+/**
+   Die Sprache.
+*/
+void renderLanguage() {
+  renderer.clearScreenBuffer(matrix);
+  for (byte i = 0; i < 5; i++) {
+    switch (settings.getLanguage()) {
+#ifdef ENABLE_LANGUAGE_DE
+      case LANGUAGE_DE_DE:
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 5;
+        break;
+      case LANGUAGE_DE_SW:
+        matrix[0 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
+        matrix[0 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 5;
+        matrix[5 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 11;
+        matrix[5 + i] |= pgm_read_byte_near(&(staben['W' - 'A'][i])) << 5;
+        break;
+      case LANGUAGE_DE_BA:
+        matrix[0 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
+        matrix[0 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 5;
+        matrix[5 + i] |= pgm_read_byte_near(&(staben['B' - 'A'][i])) << 11;
+        matrix[5 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 5;
+        break;
+      case LANGUAGE_DE_SA:
+        matrix[0 + i] |= pgm_read_byte_near(&(staben['D' - 'A'][i])) << 11;
+        matrix[0 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 5;
+        matrix[5 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 11;
+        matrix[5 + i] |= pgm_read_byte_near(&(staben['A' - 'A'][i])) << 5;
+        break;
 #endif
-#ifdef ENABLE_SQW_LED
-  rtc.statusLed(digitalRead(PIN_SQW_SIGNAL) == HIGH);
+#ifdef ENABLE_LANGUAGE_CH
+      case LANGUAGE_CH:
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['C' - 'A'][i])) << 11;
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['H' - 'A'][i])) << 5;
+        break;
+#endif
+#ifdef ENABLE_LANGUAGE_EN
+      case LANGUAGE_EN:
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 11;
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 5;
+        break;
+#endif
+#ifdef ENABLE_LANGUAGE_FR
+      case LANGUAGE_FR:
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['F' - 'A'][i])) << 11;
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['R' - 'A'][i])) << 5;
+        break;
+#endif
+#ifdef ENABLE_LANGUAGE_IT
+      case LANGUAGE_IT:
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['I' - 'A'][i])) << 11;
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['T' - 'A'][i])) << 5;
+        break;
 #endif
+#ifdef ENABLE_LANGUAGE_NL
+      case LANGUAGE_NL:
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['N' - 'A'][i])) << 11;
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['L' - 'A'][i])) << 5;
+        break;
+#endif
+#ifdef ENABLE_LANGUAGE_ES
+      case LANGUAGE_ES:
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['E' - 'A'][i])) << 11;
+        matrix[2 + i] |= pgm_read_byte_near(&(staben['S' - 'A'][i])) << 5;
+        break;
+#endif
+    }
+  }
+}
 
-  /*
+/**
+   Der Bildschirm-Test: eine wandernde Spalte.
+*/
+void renderTest() {
+  renderer.clearScreenBuffer(matrix);
+  renderer.setCorners(rtc.getSeconds() % 5, settings.getRenderCornersCw(), matrix);
+  if (settings.getEnableAlarm()) {
+    matrix[4] |= 0b0000000000011111; // Alarm-LED
+  }
+  for (int i = 0; i < 11; i++) {
+    ledDriver.setPixelInScreenBuffer(x, i, matrix);
+  }
+  x++;
+  if (x > 10) {
+    x = 0;
+  }
+}
 
-     DCF77-Empfaenger anticken...
+/**
+   Die empfangenen DCF77-Bits als Eck-LEDs.
+*/
+void renderDcfDebug() {
+  renderer.clearScreenBuffer(matrix);
+  renderer.setCorners(dcf77.getBitPointer() % 5, settings.getRenderCornersCw(), matrix);
+}
 
-  */
-  dcf77.poll(settings.getDcfSignalIsInverted());
+#ifdef ENABLE_DCF77_TELEMETRY
+/**
+   Die DCF77-Empfangsstatistik.
+*/
+void renderDcfStats() {
+  renderer.clearScreenBuffer(matrix);
+  dcf77Telemetry.renderHistogram(matrix);
+  renderer.setCorners(dcf77Telemetry.getRecentSuccesses(), settings.getRenderCornersCw(), matrix);
+}
+#endif
+
+/**
+   Modus 'Alarm' ueberspringen, wenn kein Alarm enabled ist.
+*/
+boolean skipAlarm() {
+  return !settings.getEnableAlarm();
+}
+
+/**
+   Modus 'Helligkeit' ueberspringen, wenn der LDR verwendet wird.
+*/
+boolean skipBrightness() {
+  return settings.getUseLdr();
+}
+
+/**
+   Wenn auf Alarm gewechselt wurde, fuer 10 Sekunden die Weckzeit anzeigen.
+*/
+void enterAlarm() {
+  alarm.setShowAlarmTimeTimer(10);
+}
+
+/**
+   Displaytreiber ausschalten (BLANK, NIGHT)...
+*/
+void displayOff() {
+  DEBUG_PRINTLN(F("LED-Driver: ShutDown"));
+  DEBUG_FLUSH();
+  ledDriver.shutDown();
+}
+
+/**
+   ... und beim Verlassen wieder einschalten.
+*/
+void displayOn() {
+  DEBUG_PRINTLN(F("LED-Driver: WakeUp"));
+  DEBUG_FLUSH();
+  ledDriver.wakeUp();
+}
+
+/**
+   Beim Verlassen eines Einstell-Modus die Werte gleich speichern (die Funktion
+   speichert nur bei geaenderten Werten), sonst erst nach SETTINGS_SAVE_DELAY ms.
+*/
+void saveSettings() {
+  settings.saveToEEPROM();
+}
+
+/**
+   H+/M+ im Modus 'Alarm': die Weckzeit stellen.
+*/
+void buttonAlarm(boolean plus) {
+  if (plus) {
+    alarm.getAlarmTime()->incMinutes();
+  } else {
+    alarm.getAlarmTime()->incHours();
+  }
+  settings.setAlarmTime(alarm.getAlarmTime()->getMinutesOfDay());
+  alarm.setShowAlarmTimeTimer(10);
+  DEBUG_PRINT(F("A is now "));
+  DEBUG_PRINTLN(alarm.getAlarmTime()->asString());
+  DEBUG_FLUSH();
+}
+
+/**
+   H+/M+ im Modus 'Helligkeit': dunkler/heller.
+*/
+void buttonBrightness(boolean plus) {
+  if (plus) {
+    setDisplayBrighter();
+  } else {
+    setDisplayDarker();
+  }
+}
+
+/**
+   H+/M+ im Modus 'LDR': automatische Helligkeit umschalten.
+*/
+void buttonLdrMode(boolean /* plus */) {
+  settings.setUseLdr(!settings.getUseLdr());
+  if (!settings.getUseLdr()) {
+    ledDriver.setBrightness(50);
+  }
+  DEBUG_PRINT(F("LDR is now "));
+  DEBUG_PRINTLN(settings.getUseLdr());
+  DEBUG_FLUSH();
+}
+
+/**
+   H+/M+ im Modus 'Ecken': die Laufrichtung umschalten.
+*/
+void buttonCorners(boolean /* plus */) {
+  settings.setRenderCornersCw(!settings.getRenderCornersCw());
+}
+
+/**
+   H+/M+ im Modus 'Alarm einschalten'.
+*/
+void buttonEnableAlarm(boolean /* plus */) {
+  settings.setEnableAlarm(!settings.getEnableAlarm());
+}
+
+/**
+   H+/M+ im Modus 'DCF77-Signal invertiert'.
+*/
+void buttonDcfIsInverted(boolean /* plus */) {
+  settings.setDcfSignalIsInverted(!settings.getDcfSignalIsInverted());
+}
+
+/**
+   H+/M+ im Modus 'Sprache': vorige/naechste Sprache.
+*/
+void buttonLanguage(boolean plus) {
+  settings.setLanguage(Renderer::nextLanguage(settings.getLanguage(), plus));
+}
+
+/**
+   H+/M+ im Modus 'Zeit stellen'.
+*/
+void buttonTimeset(boolean plus) {
+  if (plus) {
+    rtc.incMinutes();
+  } else {
+    rtc.incHours();
+  }
+  rtc.setSeconds(0);
+  rtc.writeTime();
+#ifdef ENABLE_RTC_DRIFT
+  rtcDrift.invalidate();
+#endif
+  DEBUG_PRINT(F("Time is now "));
+  DEBUG_PRINT(rtc.getHours());
+  DEBUG_PRINT(F(":"));
+  DEBUG_PRINTLN(rtc.getMinutes());
+  DEBUG_FLUSH();
+}
+
+/**
+   H+/M+ im Modus 'Zeitverschiebung': eine Stunde zurueck/vor.
+*/
+void buttonTimeShift(boolean plus) {
+  if (plus && (settings.getTimeShift() < 13)) {
+    settings.setTimeShift(settings.getTimeShift() + 1);
+  }
+  if (!plus && (settings.getTimeShift() > -13)) {
+    settings.setTimeShift(settings.getTimeShift() - 1);
+  }
 }
 
 /**
@@ -1204,10 +1930,9 @@ void doubleExtModePressed() {
   DEBUG_FLUSH();
   while (minutesPlusButton.pressed());
   while (hoursPlusButton.pressed());
-  mode = EXT_MODE_START;
-  ledDriver.wakeUp();
+  modes.setMode(EXT_MODE_START);
   DEBUG_PRINT(F("Entering EXT_MODEs, mode is now "));
-  DEBUG_PRINT(mode);
+  DEBUG_PRINT(modes.getMode());
   DEBUG_PRINTLN(F("..."));
   DEBUG_FLUSH();
 }
@@ -1219,55 +1944,15 @@ void modePressed() {
   needsUpdateFromRtc = true;
   if (alarm.isActive()) {
     alarm.deactivate();
-    mode = STD_MODE_NORMAL;
+    modes.setMode(STD_MODE_NORMAL);
   } else {
-    mode++;
-  }
-  // Brightness ueberspringen, wenn LDR verwendet wird.
-  if (settings.getUseLdr() && (mode == STD_MODE_BRIGHTNESS)) {
-    mode++;
-  }
-  // Alarm ueberspringen, wenn kein Alarm enabled ist.
-  if (!settings.getEnableAlarm() && (mode == STD_MODE_ALARM)) {
-    mode++;
-  }
-  if (mode == STD_MODE_COUNT + 1) {
-    mode = STD_MODE_NORMAL;
-  }
-  if (mode == EXT_MODE_COUNT + 1) {
-    mode = STD_MODE_NORMAL;
-  }
-
-  if (mode == STD_MODE_ALARM) {
-    // wenn auf Alarm gewechselt wurde, fuer 10 Sekunden die
-    // Weckzeit anzeigen.
-    alarm.setShowAlarmTimeTimer(10);
+    modes.next();
   }
 
   DEBUG_PRINT(F("Change mode pressed, mode is now "));
-  DEBUG_PRINT(mode);
+  DEBUG_PRINT(modes.getMode());
   DEBUG_PRINTLN(F("..."));
   DEBUG_FLUSH();
-
-  // Displaytreiber ausschalten, wenn BLANK
-  if (mode == STD_MODE_BLANK) {
-    DEBUG_PRINTLN(F("LED-Driver: ShutDown"));
-    DEBUG_FLUSH();
-    ledDriver.shutDown();
-  }
-  // und einschalten, wenn BLANK verlassen wurde
-  if (lastMode == STD_MODE_BLANK) {
-    DEBUG_PRINTLN(F("LED-Driver: WakeUp"));
-    DEBUG_FLUSH();
-    ledDriver.wakeUp();
-  }
-
-  // Merker, damit wir nach einer automatischen Abschaltung
-  // zum richtigen Mode zurueckkommen.
-  lastMode = mode;
-
-  // Werte speichern (die Funktion speichert nur bei geaenderten Werten)...
-  settings.saveToEEPROM();
 }
 
 /**
@@ -1279,58 +1964,7 @@ void hourPlusPressed() {
   DEBUG_PRINTLN(F("Hours plus pressed..."));
   DEBUG_FLUSH();
 
-  switch (mode) {
-    case EXT_MODE_TIMESET:
-      rtc.incHours();
-      rtc.setSeconds(0);
-      rtc.writeTime();
-      rtc.readTime();
-      helperSeconds = 0;
-      DEBUG_PRINT(F("H is now "));
-      DEBUG_PRINTLN(rtc.getHours());
-      DEBUG_FLUSH();
-      break;
-    case EXT_MODE_TIME_SHIFT:
-      if (settings.getTimeShift() > -13) {
-        settings.setTimeShift(settings.getTimeShift() - 1);
-      }
-      break;
-    case STD_MODE_ALARM:
-      alarm.getAlarmTime()->incHours();
-      alarm.setShowAlarmTimeTimer(10);
-      DEBUG_PRINT(F("A is now "));
-      DEBUG_PRINTLN(alarm.getAlarmTime()->asString());
-      DEBUG_FLUSH();
-      break;
-    case STD_MODE_BRIGHTNESS:
-      setDisplayDarker();
-      break;
-    case EXT_MODE_LDR_MODE:
-      settings.setUseLdr(!settings.getUseLdr());
-      if (!settings.getUseLdr()) {
-        ledDriver.setBrightness(50);
-      }
-      DEBUG_PRINT(F("LDR is now "));
-      DEBUG_PRINTLN(settings.getUseLdr());
-      DEBUG_FLUSH();
-      break;
-    case EXT_MODE_CORNERS:
-      settings.setRenderCornersCw(!settings.getRenderCornersCw());
-      break;
-    case EXT_MODE_ENABLE_ALARM:
-      settings.setEnableAlarm(!settings.getEnableAlarm());
-      break;
-    case EXT_MODE_DCF_IS_INVERTED:
-      settings.setDcfSignalIsInverted(!settings.getDcfSignalIsInverted());
-      break;
-    case EXT_MODE_LANGUAGE:
-      if (settings.getLanguage() == 0) {
-        settings.setLanguage(LANGUAGE_COUNT);
-      } else {
-        settings.setLanguage(settings.getLanguage() - 1);
-      }
-      break;
-  }
+  modes.button(false);
 }
 
 /**
@@ -1342,63 +1976,14 @@ void minutePlusPressed() {
   DEBUG_PRINTLN(F("Minutes plus pressed..."));
   DEBUG_FLUSH();
 
-  switch (mode) {
-    case EXT_MODE_TIMESET:
-      rtc.incMinutes();
-      rtc.setSeconds(0);
-      rtc.writeTime();
-      rtc.readTime();
-      helperSeconds = 0;
-      DEBUG_PRINT(F("M is now "));
-      DEBUG_PRINTLN(rtc.getMinutes());
-      DEBUG_FLUSH();
-      break;
-    case EXT_MODE_TIME_SHIFT:
-      if (settings.getTimeShift() < 13) {
-        settings.setTimeShift(settings.getTimeShift() + 1);
-      }
-      break;
-    case STD_MODE_ALARM:
-      alarm.getAlarmTime()->incMinutes();
-      alarm.setShowAlarmTimeTimer(10);
-      DEBUG_PRINT(F("A is now "));
-      DEBUG_PRINTLN(alarm.getAlarmTime()->asString());
-      DEBUG_FLUSH();
-      break;
-    case STD_MODE_BRIGHTNESS:
-      setDisplayBrighter();
-      break;
-    case EXT_MODE_LDR_MODE:
-      settings.setUseLdr(!settings.getUseLdr());
-      if (!settings.getUseLdr()) {
-        ledDriver.setBrightness(50);
-      }
-      DEBUG_PRINT(F("LDR is now "));
-      DEBUG_PRINTLN(settings.getUseLdr());
-      DEBUG_FLUSH();
-      break;
-    case EXT_MODE_CORNERS:
-      settings.setRenderCornersCw(!settings.getRenderCornersCw());
-      break;
-    case EXT_MODE_ENABLE_ALARM:
-      settings.setEnableAlarm(!settings.getEnableAlarm());
-      break;
-    case EXT_MODE_DCF_IS_INVERTED:
-      settings.setDcfSignalIsInverted(!settings.getDcfSignalIsInverted());
-      break;
-    case EXT_MODE_LANGUAGE:
-      settings.setLanguage(settings.getLanguage() + 1);
-      if (settings.getLanguage() > LANGUAGE_COUNT) {
-        settings.setLanguage(0);
-      }
-      break;
-  }
+  modes.button(true);
 }
 
 /**
    Den DCF77-Empfaenger ein-/ausschalten.
 */
 void enableDcf(boolean enable) {
+  dcfEnabled = enable;
   if (enable) {
     DEBUG_PRINTLN(F("DCF77-Empfaenger aufgeweckt."));
     DEBUG_FLUSH();
@@ -1409,6 +1994,7 @@ void enableDcf(boolean enable) {
     DEBUG_FLUSH();
     digitalWrite(PIN_DCF77_PON, HIGH);
   }
+  dcf77.enable(enable);
 }
 
 /**
@@ -1423,28 +2009,44 @@ void manageNewDCF77Data() {
   rtc.readTime();
   dcf77Helper.addSample(dcf77, rtc);
   // Stimmen die Abstaende im Array?
-  // Pruefung ohne Datum, nur Zeit!
-  if (dcf77Helper.samplesOk()) {
+  // Geprueft wird ueber die Minuten seit 2000, also mit Datum.
+  boolean samplesOk = dcf77Helper.samplesOk();
+#ifdef ENABLE_DCF77_TELEMETRY
+  dcf77Telemetry.sync(samplesOk, dcf77.getMinutes(), dcf77.getHours(), dcf77.getDate(), dcf77.getMonth(), dcf77.getYear());
+#endif
+  if (samplesOk) {
+#if defined(ENABLE_DCF77_SCHEDULER) || defined(ENABLE_RTC_DRIFT)
+    // Wie weit lag die RTC daneben? Daraus ergeben sich die Drift und die naechste Synchronisation.
+    unsigned long dcfMinutes = TimeStamp::minutesSince2000(dcf77.getMinutes(), dcf77.getHours(), dcf77.getDate(), dcf77.getMonth(), dcf77.getYear());
+    long offset = (long)(TimeStamp::minutesSince2000(rtc.getMinutes(), rtc.getHours(), rtc.getDate(), rtc.getMonth(), rtc.getYear()) - dcfMinutes) * 60 + rtc.getSeconds();
+#endif
+#ifdef ENABLE_DCF77_SCHEDULER
+    dcf77Scheduler.synced(dcfMinutes, offset);
+#endif
+#ifdef ENABLE_RTC_DRIFT
+    rtcDrift.synced(rtc, dcfMinutes, offset);
+#endif
     rtc.setSeconds(0);
     rtc.setMinutes(dcf77.getMinutes());
     rtc.setHours(dcf77.getHours());
     // Wir setzen auch das Datum, dann kann man, wenn man moechte,
     // auf das Datum eingehen (spezielle Nachrichten an speziellen
-    // Tagen). Allerdings ist das Datum bisher nicht ueber
-    // den Abstand der TimeStamps geprueft, sondern nur ueber das
-    // Checkbit des DCF77-Telegramms, was unzureichend ist!
+    // Tagen). Das Datum ist ueber die Paritaet P3, die Bereichspruefung
+    // und den Abstand der Samples geprueft.
     rtc.setDate(dcf77.getDate());
     rtc.setDayOfWeek(dcf77.getDayOfWeek());
     rtc.setMonth(dcf77.getMonth());
     rtc.setYear(dcf77.getYear());
 
     rtc.writeTime();
+#ifdef ENABLE_OFFLINE_DST
+    summerTime = dcf77.isSummerTime();
+#endif
     DEBUG_PRINTLN(F("DCF77-Time written to RTC."));
     DEBUG_FLUSH();
     // falls im manuellen Dunkel-Modus, Display wieder einschalten... (Hilft bei der Erkennung, ob der DCF-Empfang geklappt hat).
-    if (mode == STD_MODE_BLANK) {
-      mode = STD_MODE_NORMAL;
-      ledDriver.wakeUp();
+    if (modes.getMode() == STD_MODE_BLANK) {
+      modes.setMode(STD_MODE_NORMAL);
     }
   }
   else {
@@ -1453,11 +2055,34 @@ void manageNewDCF77Data() {
   }
 }
 
+#ifdef ENABLE_OFFLINE_DST
+/**
+   Die Sommerzeit ohne DCF77 nach der Regel aus der Configuration.h umstellen.
+   Die RTC laeuft in Ortszeit, summerTime sagt, ob darin gerade die Sommerzeit
+   steckt. Umgestellt wird nur die Stunde, die Regeln liegen alle nachts.
+*/
+void manageSummerTime() {
+  unsigned long standardMinutes = TimeStamp::minutesSince2000(rtc.getMinutes(), rtc.getHours(), rtc.getDate(), rtc.getMonth(), rtc.getYear());
+  if (summerTime) {
+    standardMinutes -= 60;
+  }
+  boolean needed = TimeStamp::isSummerTime(OFFLINE_DST_RULE, standardMinutes, rtc.getYear(), OFFLINE_DST_UTC_OFFSET);
+  if (needed != summerTime) {
+    DEBUG_PRINT(F("Sommerzeit: "));
+    DEBUG_PRINTLN(needed);
+    DEBUG_FLUSH();
+    rtc.setHours((rtc.getHours() + (needed ? 1 : 23)) % 24);
+    rtc.writeTime();
+    summerTime = needed;
+  }
+}
+#endif
+
 /**
    Das Display toggeln (aus-/einschalten).
 */
 void setDisplayToToggle() {
-  if (mode != STD_MODE_BLANK) {
+  if (modes.getMode() != STD_MODE_BLANK) {
     setDisplayToBlank();
   }
   else {
@@ -1469,24 +2094,15 @@ void setDisplayToToggle() {
    Das Display ausschalten.
 */
 void setDisplayToBlank() {
-  if (mode != STD_MODE_BLANK) {
-    lastMode = mode;
-    mode = STD_MODE_BLANK;
-    DEBUG_PRINTLN(F("LED-Driver: ShutDown"));
-    DEBUG_FLUSH();
-    ledDriver.shutDown();
-  }
+  modes.setMode(STD_MODE_BLANK);
 }
 
 /**
    Das Display einschalten.
 */
 void setDisplayToResume() {
-  if (mode == STD_MODE_BLANK) {
-    mode = lastMode;
-    DEBUG_PRINTLN(F("LED-Driver: WakeUp"));
-    DEBUG_FLUSH();
-    ledDriver.wakeUp();
+  if (modes.getMode() == STD_MODE_BLANK) {
+    modes.resume();
   }
 }
 
@@ -1500,7 +2116,6 @@ void setDisplayBrighter() {
       b = 100;
     }
     settings.setBrightness(b);
-    settings.saveToEEPROM();
     ledDriver.setBrightness(b);
   }
 }
@@ -1515,7 +2130,20 @@ void setDisplayDarker() {
       i = 1;
     }
     settings.setBrightness(i);
-    settings.saveToEEPROM();
     ledDriver.setBrightness(i);
   }
 }
+
+#ifdef ENABLE_TRANSITIONS
+/**
+   Der Uebergang zur gerade gerenderten Anzeige. Beim Moduswechsel wird
+   gewischt, sonst hat jeder Modus seinen eigenen Uebergang (Modes.h).
+*/
+byte transitionForMode() {
+  if (modes.getMode() != renderedMode) {
+    renderedMode = modes.getMode();
+    return TRANSITION_MODE_CHANGE;
+  }
+  return modes.getTransition();
+}
+#endif
@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.5
+ * @version  1.9
  * @created  21.1.2013
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -16,17 +16,36 @@
  *         - Fehler im Italienischen behoben.
  * V 1.4:  - Stundenbegrenzung (die ja wegen der Zeitverschiebungsmoeglichkeit existiert) auf den Bereich 0 <= h <= 24 ausgeweitet, dank Tipp aus dem Forum.
  * V 1.5:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.6:  - setMinutes ueber PROGMEM-Tabellen (Zeitansagen.h) statt verschachtelter switch-Anweisungen.
+ * V 1.7:  - Woerter als Zeile, Startspalte und Laenge (WORD_LAYOUT) statt Bitmasken.
+ * V 1.8:  - Nur die Sprachen aus der Configuration.h (ENABLE_LANGUAGE_XX) werden gelinkt.
+ * V 1.9:  - Gewolltes Durchfallen in setCorners() markiert.
  */
 #include "Renderer.h"
 
-#include "Woerter_DE.h"
-// #include "Woerter_DE_MKF.h"
-#include "Woerter_CH.h"
-#include "Woerter_EN.h"
-#include "Woerter_FR.h"
-#include "Woerter_IT.h"
-#include "Woerter_NL.h"
-#include "Woerter_ES.h"
+#ifdef ENABLE_LANGUAGE_DE
+  #include "Woerter_DE.h"
+  // #include "Woerter_DE_MKF.h"
+#endif
+#ifdef ENABLE_LANGUAGE_CH
+  #include "Woerter_CH.h"
+#endif
+#ifdef ENABLE_LANGUAGE_EN
+  #include "Woerter_EN.h"
+#endif
+#ifdef ENABLE_LANGUAGE_FR
+  #include "Woerter_FR.h"
+#endif
+#ifdef ENABLE_LANGUAGE_IT
+  #include "Woerter_IT.h"
+#endif
+#ifdef ENABLE_LANGUAGE_NL
+  #include "Woerter_NL.h"
+#endif
+#ifdef ENABLE_LANGUAGE_ES
+  #include "Woerter_ES.h"
+#endif
+#include "Zeitansagen.h"
 
 // #define DEBUG
 #include "Debug.h"
@@ -63,7 +82,9 @@ void Renderer::setAllScreenBuffer(word matrix[16]) {
 }
 
 /**
- * Setzt die Wortminuten, je nach hours/minutes.
+ * Setzt die Wortminuten, je nach hours/minutes. Die Ansage kommt aus den
+ * Tabellen in Zeitansagen.h: Vorsatz ('ES IST'), Minutenwoerter, Stunde
+ * und Zusatzwort, also hoechstens 8 Woerter pro Aufruf.
  */
 void Renderer::setMinutes(char hours, byte minutes, byte language, word matrix[16]) {
     while (hours < 0) {
@@ -73,1059 +94,140 @@ void Renderer::setMinutes(char hours, byte minutes, byte language, word matrix[1
         hours -= 12;
     }
 
+    const word* words;
+    const byte* minuteTable;
+    const byte* hourTable;
+    byte hourCount = 12;
+    byte prefix = 0;
+    byte fullHour = 0;
+
     switch (language) {
-            //
-            // Deutsch: Hochdeutsch
-            //
+#ifdef ENABLE_LANGUAGE_DE
         case LANGUAGE_DE_DE:
         case LANGUAGE_DE_SW:
         case LANGUAGE_DE_BA:
         case LANGUAGE_DE_SA:
-            // DE_ESIST;
-
-            switch (minutes / 5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    DE_FUENF;
-                    DE_NACH;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    DE_ZEHN;
-                    DE_NACH;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    if ((language == LANGUAGE_DE_SW) || (language == LANGUAGE_DE_SA)) {
-                        DE_VIERTEL;
-                        setHours(hours + 1, false, language, matrix);
-                    } else {
-                        DE_VIERTEL;
-                        DE_NACH;
-                        setHours(hours, false, language, matrix);
-                    }
-                    break;
-                case 4:
-                    // 20 nach
-                    if (language == LANGUAGE_DE_SA) {
-                        DE_ZEHN;
-                        DE_VOR;
-                        DE_HALB;
-                        setHours(hours + 1, false, language, matrix);
-                    } else {
-                        DE_ZWANZIG;
-                        DE_NACH;
-                        setHours(hours, false, language, matrix);
-                    }
-                    break;
-                case 5:
-                    // 5 vor halb
-                    DE_FUENF;
-                    DE_VOR;
-                    DE_HALB;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    DE_HALB;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    DE_FUENF;
-                    DE_NACH;
-                    DE_HALB;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    if (language == LANGUAGE_DE_SA) {
-                        DE_ZEHN;
-                        DE_NACH;
-                        DE_HALB;
-                        setHours(hours + 1, false, language, matrix);
-                    } else {
-                        DE_ZWANZIG;
-                        DE_VOR;
-                        setHours(hours + 1, false, language, matrix);
-                    }
-                    break;
-                case 9:
-                    // viertel vor
-                    if ((language == LANGUAGE_DE_SW) || (language == LANGUAGE_DE_BA) || (language == LANGUAGE_DE_SA)) {
-                        DE_DREIVIERTEL;
-                        setHours(hours + 1, false, language, matrix);
-                    } else {
-                        DE_VIERTEL;
-                        DE_VOR;
-                        setHours(hours + 1, false, language, matrix);
-                    }
-                    break;
-                case 10:
-                    // 10 vor
-                    DE_ZEHN;
-                    DE_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    DE_FUENF;
-                    DE_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
+            words = DE_WORDS;
+            if (language == LANGUAGE_DE_SW) {
+                minuteTable = &DE_SW_MINUTES[0][0];
+            } else if (language == LANGUAGE_DE_BA) {
+                minuteTable = &DE_BA_MINUTES[0][0];
+            } else if (language == LANGUAGE_DE_SA) {
+                minuteTable = &DE_SA_MINUTES[0][0];
+            } else {
+                minuteTable = &DE_DE_MINUTES[0][0];
             }
+            hourTable = &DE_HOURS[0][0];
+            // prefix = DE_ESIST;
+            fullHour = DE_UHR;
             break;
-            //
-            // Schweiz: Berner-Deutsch
-            //
+#endif
+#ifdef ENABLE_LANGUAGE_CH
         case LANGUAGE_CH:
-            CH_ESISCH;
-
-            switch (minutes / 5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    break;
-                case 1:
-                    // 5 ab
-                    CH_FUEF;
-                    CH_AB;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 ab
-                    CH_ZAEAE;
-                    CH_AB;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel ab
-                    CH_VIERTU;
-                    CH_AB;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 4:
-                    // 20 ab
-                    CH_ZWAENZG;
-                    CH_AB;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    CH_FUEF;
-                    CH_VOR;
-                    CH_HAUBI;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    CH_HAUBI;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 ab halb
-                    CH_FUEF;
-                    CH_AB;
-                    CH_HAUBI;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    CH_ZWAENZG;
-                    CH_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    CH_VIERTU;
-                    CH_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    CH_ZAEAE;
-                    CH_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    CH_FUEF;
-                    CH_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-            }
+            words = CH_WORDS;
+            minuteTable = &CH_MINUTES[0][0];
+            hourTable = &CH_HOURS[0][0];
+            prefix = CH_ESISCH;
             break;
-            //
-            // Englisch
-            //
+#endif
+#ifdef ENABLE_LANGUAGE_EN
         case LANGUAGE_EN:
-            EN_ITIS;
-
-            switch (minutes / 5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    EN_FIVE;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    EN_TEN;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    EN_A;
-                    EN_QUATER;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 4:
-                    // 20 nach
-                    EN_TWENTY;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    EN_TWENTY;
-                    EN_FIVE;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    EN_HALF;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    EN_TWENTY;
-                    EN_FIVE;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    EN_TWENTY;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    EN_A;
-                    EN_QUATER;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    EN_TEN;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    EN_FIVE;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-            }
+            words = EN_WORDS;
+            minuteTable = &EN_MINUTES[0][0];
+            hourTable = &EN_HOURS[0][0];
+            prefix = EN_ITIS;
+            fullHour = EN_OCLOCK;
             break;
-            //
-            // Franzoesisch
-            //
+#endif
+#ifdef ENABLE_LANGUAGE_FR
         case LANGUAGE_FR:
-            FR_ILEST;
-
-            switch (minutes / 5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    FR_hours(hours, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_CINQ;
-                    break;
-                case 2:
-                    // 10 nach
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_DIX;
-                    break;
-                case 3:
-                    // viertel nach
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_ET;
-                    FR_QUART;
-                    break;
-                case 4:
-                    // 20 nach
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_VINGT;
-                    break;
-                case 5:
-                    // 5 vor halb
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_VINGT;
-                    FR_TRAIT;
-                    FR_CINQ;
-                    break;
-                case 6:
-                    // halb
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_ET;
-                    FR_DEMI;
-                    break;
-                case 7:
-                    // 5 nach halb
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_VINGT;
-                    FR_TRAIT;
-                    FR_CINQ;
-                    break;
-                case 8:
-                    // 20 vor
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_VINGT;
-                    break;
-                case 9:
-                    // viertel vor
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_LE;
-                    FR_QUART;
-                    break;
-                case 10:
-                    // 10 vor
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_DIX;
-                    break;
-                case 11:
-                    // 5 vor
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_CINQ;
-                    break;
-            }
+            words = FR_WORDS;
+            minuteTable = &FR_MINUTES[0][0];
+            hourTable = &FR_HOURS[0][0];
+            hourCount = 24;
+            prefix = FR_ILEST;
             break;
-            //
-            // Italienisch
-            //
+#endif
+#ifdef ENABLE_LANGUAGE_IT
         case LANGUAGE_IT:
-            switch (minutes / 5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    IT_E2;
-                    IT_CINQUE;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    IT_E2;
-                    IT_DIECI;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    IT_E2;
-                    IT_UN;
-                    IT_QUARTO;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 4:
-                    // 20 nach
-                    IT_E2;
-                    IT_VENTI;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    IT_E2;
-                    IT_VENTI;
-                    IT_CINQUE;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 6:
-                    // halb
-                    IT_E2;
-                    IT_MEZZA;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    IT_MENO;
-                    IT_VENTI;
-                    IT_CINQUE;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    IT_MENO;
-                    IT_VENTI;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    IT_MENO;
-                    IT_UN;
-                    IT_QUARTO;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    IT_MENO;
-                    IT_DIECI;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    IT_MENO;
-                    IT_CINQUE;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-            }
+            words = IT_WORDS;
+            minuteTable = &IT_MINUTES[0][0];
+            hourTable = &IT_HOURS[0][0];
             break;
-            //
-            // Niederlaendisch
-            //
+#endif
+#ifdef ENABLE_LANGUAGE_NL
         case LANGUAGE_NL:
-            NL_HETIS;
-
-            switch (minutes / 5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    NL_VIJF;
-                    NL_OVER;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    NL_TIEN;
-                    NL_OVER;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    NL_KWART;
-                    NL_OVER2;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 4:
-                    // 10 vor halb
-                    NL_TIEN;
-                    NL_VOOR;
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    NL_VIJF;
-                    NL_VOOR;
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    NL_VIJF;
-                    NL_OVER;
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    NL_TIEN;
-                    NL_OVER;
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    NL_KWART;
-                    NL_VOOR2;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    NL_TIEN;
-                    NL_VOOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    NL_VIJF;
-                    NL_VOOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-            }
+            words = NL_WORDS;
+            minuteTable = &NL_MINUTES[0][0];
+            hourTable = &NL_HOURS[0][0];
+            prefix = NL_HETIS;
+            fullHour = NL_UUR;
             break;
-            //
-            // Spanisch
-            //
+#endif
+#ifdef ENABLE_LANGUAGE_ES
         case LANGUAGE_ES:
-            switch (minutes / 5) {
-                case 0:
-                    // glatte Stunde
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    ES_Y;
-                    ES_CINCO;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    ES_Y;
-                    ES_DIEZ;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    ES_Y;
-                    ES_CUARTO;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 4:
-                    // 20 nach
-                    ES_Y;
-                    ES_VEINTE;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    ES_Y;
-                    ES_VEINTICINCO;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    ES_Y;
-                    ES_MEDIA;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    ES_MENOS;
-                    ES_VEINTICINCO;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    ES_MENOS;
-                    ES_VEINTE;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    ES_MENOS;
-                    ES_CUARTO;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    ES_MENOS;
-                    ES_DIEZ;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    ES_MENOS;
-                    ES_CINCO;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-            }
+            words = ES_WORDS;
+            minuteTable = &ES_MINUTES[0][0];
+            hourTable = &ES_HOURS[0][0];
             break;
+#endif
+        default:
+            return;
+    }
+
+    const byte* slot = minuteTable + (minutes / 5) * ZEIT_MINUTES_WIDTH;
+    byte flags = pgm_read_byte_near(slot);
+    setWord(words, prefix, matrix);
+    for (byte i = 1; i < ZEIT_MINUTES_WIDTH; i++) {
+        setWord(words, pgm_read_byte_near(slot + i), matrix);
+    }
+
+    if (flags & ZEIT_NAECHSTE_STUNDE) {
+        hours++;
+    }
+    const byte* hour = hourTable + (hours % hourCount) * ZEIT_HOURS_WIDTH;
+    if (flags & ZEIT_GLATT) {
+        setWord(words, fullHour, matrix);
+        setWord(words, pgm_read_byte_near(hour + 1), matrix);
+    } else {
+        setWord(words, pgm_read_byte_near(hour), matrix);
     }
+    setWord(words, pgm_read_byte_near(hour + 2), matrix);
 }
 
 /**
- * Setzt die Stunden, je nach hours. 'glatt' bedeutet,
- * es ist genau diese Stunde und wir muessen 'UHR'
- * dazuschreiben und EIN statt EINS, falls es 1 ist.
- * (Zumindest im Deutschen)
+ * Ein Wort aus der Woertertabelle einer Sprache setzen (0 = kein Wort).
  */
-void Renderer::setHours(byte hours, boolean glatt, byte language, word matrix[16]) {
-    switch (language) {
-            //
-            // Deutsch (Hochdeutsch, Schwaebisch, Bayrisch)
-            //
-        case LANGUAGE_DE_DE:
-        case LANGUAGE_DE_SW:
-        case LANGUAGE_DE_BA:
-        case LANGUAGE_DE_SA:
-            if (glatt) {
-                DE_UHR;
-            }
-
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    DE_H_ZWOELF;
-                    break;
-                case 1:
-                case 13:
-                    if (glatt) {
-                        DE_H_EIN;
-                    } else {
-                        DE_H_EINS;
-                    }
-                    break;
-                case 2:
-                case 14:
-                    DE_H_ZWEI;
-                    break;
-                case 3:
-                case 15:
-                    DE_H_DREI;
-                    break;
-                case 4:
-                case 16:
-                    DE_H_VIER;
-                    break;
-                case 5:
-                case 17:
-                    DE_H_FUENF;
-                    break;
-                case 6:
-                case 18:
-                    DE_H_SECHS;
-                    break;
-                case 7:
-                case 19:
-                    DE_H_SIEBEN;
-                    break;
-                case 8:
-                case 20:
-                    DE_H_ACHT;
-                    break;
-                case 9:
-                case 21:
-                    DE_H_NEUN;
-                    break;
-                case 10:
-                case 22:
-                    DE_H_ZEHN;
-                    break;
-                case 11:
-                case 23:
-                    DE_H_ELF;
-                    break;
-            }
-            break;
-            //
-            // Schweiz: Berner-Deutsch
-            //
-        case LANGUAGE_CH:
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    CH_H_ZWOEUFI;
-                    break;
-                case 1:
-                case 13:
-                    CH_H_EIS;
-                    break;
-                case 2:
-                case 14:
-                    CH_H_ZWOEI;
-                    break;
-                case 3:
-                case 15:
-                    CH_H_DRUE;
-                    break;
-                case 4:
-                case 16:
-                    CH_H_VIER;
-                    break;
-                case 5:
-                case 17:
-                    CH_H_FUEFI;
-                    break;
-                case 6:
-                case 18:
-                    CH_H_SAECHSI;
-                    break;
-                case 7:
-                case 19:
-                    CH_H_SIEBNI;
-                    break;
-                case 8:
-                case 20:
-                    CH_H_ACHTI;
-                    break;
-                case 9:
-                case 21:
-                    CH_H_NUENI;
-                    break;
-                case 10:
-                case 22:
-                    CH_H_ZAENI;
-                    break;
-                case 11:
-                case 23:
-                    CH_H_EUFI;
-                    break;
-            }
-            break;
-            //
-            // Englisch
-            //
-        case LANGUAGE_EN:
-            if (glatt) {
-                EN_OCLOCK;
-            }
-
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    EN_H_TWELVE;
-                    break;
-                case 1:
-                case 13:
-                    EN_H_ONE;
-                    break;
-                case 2:
-                case 14:
-                    EN_H_TWO;
-                    break;
-                case 3:
-                case 15:
-                    EN_H_THREE;
-                    break;
-                case 4:
-                case 16:
-                    EN_H_FOUR;
-                    break;
-                case 5:
-                case 17:
-                    EN_H_FIVE;
-                    break;
-                case 6:
-                case 18:
-                    EN_H_SIX;
-                    break;
-                case 7:
-                case 19:
-                    EN_H_SEVEN;
-                    break;
-                case 8:
-                case 20:
-                    EN_H_EIGHT;
-                    break;
-                case 9:
-                case 21:
-                    EN_H_NINE;
-                    break;
-                case 10:
-                case 22:
-                    EN_H_TEN;
-                    break;
-                case 11:
-                case 23:
-                    EN_H_ELEVEN;
-                    break;
-            }
-            break;
-            //
-            // Franzoesisch
-        case LANGUAGE_FR:
-            switch (hours) {
-                case 0:
-                case 24:
-                    FR_H_MINUIT;
-                    break;
-                case 12:
-                    FR_H_MIDI;
-                    break;
-                case 1:
-                case 13:
-                    FR_H_UNE;
-                    break;
-                case 2:
-                case 14:
-                    FR_H_DEUX;
-                    break;
-                case 3:
-                case 15:
-                    FR_H_TROIS;
-                    break;
-                case 4:
-                case 16:
-                    FR_H_QUATRE;
-                    break;
-                case 5:
-                case 17:
-                    FR_H_CINQ;
-                    break;
-                case 6:
-                case 18:
-                    FR_H_SIX;
-                    break;
-                case 7:
-                case 19:
-                    FR_H_SEPT;
-                    break;
-                case 8:
-                case 20:
-                    FR_H_HUIT;
-                    break;
-                case 9:
-                case 21:
-                    FR_H_NEUF;
-                    break;
-                case 10:
-                case 22:
-                    FR_H_DIX;
-                    break;
-                case 11:
-                case 23:
-                    FR_H_ONZE;
-                    break;
-            }
-            break;
-            //
-            // Italienisch
-            //
-        case LANGUAGE_IT:
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    IT_H_DODICI;
-                    break;
-                case 1:
-                case 13:
-                    IT_H_LUNA;
-                    break;
-                case 2:
-                case 14:
-                    IT_H_DUE;
-                    break;
-                case 3:
-                case 15:
-                    IT_H_TRE;
-                    break;
-                case 4:
-                case 16:
-                    IT_H_QUATTRO;
-                    break;
-                case 5:
-                case 17:
-                    IT_H_CINQUE;
-                    break;
-                case 6:
-                case 18:
-                    IT_H_SEI;
-                    break;
-                case 7:
-                case 19:
-                    IT_H_SETTE;
-                    break;
-                case 8:
-                case 20:
-                    IT_H_OTTO;
-                    break;
-                case 9:
-                case 21:
-                    IT_H_NOVE;
-                    break;
-                case 10:
-                case 22:
-                    IT_H_DIECI;
-                    break;
-                case 11:
-                case 23:
-                    IT_H_UNDICI;
-                    break;
-            }
-            break;
-            //
-            // Niederlaendisch
-            //
-        case LANGUAGE_NL:
-            if (glatt) {
-                NL_UUR;
-            }
+void Renderer::setWord(const word words[], byte index, word matrix[16]) {
+    if (index) {
+        word w;
+        do {
+            w = pgm_read_word_near(&words[index++]);
+            matrix[WORD_ROW(w)] |= wordMask(w);
+        } while (w & WORD_MORE);
+    }
+}
 
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    NL_H_TWAALF;
-                    break;
-                case 1:
-                case 13:
-                    NL_H_EEN;
-                    break;
-                case 2:
-                case 14:
-                    NL_H_TWEE;
-                    break;
-                case 3:
-                case 15:
-                    NL_H_DRIE;
-                    break;
-                case 4:
-                case 16:
-                    NL_H_VIER;
-                    break;
-                case 5:
-                case 17:
-                    NL_H_VIJF;
-                    break;
-                case 6:
-                case 18:
-                    NL_H_ZES;
-                    break;
-                case 7:
-                case 19:
-                    NL_H_ZEVEN;
-                    break;
-                case 8:
-                case 20:
-                    NL_H_ACHT;
-                    break;
-                case 9:
-                case 21:
-                    NL_H_NEGEN;
-                    break;
-                case 10:
-                case 22:
-                    NL_H_TIEN;
-                    break;
-                case 11:
-                case 23:
-                    NL_H_ELF;
-                    break;
-            }
-            break;
-            //
-            // Spanisch
-            //
-        case LANGUAGE_ES:
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    ES_H_DOCE;
-                    break;
-                case 1:
-                case 13:
-                    ES_H_UNA;
-                    break;
-                case 2:
-                case 14:
-                    ES_H_DOS;
-                    break;
-                case 3:
-                case 15:
-                    ES_H_TRES;
-                    break;
-                case 4:
-                case 16:
-                    ES_H_CUATRO;
-                    break;
-                case 5:
-                case 17:
-                    ES_H_CINCO;
-                    break;
-                case 6:
-                case 18:
-                    ES_H_SEIS;
-                    break;
-                case 7:
-                case 19:
-                    ES_H_SIETE;
-                    break;
-                case 8:
-                case 20:
-                    ES_H_OCHO;
-                    break;
-                case 9:
-                case 21:
-                    ES_H_NUEVE;
-                    break;
-                case 10:
-                case 22:
-                    ES_H_DIEZ;
-                    break;
-                case 11:
-                case 23:
-                    ES_H_ONCE;
-                    break;
-            }
-            break;
+/**
+ * Ein Wort aus der Woertertabelle einer Sprache loeschen (0 = kein Wort).
+ */
+void Renderer::clearWord(const word words[], byte index, word matrix[16]) {
+    if (index) {
+        word w;
+        do {
+            w = pgm_read_word_near(&words[index++]);
+            matrix[WORD_ROW(w)] &= ~wordMask(w);
+        } while (w & WORD_MORE);
     }
 }
 
+/**
+ * Die Bitmaske eines Wortteils in seiner Zeile.
+ */
+word Renderer::wordMask(word w) {
+    return (word)(0xFFFF << (16 - WORD_LENGTH(w))) >> WORD_START(w);
+}
+
 /**
  * Setzt die vier Punkte in den Ecken, je nach minutes % 5 (Rest).
  *
@@ -1138,10 +240,13 @@ void Renderer::setCorners(byte minutes, boolean cw, word matrix[16]) {
         switch (minutes % 5) {
             case 4:
                 matrix[0] |= 0b0000000000011111; // oben links
+                // fall through
             case 3:
                 matrix[3] |= 0b0000000000011111; // unten links
+                // fall through
             case 2:
                 matrix[2] |= 0b0000000000011111; // unten rechts
+                // fall through
             case 1:
                 matrix[1] |= 0b0000000000011111; // oben rechts
             default:
@@ -1152,10 +257,13 @@ void Renderer::setCorners(byte minutes, boolean cw, word matrix[16]) {
         switch (minutes % 5) {
             case 4:
                 matrix[1] |= 0b0000000000011111; // oben rechts
+                // fall through
             case 3:
                 matrix[2] |= 0b0000000000011111; // unten rechts
+                // fall through
             case 2:
                 matrix[3] |= 0b0000000000011111; // unten links
+                // fall through
             case 1:
                 matrix[0] |= 0b0000000000011111; // oben links
             default:
@@ -1169,66 +277,103 @@ void Renderer::setCorners(byte minutes, boolean cw, word matrix[16]) {
  */
 void Renderer::cleanWordsForAlarmSettingMode(byte language, word matrix[16]) {
     switch (language) {
+#ifdef ENABLE_LANGUAGE_DE
         case LANGUAGE_DE_DE:
         case LANGUAGE_DE_SW:
         case LANGUAGE_DE_BA:
         case LANGUAGE_DE_SA:
-            matrix[0] &= 0b0010001111111111; // ES IST weg
+            clearWord(DE_WORDS, DE_ESIST, matrix);
             break;
+#endif
+#ifdef ENABLE_LANGUAGE_CH
         case LANGUAGE_CH:
-            matrix[0] &= 0b0010000111111111; // ES ISCH weg
+            clearWord(CH_WORDS, CH_ESISCH, matrix);
             break;
+#endif
+#ifdef ENABLE_LANGUAGE_EN
         case LANGUAGE_EN:
-            matrix[0] &= 0b0010011111111111; // IT IS weg
+            clearWord(EN_WORDS, EN_ITIS, matrix);
             break;
+#endif
+#ifdef ENABLE_LANGUAGE_FR
         case LANGUAGE_FR:
-            matrix[0] &= 0b0010001111111111; // IL EST weg
+            clearWord(FR_WORDS, FR_ILEST, matrix);
             break;
+#endif
+#ifdef ENABLE_LANGUAGE_IT
         case LANGUAGE_IT:
-            matrix[0] &= 0b0000100111111111; // SONO LE weg
-            matrix[1] &= 0b0111111111111111; // E (L'UNA) weg
+            clearWord(IT_WORDS, IT_SONOLE, matrix);
+            clearWord(IT_WORDS, IT_E, matrix); // E (L'UNA)
             break;
+#endif
+#ifdef ENABLE_LANGUAGE_NL
         case LANGUAGE_NL:
-            matrix[0] &= 0b0001001111111111; // HET IS weg
+            clearWord(NL_WORDS, NL_HETIS, matrix);
             break;
+#endif
+#ifdef ENABLE_LANGUAGE_ES
         case LANGUAGE_ES:
-            matrix[0] &= 0b1000100011111111; // SON LAS weg
-            matrix[0] &= 0b0011100111111111; // ES LA weg
+            clearWord(ES_WORDS, ES_SONLAS, matrix);
+            clearWord(ES_WORDS, ES_ESLA, matrix);
             break;
+#endif
     }
 }
 
 /**
- * Sprachlicher Spezialfall fuer Franzoesisch.
- */
-void Renderer::FR_hours(byte hours, word matrix[16]) {
-    if ((hours == 1) || (hours == 13)) {
-        FR_HEURE;
-    } else if ((hours == 0) || (hours == 12) || (hours == 24)) {
-        // MIDI / MINUIT ohne HEURES
-    } else {
-        FR_HEURES;
-    }
-}
-
-/**
- * Sprachlicher Spezialfall fuer Italienisch.
+ * Ist die Sprache in die Firmware eingebaut (ENABLE_LANGUAGE_XX)?
  */
-void Renderer::IT_hours(byte hours, word matrix[16]) {
-    if ((hours != 1) && (hours != 13)) {
-        IT_SONOLE;
-    } else {
-        IT_E;
+boolean Renderer::isLanguageEnabled(byte language) {
+    switch (language) {
+#ifdef ENABLE_LANGUAGE_DE
+        case LANGUAGE_DE_DE:
+        case LANGUAGE_DE_SW:
+        case LANGUAGE_DE_BA:
+        case LANGUAGE_DE_SA:
+            return true;
+#endif
+#ifdef ENABLE_LANGUAGE_CH
+        case LANGUAGE_CH:
+            return true;
+#endif
+#ifdef ENABLE_LANGUAGE_EN
+        case LANGUAGE_EN:
+            return true;
+#endif
+#ifdef ENABLE_LANGUAGE_FR
+        case LANGUAGE_FR:
+            return true;
+#endif
+#ifdef ENABLE_LANGUAGE_IT
+        case LANGUAGE_IT:
+            return true;
+#endif
+#ifdef ENABLE_LANGUAGE_NL
+        case LANGUAGE_NL:
+            return true;
+#endif
+#ifdef ENABLE_LANGUAGE_ES
+        case LANGUAGE_ES:
+            return true;
+#endif
+        default:
+            return false;
     }
 }
 
 /**
- * Sprachlicher Spezialfall fuer Spanisch.
+ * Die naechste (up) bzw. vorherige eingebaute Sprache, fuer den Modus 'Sprache'.
  */
-void Renderer::ES_hours(byte hours, word matrix[16]) {
-    if ((hours == 1) || (hours == 13)) {
-        ES_ESLA;
-    } else {
-        ES_SONLAS;
+byte Renderer::nextLanguage(byte language, boolean up) {
+    for (byte i = 0; i <= LANGUAGE_COUNT; i++) {
+        if (up) {
+            language = (language >= LANGUAGE_COUNT) ? 0 : language + 1;
+        } else {
+            language = (language == 0 || language > LANGUAGE_COUNT) ? LANGUAGE_COUNT : language - 1;
+        }
+        if (isLanguageEnabled(language)) {
+            return language;
+        }
     }
+    return LANGUAGE_DEFAULT;
 }
@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.5
+ * @version  1.8
  * @created  21.1.2013
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -16,11 +16,15 @@
  *         - Fehler im Italienischen behoben.
  * V 1.4:  - Stundenbegrenzung (die ja wegen der Zeitverschiebungsmoeglichkeit existiert) auf den Bereich 0 <= h <= 24 ausgeweitet, dank Tipp aus dem Forum.
  * V 1.5:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.6:  - setMinutes ueber PROGMEM-Tabellen (Zeitansagen.h) statt verschachtelter switch-Anweisungen.
+ * V 1.7:  - Woerter als Zeile, Startspalte und Laenge (WORD_LAYOUT) statt Bitmasken.
+ * V 1.8:  - Nur die Sprachen aus der Configuration.h (ENABLE_LANGUAGE_XX) werden gelinkt.
  */
 #ifndef RENDERER_H
 #define RENDERER_H
 
 #include "Arduino.h"
+#include "Configuration.h"
 
 #define LANGUAGE_DE_DE 0
 #define LANGUAGE_DE_SW 1
@@ -34,6 +38,39 @@
 #define LANGUAGE_ES    9
 #define LANGUAGE_COUNT 9
 
+/*
+ * Die Sprache nach dem ersten Einschalten (oder wenn die Sprache aus
+ * dem EEPROM nicht mit eingebaut ist): die erste eingeschaltete.
+ */
+#if defined(ENABLE_LANGUAGE_DE)
+  #define LANGUAGE_DEFAULT LANGUAGE_DE_DE
+#elif defined(ENABLE_LANGUAGE_CH)
+  #define LANGUAGE_DEFAULT LANGUAGE_CH
+#elif defined(ENABLE_LANGUAGE_EN)
+  #define LANGUAGE_DEFAULT LANGUAGE_EN
+#elif defined(ENABLE_LANGUAGE_FR)
+  #define LANGUAGE_DEFAULT LANGUAGE_FR
+#elif defined(ENABLE_LANGUAGE_IT)
+  #define LANGUAGE_DEFAULT LANGUAGE_IT
+#elif defined(ENABLE_LANGUAGE_NL)
+  #define LANGUAGE_DEFAULT LANGUAGE_NL
+#elif defined(ENABLE_LANGUAGE_ES)
+  #define LANGUAGE_DEFAULT LANGUAGE_ES
+#else
+  #error "Keine Sprache eingeschaltet (ENABLE_LANGUAGE_XX in der Configuration.h)!"
+#endif
+
+/*
+ * Ein Wort der Front in 16 Bit: Zeile (4 Bit), Startspalte (4 Bit),
+ * Laenge (4 Bit) und Flags (4 Bit). WORD_MORE heisst, der naechste
+ * Eintrag gehoert noch zum selben Wort (z.B. 'ES IST').
+ */
+#define WORD_LAYOUT(row, start, length) (((row) << 12) | ((start) << 8) | ((length) << 4))
+#define WORD_MORE                       0b0000000000000001
+#define WORD_ROW(w)                     ((w) >> 12)
+#define WORD_START(w)                   (((w) >> 8) & 0x0F)
+#define WORD_LENGTH(w)                  (((w) >> 4) & 0x0F)
+
 class Renderer {
 public:
     Renderer();
@@ -47,13 +84,13 @@ public:
     void clearScreenBuffer(word matrix[16]);
     void setAllScreenBuffer(word matrix[16]);
 
-private:
-    void setHours(byte hours, boolean glatt, byte language, word matrix[16]);
+    static boolean isLanguageEnabled(byte language);
+    static byte nextLanguage(byte language, boolean up);
 
-    // Spezialfaelle
-    void FR_hours(byte hours, word matrix[16]);
-    void IT_hours(byte hours, word matrix[16]);
-    void ES_hours(byte hours, word matrix[16]);
+private:
+    void setWord(const word words[], byte index, word matrix[16]);
+    void clearWord(const word words[], byte index, word matrix[16]);
+    word wordMask(word w);
 };
 
 #endif
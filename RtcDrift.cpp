@@ -0,0 +1,165 @@
+/**
+ * RtcDrift
+ * Misst die Drift der RTC bei DCF77-Synchronisationen und gleicht sie aus.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.3
+ * @created  17.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Korrektur im EepromLog.
+ * V 1.2:  - apply() ohne DS3231 leer, ohne unbenutzten Parameter.
+ * V 1.3:  - tick() liest die RTC nicht mehr, sondern nimmt die zwischengespeicherte Zeit.
+ */
+#include "RtcDrift.h"
+#include "EepromLog.h"
+
+// #define DEBUG
+#include "Debug.h"
+
+RtcDrift::RtcDrift() {
+    _correction = 0;
+    _hasReference = false;
+    _lastSync = 0;
+    _span = 0;
+    _offset = 0;
+#ifndef DS3231
+    _residual = 0;
+    _lastTick = 0;
+#endif
+}
+
+/**
+ * Die Korrektur aus dem EEPROM laden und setzen.
+ */
+void RtcDrift::begin(MyRTC& rtc) {
+    byte data[2];
+    if (eepromLog.read(EEPROMLOG_TYPE_RTCDRIFT, data, sizeof(data)) == sizeof(data)) {
+        _correction = (int)word(data[1], data[0]);
+    }
+    _correction = constrain(_correction, -RTCDRIFT_MAX_CORRECTION, RTCDRIFT_MAX_CORRECTION);
+    DEBUG_PRINT(F("RTC correction (0.1 ppm): "));
+    DEBUG_PRINTLN(_correction);
+    DEBUG_FLUSH();
+    apply(rtc);
+#ifndef DS3231
+    _lastTick = millis();
+#endif
+}
+
+/**
+ * Die Zeit wurde von DCF77 uebernommen.
+ *
+ * @param now Minuten seit 2000 nach DCF77.
+ * @param offset Abweichung der RTC vor dem Stellen in Sekunden (positiv = RTC vor).
+ */
+void RtcDrift::synced(MyRTC& rtc, unsigned long now, long offset) {
+    if (!_hasReference || (abs(offset) > RTCDRIFT_MAX_OFFSET)) {
+        // erste Messung oder die Uhr wurde gestellt: neu anfangen
+        _span = 0;
+        _offset = 0;
+    } else {
+        _span += now - _lastSync;
+        _offset += offset;
+    }
+    _hasReference = true;
+    _lastSync = now;
+
+    DEBUG_PRINT(F("RTC drift: "));
+    DEBUG_PRINT(_offset);
+    DEBUG_PRINT(F("s in "));
+    DEBUG_PRINT(_span);
+    DEBUG_PRINTLN(F(" min."));
+    DEBUG_FLUSH();
+
+    if ((_span < RTCDRIFT_MIN_SPAN) || (abs(_offset) < RTCDRIFT_MIN_OFFSET)) {
+        return;
+    }
+
+    // 0.1 ppm = Sekunden / (Minuten * 60) * 10^7, eine Sekunde Messfehler abziehen.
+    long change = (abs(_offset) - 1) * 166667L / (long)_span;
+    if (_offset < 0) {
+        change = -change;
+    }
+    _correction = constrain(_correction + change, -RTCDRIFT_MAX_CORRECTION, RTCDRIFT_MAX_CORRECTION);
+    DEBUG_PRINT(F("New RTC correction (0.1 ppm): "));
+    DEBUG_PRINTLN(_correction);
+    DEBUG_FLUSH();
+    apply(rtc);
+    save();
+    _span = 0;
+    _offset = 0;
+}
+
+/**
+ * Die Uhr wurde von Hand gestellt, die gesammelte Abweichung stimmt nicht mehr.
+ */
+void RtcDrift::invalidate() {
+    _hasReference = false;
+}
+
+#ifndef DS3231
+/**
+ * Die Software-Korrektur fuer die DS1307: Die Abweichung laut Korrektur
+ * sammeln und bei einer ganzen Sekunde die RTC um eine Sekunde stellen.
+ * Direkt nach dem SQW-Takt und rtc.refresh() aufrufen, denn das Schreiben der
+ * Sekunden setzt den Teiler der RTC zurueck. Gelesen wird nicht, die Sekunden
+ * kommen aus der zwischengespeicherten Zeit.
+ */
+void RtcDrift::tick(MyRTC& rtc) {
+    unsigned long now = millis();
+    while (now - _lastTick >= 1000) {
+        _lastTick += 1000;
+        // pro Sekunde ist die RTC um _correction * 0.1 us vor
+        _residual += _correction;
+    }
+    if (abs(_residual) < 10000000L) {
+        return;
+    }
+    // nicht um den Minutenwechsel herum stellen
+    if ((rtc.getSeconds() < 5) || (rtc.getSeconds() > 54)) {
+        return;
+    }
+    if (_residual > 0) {
+        rtc.setSeconds(rtc.getSeconds() - 1);
+        _residual -= 10000000L;
+    } else {
+        rtc.setSeconds(rtc.getSeconds() + 1);
+        _residual += 10000000L;
+    }
+    rtc.writeTime();
+    DEBUG_PRINTLN(F("RTC corrected by one second."));
+    DEBUG_FLUSH();
+}
+#endif
+
+/**
+ * Die Korrektur in 0.1 ppm (positiv = RTC zu schnell).
+ */
+int RtcDrift::getCorrection() {
+    return _correction;
+}
+
+/**
+ * Die Korrektur setzen: bei der DS3231 ins Aging-Register (1 LSB ca. 0.1 ppm,
+ * positiv = langsamer), bei der DS1307 macht das tick().
+ */
+#ifdef DS3231
+void RtcDrift::apply(MyRTC& rtc) {
+    rtc.writeAgingOffset((char)_correction);
+}
+#else
+void RtcDrift::apply(MyRTC&) {
+}
+#endif
+
+/**
+ * Die Korrektur im EepromLog sichern.
+ */
+void RtcDrift::save() {
+    byte data[2] = {lowByte(_correction), highByte(_correction)};
+    eepromLog.write(EEPROMLOG_TYPE_RTCDRIFT, data, sizeof(data));
+}
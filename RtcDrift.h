@@ -0,0 +1,74 @@
+/**
+ * RtcDrift
+ * Misst bei jeder DCF77-Synchronisation, wie weit die RTC daneben lag, und
+ * gleicht die Drift aus: bei der DS3231 ueber das Aging-Offset-Register, bei der
+ * DS1307 in Software (ab und zu eine Sekunde vor- oder zurueckstellen).
+ *
+ * Eine einzelne Messung ist nur auf etwa eine Sekunde genau (gestellt wird mit dem
+ * naechsten SQW-Takt). Deshalb werden Abweichung und Zeit ueber mehrere
+ * Synchronisationen gesammelt, bis mindestens RTCDRIFT_MIN_OFFSET Sekunden und
+ * RTCDRIFT_MIN_SPAN Minuten zusammen sind. Korrigiert wird um die Abweichung
+ * minus eine Sekunde, also eher zu wenig als zu viel. Eine Abweichung ueber
+ * RTCDRIFT_MAX_OFFSET Sekunden (die Uhr wurde gestellt) verwirft die Sammlung.
+ *
+ * Die Korrektur (in 0.1 ppm, positiv = RTC zu schnell) liegt im EepromLog
+ * und wird beim Start wieder gesetzt.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.1
+ * @created  17.10.2026
+ * @updated  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Korrektur im EepromLog.
+ */
+#ifndef RTCDRIFT_H
+#define RTCDRIFT_H
+
+#include "Arduino.h"
+#include "Configuration.h"
+#include "MyRTC.h"
+
+// Mindestens so viel Abweichung (Sekunden) und Zeit (Minuten) fuer eine Korrektur
+#define RTCDRIFT_MIN_OFFSET 3
+#define RTCDRIFT_MIN_SPAN   1440
+// Mehr Abweichung (Sekunden) heisst: Die Uhr wurde gestellt
+#define RTCDRIFT_MAX_OFFSET 30
+// Grenzen der Korrektur in 0.1 ppm (DS3231: Wertebereich des Registers)
+#ifdef DS3231
+#define RTCDRIFT_MAX_CORRECTION 127
+#else
+#define RTCDRIFT_MAX_CORRECTION 500
+#endif
+
+class RtcDrift {
+public:
+    RtcDrift();
+
+    void begin(MyRTC& rtc);
+    void synced(MyRTC& rtc, unsigned long now, long offset);
+    void invalidate();
+#ifndef DS3231
+    void tick(MyRTC& rtc);
+#endif
+
+    int getCorrection();
+
+private:
+    int _correction;
+    boolean _hasReference;
+    unsigned long _lastSync;
+    unsigned long _span;
+    long _offset;
+#ifndef DS3231
+    long _residual;
+    unsigned long _lastTick;
+#endif
+
+    void apply(MyRTC& rtc);
+    void save();
+};
+
+#endif
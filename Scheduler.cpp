@@ -0,0 +1,103 @@
+/**
+ * Scheduler
+ * Ein kooperativer Scheduler fuer loop(): jede Aufgabe laeuft in ihrem eigenen
+ * Takt, der Refresh bei jedem Durchlauf.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.2
+ * @created  17.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - ENABLE_SEQUENTIAL_LOOP.
+ * V 1.2:  - ENABLE_SEQUENTIAL_LOOP entfernt.
+ */
+#include "Scheduler.h"
+#include "Configuration.h"
+
+Scheduler::Scheduler() {
+    _refresh = 0;
+    _count = 0;
+    _next = 0;
+    _measuring = false;
+    _maxGap = 0;
+    _passes = 0;
+    _runs = 0;
+}
+
+/**
+ * Die Funktion, die bei jedem Durchlauf laufen muss (Refresh der LEDs).
+ */
+void Scheduler::setRefresh(SchedulerTask refresh) {
+    _refresh = refresh;
+}
+
+/**
+ * Eine Aufgabe anmelden.
+ *
+ * @param task: die Funktion.
+ *        period: Millisekunden zwischen zwei Aufrufen (0 = so oft wie moeglich).
+ * @return FALSE, wenn die Tabelle voll ist.
+ */
+boolean Scheduler::add(SchedulerTask task, word period) {
+    if (_count >= SCHEDULER_MAX_TASKS) {
+        return false;
+    }
+    _tasks[_count] = task;
+    _periods[_count] = period;
+    _lastRuns[_count] = millis() - period;
+    _count++;
+    return true;
+}
+
+/**
+ * Ein Durchlauf: Refresh, dann die naechste faellige Aufgabe.
+ */
+void Scheduler::run() {
+    unsigned long now = micros();
+    if (_measuring && (now - _lastRefresh > _maxGap)) {
+        _maxGap = now - _lastRefresh;
+    }
+    _lastRefresh = now;
+    _measuring = true;
+    _passes++;
+
+    if (_refresh) {
+        _refresh();
+    }
+
+    word ms = millis();
+    for (byte n = 0; n < _count; n++) {
+        byte i = _next;
+        _next++;
+        if (_next >= _count) {
+            _next = 0;
+        }
+        if ((word)(ms - _lastRuns[i]) >= _periods[i]) {
+            _lastRuns[i] = ms;
+            _runs++;
+            _tasks[i]();
+            return;
+        }
+    }
+}
+
+/**
+ * Die Zaehler maschinenlesbar ausgeben und die Messung neu beginnen:
+ * 'SCHED,<durchlaeufe>,<aufgaben>,<max luecke us>'.
+ */
+void Scheduler::printCounters() {
+    Serial.print(F("SCHED,"));
+    Serial.print(_passes);
+    Serial.print(F(","));
+    Serial.print(_runs);
+    Serial.print(F(","));
+    Serial.println(_maxGap);
+    _passes = 0;
+    _runs = 0;
+    _maxGap = 0;
+    // die Ausgabe selbst nicht mitmessen
+    _measuring = false;
+}
@@ -0,0 +1,65 @@
+/**
+ * Scheduler
+ * Ein kooperativer Scheduler fuer loop(): jede Aufgabe (Tasten, LDR, Fernbedienung,
+ * Anzeige, ...) laeuft in ihrem eigenen Takt statt bei jedem Durchlauf.
+ *
+ * Pro Durchlauf von run() wird zuerst der Refresh aufgerufen, danach hoechstens
+ * eine faellige Aufgabe, reihum, damit keine Aufgabe die anderen aushungert.
+ * Der Abstand zwischen zwei Refreshs ist so hoechstens die Dauer der laengsten
+ * Aufgabe (plus Refresh), nicht mehr die Summe aller. Die Aufgaben sind einfache
+ * Funktionen, die Tabelle ist statisch (SCHEDULER_MAX_TASKS Plaetze, 6 Bytes pro
+ * Aufgabe). Die Periode ist in Millisekunden (0 = so oft wie moeglich), die
+ * Zeitstempel haben 16 Bit, also hoechstens gut 65 Sekunden.
+ *
+ * Gemessen wird die groesste Luecke zwischen zwei Refreshs (micros()), mit 'L'
+ * ueber Serial maschinenlesbar: 'SCHED,<durchlaeufe>,<aufgaben>,<max luecke us>'.
+ * Danach beginnt die Messung neu. Den Vergleich mit der alten loop() (alle
+ * faelligen Aufgaben nacheinander) macht tests/bench_refresh_gap.cpp.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.2
+ * @created  17.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - ENABLE_SEQUENTIAL_LOOP.
+ * V 1.2:  - ENABLE_SEQUENTIAL_LOOP entfernt.
+ */
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "Arduino.h"
+
+#define SCHEDULER_MAX_TASKS 10
+
+typedef void (*SchedulerTask)();
+
+class Scheduler {
+public:
+    Scheduler();
+
+    void setRefresh(SchedulerTask refresh);
+    boolean add(SchedulerTask task, word period);
+    void run();
+
+    void printCounters();
+
+private:
+    SchedulerTask _refresh;
+    SchedulerTask _tasks[SCHEDULER_MAX_TASKS];
+    word _periods[SCHEDULER_MAX_TASKS];
+    word _lastRuns[SCHEDULER_MAX_TASKS];
+    byte _count;
+    // hier beginnt die Suche nach der naechsten faelligen Aufgabe
+    byte _next;
+
+    boolean _measuring;
+    unsigned long _lastRefresh;
+    unsigned long _maxGap;
+    unsigned long _passes;
+    unsigned long _runs;
+};
+
+#endif
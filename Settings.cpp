@@ -5,9 +5,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.3
+ * @version  1.7
  * @created  23.1.2013
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -17,25 +17,48 @@
  *         - DcfSignalIsInverted aufgenommen.
  *         - TimeShift aufgenommen.
  * V 1.3:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.4:  - Nicht eingebaute Sprachen aus dem EEPROM auf LANGUAGE_DEFAULT setzen.
+ * V 1.5:  - Im EepromLog statt an festen Adressen, das alte Format wird uebernommen.
+ * V 1.6:  - Geaenderte Werte merken und erst SETTINGS_SAVE_DELAY ms nach der letzten Aenderung
+ *           gesammelt speichern (poll()).
+ * V 1.7:  - Weckzeit, Nachtzeiten und Farbe aufgenommen (gepackt in einem zweiten Datensatz).
  */
 #include "Settings.h"
 #include <EEPROM.h>
+#include "EepromLog.h"
 #include "Renderer.h"
 
+// Das alte, feste Format (bis V 1.4) ab Adresse 0.
 #define SETTINGS_MAGIC_NUMBER 0xCA
 #define SETTINGS_VERSION 4
 
+// Die Bytes der Datensaetze im EepromLog. Neue Werte nur hinten anhaengen!
+#define SETTINGS_SIZE 7
+#define SETTINGS_EXTRA_SIZE 8
+
+#define SETTINGS_DIRTY       0x00FF
+#define SETTINGS_DIRTY_EXTRA 0xFF00
+
 /**
  *  Konstruktor.
  */
 Settings::Settings() {
-    _language = LANGUAGE_DE_DE;
+    _language = LANGUAGE_DEFAULT;
     _renderCornersCw = true;
     _use_ldr = true;
     _brightness = 75;
     _enableAlarm = false;
     _dcfSignalIsInverted = false;
     _timeShift = 0;
+    _alarmTime = SETTINGS_ALARM_TIME;
+    _nightOff = SETTINGS_NIGHT_OFF;
+    _nightOn = SETTINGS_NIGHT_ON;
+    _red = 255;
+    _green = 255;
+    _blue = 255;
+    _dirty = 0;
+    _lastChange = 0;
+    _saveNow = false;
 
     // Versuche alte Einstellungen zu laden...
     loadFromEEPROM();
@@ -49,7 +72,10 @@ byte Settings::getLanguage() {
 }
 
 void Settings::setLanguage(byte language) {
-    _language = language;
+    if (_language != language) {
+        _language = language;
+        changed(0);
+    }
 }
 
 /**
@@ -60,7 +86,10 @@ boolean Settings::getRenderCornersCw() {
 }
 
 void Settings::setRenderCornersCw(boolean cw) {
-    _renderCornersCw = cw;
+    if (_renderCornersCw != cw) {
+        _renderCornersCw = cw;
+        changed(1);
+    }
 }
 
 /**
@@ -71,7 +100,10 @@ boolean Settings::getUseLdr() {
 }
 
 void Settings::setUseLdr(boolean useLdr) {
-    _use_ldr = useLdr;
+    if (_use_ldr != useLdr) {
+        _use_ldr = useLdr;
+        changed(2);
+    }
 }
 
 /**
@@ -82,7 +114,10 @@ byte Settings::getBrightness() {
 }
 
 void Settings::setBrightness(byte brightness) {
-    _brightness = brightness;
+    if (_brightness != brightness) {
+        _brightness = brightness;
+        changed(3);
+    }
 }
 
 /**
@@ -93,7 +128,10 @@ boolean Settings::getEnableAlarm() {
 }
 
 void Settings::setEnableAlarm(boolean enableAlarm) {
-    _enableAlarm = enableAlarm;
+    if (_enableAlarm != enableAlarm) {
+        _enableAlarm = enableAlarm;
+        changed(4);
+    }
 }
 
 /**
@@ -104,7 +142,10 @@ boolean Settings::getDcfSignalIsInverted() {
 }
 
 void Settings::setDcfSignalIsInverted(boolean dcfSignalIsInverted) {
-    _dcfSignalIsInverted = dcfSignalIsInverted;
+    if (_dcfSignalIsInverted != dcfSignalIsInverted) {
+        _dcfSignalIsInverted = dcfSignalIsInverted;
+        changed(5);
+    }
 }
 
 /**
@@ -115,54 +156,205 @@ char Settings::getTimeShift() {
 }
 
 void Settings::setTimeShift(char timeShift) {
-    _timeShift = timeShift;
+    if (_timeShift != timeShift) {
+        _timeShift = timeShift;
+        changed(6);
+    }
 }
 
 /**
- * Die Einstellungen laden.
+ * Die Weckzeit in Minuten des Tages.
  */
-void Settings::loadFromEEPROM() {
-    if ((EEPROM.read(0) == SETTINGS_MAGIC_NUMBER) && (EEPROM.read(1) == SETTINGS_VERSION)) {
-        // es sind gueltige Einstellungen vorhanden...
-        _language = EEPROM.read(2);
-        _renderCornersCw = EEPROM.read(3);
-        _use_ldr = EEPROM.read(4);
-        _brightness = EEPROM.read(5);
-        _enableAlarm = EEPROM.read(6);
-        _dcfSignalIsInverted = EEPROM.read(7);
-        _timeShift = EEPROM.read(8);
+word Settings::getAlarmTime() {
+    return _alarmTime;
+}
+
+void Settings::setAlarmTime(word minutesOfDay) {
+    if (_alarmTime != minutesOfDay) {
+        _alarmTime = minutesOfDay;
+        changed(8);
     }
 }
 
 /**
- * Die Einstellungen speichern.
+ * Die Nachtzeiten (Display aus/an) in Minuten des Tages.
  */
-void Settings::saveToEEPROM() {
-    if (EEPROM.read(0) != SETTINGS_MAGIC_NUMBER) {
-        EEPROM.write(0, SETTINGS_MAGIC_NUMBER);
+word Settings::getNightOff() {
+    return _nightOff;
+}
+
+void Settings::setNightOff(word minutesOfDay) {
+    if (_nightOff != minutesOfDay) {
+        _nightOff = minutesOfDay;
+        changed(9);
     }
-    if (EEPROM.read(1) != SETTINGS_VERSION) {
-        EEPROM.write(1, SETTINGS_VERSION);
+}
+
+word Settings::getNightOn() {
+    return _nightOn;
+}
+
+void Settings::setNightOn(word minutesOfDay) {
+    if (_nightOn != minutesOfDay) {
+        _nightOn = minutesOfDay;
+        changed(10);
     }
-    if (EEPROM.read(2) != _language) {
-        EEPROM.write(2, _language);
+}
+
+/**
+ * Die Farbe (fuer RGB-Stripes).
+ */
+byte Settings::getRed() {
+    return _red;
+}
+
+byte Settings::getGreen() {
+    return _green;
+}
+
+byte Settings::getBlue() {
+    return _blue;
+}
+
+void Settings::setColor(byte red, byte green, byte blue) {
+    if ((_red != red) || (_green != green) || (_blue != blue)) {
+        _red = red;
+        _green = green;
+        _blue = blue;
+        changed(11);
     }
-    if (EEPROM.read(3) != _renderCornersCw) {
-        EEPROM.write(3, _renderCornersCw);
+}
+
+/**
+ * Die Einstellungen laden. Gibt es noch keinen Datensatz im EepromLog,
+ * werden die Einstellungen aus dem alten Format uebernommen.
+ */
+void Settings::loadFromEEPROM() {
+    byte data[SETTINGS_SIZE];
+    pack(data);
+    if (eepromLog.read(EEPROMLOG_TYPE_SETTINGS, data, SETTINGS_SIZE) == 0) {
+        if ((EEPROM.read(0) == SETTINGS_MAGIC_NUMBER) && (EEPROM.read(1) == SETTINGS_VERSION)) {
+            for (byte i = 0; i < SETTINGS_SIZE; i++) {
+                data[i] = EEPROM.read(2 + i);
+            }
+        }
     }
-    if (EEPROM.read(4) != _use_ldr) {
-        EEPROM.write(4, _use_ldr);
+    unpack(data);
+
+    byte extra[SETTINGS_EXTRA_SIZE];
+    packExtra(extra);
+    eepromLog.read(EEPROMLOG_TYPE_SETTINGS_EXTRA, extra, SETTINGS_EXTRA_SIZE);
+    unpackExtra(extra);
+
+    if (!Renderer::isLanguageEnabled(_language)) {
+        _language = LANGUAGE_DEFAULT;
     }
-    if (EEPROM.read(5) != _brightness) {
-        EEPROM.write(5, _brightness);
+}
+
+/**
+ * Die Einstellungen jetzt speichern (nur, wenn sie sich geaendert haben).
+ * Das Schreiben selbst erledigt EepromLog::poll() im Hintergrund.
+ */
+void Settings::saveToEEPROM() {
+    // Ohne Aenderung bliebe _saveNow stehen und die naechste Aenderung
+    // ginge ohne SETTINGS_SAVE_DELAY ins EEPROM.
+    _saveNow = (_dirty != 0);
+    poll();
+}
+
+/**
+ * Speichern, wenn seit der letzten Aenderung SETTINGS_SAVE_DELAY ms
+ * vergangen sind. Jedes Mal in loop() aufrufen. Ein geaenderter
+ * Datensatz wird erst angefangen, wenn der vorige geschrieben ist.
+ */
+void Settings::poll() {
+    if ((_dirty == 0) || eepromLog.isBusy()) {
+        return;
     }
-    if (EEPROM.read(6) != _enableAlarm) {
-        EEPROM.write(6, _enableAlarm);
+    if (!_saveNow && (millis() - _lastChange <= SETTINGS_SAVE_DELAY)) {
+        return;
     }
-    if (EEPROM.read(7) != _dcfSignalIsInverted) {
-        EEPROM.write(7, _dcfSignalIsInverted);
+    if (_dirty & SETTINGS_DIRTY) {
+        byte data[SETTINGS_SIZE];
+        pack(data);
+        eepromLog.write(EEPROMLOG_TYPE_SETTINGS, data, SETTINGS_SIZE);
+        _dirty &= ~SETTINGS_DIRTY;
+    } else {
+        byte data[SETTINGS_EXTRA_SIZE];
+        packExtra(data);
+        eepromLog.write(EEPROMLOG_TYPE_SETTINGS_EXTRA, data, SETTINGS_EXTRA_SIZE);
+        _dirty &= ~SETTINGS_DIRTY_EXTRA;
     }
-    if (EEPROM.read(8) != _timeShift) {
-        EEPROM.write(8, _timeShift);
+    _saveNow = (_dirty != 0) && _saveNow;
+}
+
+/**
+ * Ein Wert hat sich geaendert.
+ */
+void Settings::changed(byte field) {
+    _dirty |= (word) 1 << field;
+    _lastChange = millis();
+}
+
+/**
+ * Die Einstellungen in die Bytes des Datensatzes packen
+ * (in der Reihenfolge des alten Formats).
+ */
+void Settings::pack(byte* data) {
+    data[0] = _language;
+    data[1] = _renderCornersCw;
+    data[2] = _use_ldr;
+    data[3] = _brightness;
+    data[4] = _enableAlarm;
+    data[5] = _dcfSignalIsInverted;
+    data[6] = _timeShift;
+}
+
+void Settings::unpack(const byte* data) {
+    _language = data[0];
+    _renderCornersCw = data[1];
+    _use_ldr = data[2];
+    _brightness = data[3];
+    _enableAlarm = data[4];
+    _dcfSignalIsInverted = data[5];
+    _timeShift = data[6];
+}
+
+/**
+ * Der zweite Datensatz: die drei Zeiten mit je 11 Bit (bis 2047 Minuten)
+ * in den Bits 0 bis 32, danach die Farbe ab Byte 5.
+ */
+void Settings::packExtra(byte* data) {
+    for (byte i = 0; i < 5; i++) {
+        data[i] = 0;
+    }
+    setBits(data, 0, 11, _alarmTime);
+    setBits(data, 11, 11, _nightOff);
+    setBits(data, 22, 11, _nightOn);
+    data[5] = _red;
+    data[6] = _green;
+    data[7] = _blue;
+}
+
+void Settings::unpackExtra(const byte* data) {
+    _alarmTime = getBits(data, 0, 11);
+    _nightOff = getBits(data, 11, 11);
+    _nightOn = getBits(data, 22, 11);
+    _red = data[5];
+    _green = data[6];
+    _blue = data[7];
+}
+
+void Settings::setBits(byte* data, byte first, byte length, word value) {
+    for (byte i = 0; i < length; i++) {
+        bitWrite(data[(first + i) >> 3], (first + i) & 7, bitRead(value, i));
+    }
+}
+
+word Settings::getBits(const byte* data, byte first, byte length) {
+    word value = 0;
+    for (byte i = 0; i < length; i++) {
+        bitWrite(value, i, bitRead(data[(first + i) >> 3], (first + i) & 7));
     }
+    return value;
 }
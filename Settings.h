@@ -2,12 +2,16 @@
  * Settings
  * Die vom Benutzer getaetigten Einstellungen werden hier verwaltet
  * und im EEPROM persistiert.
+ * Die Setter merken sich, welche Werte sich geaendert haben. Gespeichert wird
+ * erst, wenn SETTINGS_SAVE_DELAY ms lang nichts mehr geaendert wurde (poll()),
+ * oder sofort mit saveToEEPROM(). Mehrere Tastendruecke ergeben so einen
+ * Schreibvorgang.
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.3
+ * @version  1.7
  * @created  23.1.2013
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -17,12 +21,25 @@
  *         - DcfSignalIsInverted aufgenommen.
  *         - TimeShift aufgenommen.
  * V 1.3:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.4:  - Nicht eingebaute Sprachen aus dem EEPROM auf LANGUAGE_DEFAULT setzen.
+ * V 1.5:  - Im EepromLog statt an festen Adressen, das alte Format wird uebernommen.
+ * V 1.6:  - Geaenderte Werte merken und erst SETTINGS_SAVE_DELAY ms nach der letzten Aenderung
+ *           gesammelt speichern (poll()).
+ * V 1.7:  - Weckzeit, Nachtzeiten und Farbe aufgenommen (gepackt in einem zweiten Datensatz).
  */
 #ifndef SETTINGS_H
 #define SETTINGS_H
 
 #include "Arduino.h"
 
+#define SETTINGS_SAVE_DELAY 3000
+
+// Defaults in Minuten des Tages: Wecker um 7 Uhr, Display von 3 bis 4:30 Uhr aus
+// (beide Nachtzeiten 0 = nie abschalten).
+#define SETTINGS_ALARM_TIME (7 * 60)
+#define SETTINGS_NIGHT_OFF  (3 * 60)
+#define SETTINGS_NIGHT_ON   (4 * 60 + 30)
+
 class Settings {
 public:
     Settings();
@@ -48,8 +65,22 @@ public:
     char getTimeShift();
     void setTimeShift(char timeShift);
 
+    word getAlarmTime();
+    void setAlarmTime(word minutesOfDay);
+
+    word getNightOff();
+    void setNightOff(word minutesOfDay);
+    word getNightOn();
+    void setNightOn(word minutesOfDay);
+
+    byte getRed();
+    byte getGreen();
+    byte getBlue();
+    void setColor(byte red, byte green, byte blue);
+
     void loadFromEEPROM();
     void saveToEEPROM();
+    void poll();
 
 private:
     byte _language;
@@ -59,6 +90,26 @@ private:
     boolean _enableAlarm;
     boolean _dcfSignalIsInverted;
     char _timeShift;
+    word _alarmTime;
+    word _nightOff;
+    word _nightOn;
+    byte _red;
+    byte _green;
+    byte _blue;
+
+    // geaenderte Werte (Bits 0-7: erster Datensatz, 8-15: zweiter) und wann zuletzt
+    word _dirty;
+    unsigned long _lastChange;
+    // beim naechsten poll() ohne Verzoegerung speichern
+    boolean _saveNow;
+
+    void changed(byte field);
+    void packExtra(byte* data);
+    void unpackExtra(const byte* data);
+    static void setBits(byte* data, byte first, byte length, word value);
+    static word getBits(const byte* data, byte first, byte length);
+    void pack(byte* data);
+    void unpack(const byte* data);
 };
 
 #endif
@@ -6,9 +6,9 @@
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
  * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
- * @version  2.0
+ * @version  2.2
  * @created  24.02.2011
- * @updated  22.11.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.1:  - Schnelle DigitalWrite-Methoden eingefuehrt.
@@ -22,6 +22,10 @@
  * V 1.7:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
  * V 2.0:  - Rewrite. Langsame Membervariablen durch C++-Template Konstanten ersetzt für bessere Optimierung 
  *           durch Compiler. shiftOut() mittels Toggling beschleunigt. Unbenutzte Funktionen entfernt.
+ * V 2.1:  - Ausgabe ueber Hardware-SPI (SHIFTREGISTER_SPI) bzw. USART im SPI-Modus
+ *           (SHIFTREGISTER_USART_SPI). latch() fuer vorab geschobene Daten eingefuehrt.
+ * V 2.2:  - Pins und SPI/USART werden in begin() statt im Konstruktor eingestellt. init() des
+ *           Arduino-Kerns laeuft nach den Konstruktoren und setzt UCSR0B zurueck.
  */
 #ifndef SHIFTREGISTER_H
 #define SHIFTREGISTER_H
@@ -33,6 +37,117 @@
 #include "Debug.h"
 
 
+#if defined(SHIFTREGISTER_SPI) || defined(SHIFTREGISTER_USART_SPI)
+  // Die Hardware schiebt selbst, die Daten koennen vorab geschoben und spaeter per latch() uebernommen werden.
+  #define SHIFTREGISTER_HARDWARE
+#endif
+
+#ifdef SHIFTREGISTER_HARDWARE
+/**
+ * Ausgabe ueber die SPI-Hardware. dataPin und clockPin muessen dann
+ * MOSI/SCK (D11/D13) bzw. TXD/XCK (D1/D4) sein.
+ * Die Bytes gehen wie beim Bit-Banging mit dem niederwertigsten Bit zuerst
+ * raus. Gewartet wird erst vor dem naechsten Byte, das Schieben laeuft
+ * also parallel zum Rest des Programms.
+ */
+template <uint32_t dataPin, uint32_t clockPin, uint32_t latchPin>
+class ShiftRegister 
+{
+  public:
+
+  /**
+   * Initialisierung mit den Pins fuer Serial-Data, Serial-Clock und Store-Clock (Latch).
+   * Erst aus setup() heraus aufrufen, init() des Arduino-Kerns stellt die USART ab.
+   */
+  static void begin() {
+    DEBUG_PRINTLN(F("ShiftRegister initialization (hardware)."));
+    DEBUG_FLUSH();
+
+    DPIN_OUTPUT(dataPin);
+    DPIN_OUTPUT(clockPin);
+    DPIN_OUTPUT(latchPin);
+#ifdef SHIFTREGISTER_SPI
+    // SS muss Ausgang sein, sonst faellt die SPI in den Slave-Modus.
+    DDRB |= _BV(DDB2);
+    // Master, Modus 0, LSB zuerst, F_CPU/2
+    SPCR = _BV(SPE) | _BV(MSTR) | _BV(DORD);
+    SPSR = _BV(SPI2X);
+#else
+    // USART0 als SPI-Master, Modus 0, LSB zuerst, F_CPU/2
+    UBRR0 = 0;
+    UCSR0C = _BV(UMSEL01) | _BV(UMSEL00) | _BV(UDORD0);
+    UCSR0B = _BV(TXEN0);
+    UBRR0 = 0;
+#endif
+    _busy = false;
+  }
+
+  /**
+   * Ein WORD (16 Bit) ausgeben
+   */
+  static void shiftOut(word data) {
+    writeByte(lowByte(data));
+    writeByte(highByte(data));
+  }
+
+  /**
+   * Vorbereitung fuer die Ausgabe
+   */
+  static void prepareShiftregisterWrite() {
+    DPIN_LOW(latchPin);
+  }
+
+  /**
+   * Abschliessen der Ausgabe
+   */
+  static void finishShiftregisterWrite() {
+    waitForTransfer();
+    DPIN_HIGH(latchPin);
+  }
+
+  /**
+   * Die zuvor (ohne prepare/finish) geschobenen Daten uebernehmen.
+   */
+  static void latch() {
+    waitForTransfer();
+    DPIN_LOW(latchPin);
+    DPIN_HIGH(latchPin);
+  }
+
+  private:
+
+  static void writeByte(byte data) {
+#ifdef SHIFTREGISTER_SPI
+    waitForTransfer();
+    SPDR = data;
+#else
+    while (!(UCSR0A & _BV(UDRE0)));
+    // TXC0 loeschen, damit waitForTransfer() auf dieses Byte wartet.
+    UCSR0A = _BV(TXC0);
+    UDR0 = data;
+#endif
+    _busy = true;
+  }
+
+  static void waitForTransfer() {
+    if (_busy) {
+#ifdef SHIFTREGISTER_SPI
+      while (!(SPSR & _BV(SPIF)));
+#else
+      while (!(UCSR0A & _BV(TXC0)));
+#endif
+      _busy = false;
+    }
+  }
+
+  static volatile boolean _busy;
+};
+
+template <uint32_t dataPin, uint32_t clockPin, uint32_t latchPin>
+volatile boolean ShiftRegister<dataPin, clockPin, latchPin>::_busy;
+
+#else
+
 template <uint32_t dataPin, uint32_t clockPin, uint32_t latchPin>
 class ShiftRegister 
 {
@@ -41,7 +156,7 @@ class ShiftRegister
   /**
    * Initialisierung mit den Pins fuer Serial-Data, Serial-Clock und Store-Clock (Latch)
    */
-  ShiftRegister() {
+  static void begin() {
     DEBUG_PRINTLN(F("ShiftRegister initialization."));
     DEBUG_FLUSH();
 
@@ -80,7 +195,17 @@ class ShiftRegister
     DPIN_HIGH(latchPin);
   }
 
+  /**
+   * Die zuvor (ohne prepare/finish) geschobenen Daten uebernehmen.
+   */
+  static void latch() {
+    DPIN_LOW(latchPin);
+    DPIN_HIGH(latchPin);
+  }
+
 };
 
 #endif
 
+#endif
+
@@ -6,9 +6,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.7
+ * @version  1.9
  * @created  2.3.2011
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.1:  - Fehler in toString() behoben.
@@ -18,12 +18,23 @@
  * V 1.5:  - Optimierung hinsichtlich Speicherbedarf.
  * V 1.6:  - Verbessertes Debugging & leeren Konstruktor entfernt.
  * V 1.7:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.8:  - Kalender (constexpr): Schaltjahre, Tage und Minuten seit 2000, Wochentag,
+ *           Sommerzeit nach EU- oder US-Regel mit Abstand zu UTC.
+ * V 1.9:  - asString() mit strcat() statt strncat().
  */
 #include "TimeStamp.h"
 
 // #define DEBUG
 #include "Debug.h"
 
+// Stichproben fuer den Kalender, schon beim Kompilieren geprueft.
+static_assert(TimeStamp::dayOfWeek(1, 1, 0) == 6, "1.1.2000 war ein Samstag");
+static_assert(TimeStamp::daysSince2000(1, 1, 1) == 366, "2000 war ein Schaltjahr");
+static_assert(TimeStamp::lastSunday(3, 26) == 29, "Sommerzeit 2026 ab 29.3.");
+static_assert(TimeStamp::lastSunday(10, 26) == 25, "Sommerzeit 2026 bis 25.10.");
+static_assert(TimeStamp::nthSunday(2, 3, 26) == 8, "US-Sommerzeit 2026 ab 8.3.");
+static_assert(TimeStamp::nthSunday(1, 11, 26) == 1, "US-Sommerzeit 2026 bis 1.11.");
+
 TimeStamp::TimeStamp(byte minutes, byte hours, byte date, byte dayOfWeek, byte month, byte year) {
     set(minutes, hours, date, dayOfWeek, month, year);
 }
@@ -135,38 +146,38 @@ char* TimeStamp::asString() {
     // build the string...
     if (_hours < 10) {
         sprintf(temp, "0%d:", _hours);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     } else {
         sprintf(temp, "%d:", _hours);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     }
 
     if (_minutes < 10) {
         sprintf(temp, "0%d ", _minutes);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     } else {
         sprintf(temp, "%d ", _minutes);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     }
 
     if (_date < 10) {
         sprintf(temp, "0%d.", _date);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     } else {
         sprintf(temp, "%d.", _date);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     }
 
     if (_month < 10) {
         sprintf(temp, "0%d.", _month);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     } else {
         sprintf(temp, "%d.", _month);
-        strncat(_cDateTime, temp, strlen(temp));
+        strcat(_cDateTime, temp);
     }
 
     sprintf(temp, "%d", _year);
-    strncat(_cDateTime, temp, strlen(temp));
+    strcat(_cDateTime, temp);
 
     return _cDateTime;
 }
@@ -4,11 +4,15 @@
  * Zeiten aus der Echtzeituhr und von dem DCF77-Empfaenger
  * leichter verarbeiten und vergleichen.
  *
+ * Dazu ein kleiner Kalender fuer die Jahre 2000 bis 2099 (year = 0..99, dort ist
+ * jedes vierte Jahr ein Schaltjahr). Alle Funktionen sind constexpr, mit
+ * Konstanten rechnet sie der Compiler aus.
+ *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.7
+ * @version  1.8
  * @created  2.3.2011
- * @updated  16.2.2015
+ * @updated  17.10.2026
  *
  * Versionshistorie:
  * V 1.1:  - Fehler in toString() behoben.
@@ -18,6 +22,8 @@
  * V 1.5:  - Optimierung hinsichtlich Speicherbedarf.
  * V 1.6:  - Verbessertes Debugging & leeren Konstruktor entfernt.
  * V 1.7:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.8:  - Kalender (constexpr): Schaltjahre, Tage und Minuten seit 2000, Wochentag,
+ *           Sommerzeit nach EU- oder US-Regel mit Abstand zu UTC.
  */
 #ifndef TIMESTAMP_H
 #define TIMESTAMP_H
@@ -26,6 +32,13 @@
 #include "MyDCF77.h"
 #include "MyRTC.h"
 
+// Die Regeln fuer die Sommerzeit
+#define TIMESTAMP_DST_NONE 0
+// letzter Sonntag im Maerz bis letzter Sonntag im Oktober, jeweils 1:00 Uhr UTC
+#define TIMESTAMP_DST_EU   1
+// zweiter Sonntag im Maerz bis erster Sonntag im November, jeweils 2:00 Uhr Ortszeit
+#define TIMESTAMP_DST_US   2
+
 class TimeStamp {
 public:
     TimeStamp(byte minutes, byte hours, byte date, byte dayOfWeek, byte month, byte year);
@@ -51,6 +64,61 @@ public:
 
     char* asString();
 
+    static constexpr boolean isLeapYear(byte year) {
+        return (year & 3) == 0;
+    }
+
+    static constexpr byte daysInMonth(byte month, byte year) {
+        return (month == 2) ? 28 + isLeapYear(year) : 30 + ((month + (month >> 3)) & 1);
+    }
+
+    // Die Tage des Jahres vor dem Ersten des Monats.
+    static constexpr word daysBeforeMonth(byte month, byte year) {
+        return ((month < 2) || (month > 12)) ? 0 : (month - 1) * 30 + (month + (month >> 3)) / 2 - ((month > 2) ? 2 - isLeapYear(year) : 0);
+    }
+
+    // Die Tage seit dem 1.1.2000.
+    static constexpr word daysSince2000(byte date, byte month, byte year) {
+        return (word) year * 365 + (year + 3) / 4 + daysBeforeMonth(month, year) + date - 1;
+    }
+
+    // Die Minuten seit dem 1.1.2000, 0:00 Uhr.
+    static constexpr unsigned long minutesSince2000(byte minutes, byte hours, byte date, byte month, byte year) {
+        return (unsigned long) daysSince2000(date, month, year) * 1440 + hours * 60 + minutes;
+    }
+
+    // 1 = Montag ... 7 = Sonntag (wie bei DCF77), der 1.1.2000 war ein Samstag.
+    static constexpr byte dayOfWeek(byte date, byte month, byte year) {
+        return (daysSince2000(date, month, year) + 5) % 7 + 1;
+    }
+
+    static constexpr byte lastSunday(byte month, byte year) {
+        return daysInMonth(month, year) - dayOfWeek(daysInMonth(month, year), month, year) % 7;
+    }
+
+    static constexpr byte nthSunday(byte n, byte month, byte year) {
+        return 1 + (7 - dayOfWeek(1, month, year)) % 7 + 7 * (n - 1);
+    }
+
+    // Beginn und Ende der Sommerzeit in Minuten seit 2000, gerechnet in
+    // Normalzeit (UTC + utcOffset Minuten).
+    static constexpr unsigned long summerTimeBegins(byte rule, byte year, int utcOffset) {
+        return (rule == TIMESTAMP_DST_EU) ? minutesSince2000(0, 1, lastSunday(3, year), 3, year) + utcOffset
+            : (rule == TIMESTAMP_DST_US) ? minutesSince2000(0, 2, nthSunday(2, 3, year), 3, year)
+            : 0;
+    }
+
+    static constexpr unsigned long summerTimeEnds(byte rule, byte year, int utcOffset) {
+        return (rule == TIMESTAMP_DST_EU) ? minutesSince2000(0, 1, lastSunday(10, year), 10, year) + utcOffset
+            : (rule == TIMESTAMP_DST_US) ? minutesSince2000(0, 1, nthSunday(1, 11, year), 11, year)
+            : 0;
+    }
+
+    // Gilt zur Normalzeit standardMinutes (Minuten seit 2000) die Sommerzeit?
+    static constexpr boolean isSummerTime(byte rule, unsigned long standardMinutes, byte year, int utcOffset) {
+        return (standardMinutes >= summerTimeBegins(rule, year, utcOffset)) && (standardMinutes < summerTimeEnds(rule, year, utcOffset));
+    }
+
 private:
     byte _minutes;
     byte _hours;
@@ -0,0 +1,165 @@
+/**
+ * Transition
+ * Uebergaenge zwischen zwei Bildschirminhalten (Ueberblenden, Wischen,
+ * Buchstabe fuer Buchstabe, Matrix-Regen). Jeder Modus kann einen
+ * Uebergang anfordern, die Schritte werden in einen FrameBuffer gerendert.
+ *
+ * Rechenzeit pro Schritt: 120 Pixel mit je einem Aufruf von pixelAt()
+ * und setPixel(), unabhaengig vom Uebergang.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "Transition.h"
+
+// #define DEBUG
+#include "Debug.h"
+
+// Maximale Startverzoegerung einer Spalte beim Matrix-Regen (in Schritten).
+#define TRANSITION_RAIN_MAX_DELAY 3
+// Helligkeit der Spur ueber einem fallenden Tropfen.
+#define TRANSITION_RAIN_TRAIL 5
+
+Transition::Transition() {
+    _type = TRANSITION_NONE;
+    _step = 0;
+    _steps = 0;
+    for (byte y = 0; y < FRAMEBUFFER_ROWS; y++) {
+        _from[y] = 0;
+        _to[y] = 0;
+    }
+}
+
+/**
+ * Einen Uebergang vom aktuellen Inhalt (dem Ziel des letzten Uebergangs)
+ * zu 'matrix' starten. Ein laufender Uebergang wird abgebrochen.
+ *
+ * @return FALSE, wenn sich der Inhalt nicht geaendert hat (dann passiert nichts).
+ */
+boolean Transition::start(byte type, word matrix[16]) {
+    boolean changed = false;
+    for (byte y = 0; y < FRAMEBUFFER_ROWS; y++) {
+        if (_to[y] != matrix[y]) {
+            changed = true;
+        }
+    }
+    if (!changed) {
+        return false;
+    }
+
+    byte diff = 0;
+    for (byte y = 0; y < FRAMEBUFFER_ROWS; y++) {
+        _from[y] = _to[y];
+        _to[y] = matrix[y];
+        for (byte x = 0; x < FRAMEBUFFER_COLS; x++) {
+            if ((_from[y] ^ _to[y]) & FrameBuffer::columnMask(x)) {
+                diff++;
+            }
+        }
+    }
+
+    _type = type;
+    _step = 0;
+    switch (type) {
+        case TRANSITION_CROSSFADE:
+            _steps = FRAMEBUFFER_MAX + 1;
+            break;
+        case TRANSITION_WIPE:
+            _steps = FRAMEBUFFER_COLS + 1;
+            break;
+        case TRANSITION_LETTERS:
+            _steps = diff + 1;
+            break;
+        case TRANSITION_RAIN:
+            _steps = FRAMEBUFFER_ROWS + TRANSITION_RAIN_MAX_DELAY + 2;
+            break;
+        default:
+            _steps = 1;
+            break;
+    }
+
+    DEBUG_PRINT(F("Transition "));
+    DEBUG_PRINT(type);
+    DEBUG_PRINT(F(" with steps: "));
+    DEBUG_PRINTLN(_steps);
+    return true;
+}
+
+/**
+ * Sind noch Schritte zu rendern?
+ */
+boolean Transition::isRunning() {
+    return _step < _steps;
+}
+
+/**
+ * Den naechsten Schritt rendern. Der letzte Schritt zeigt immer das Ziel.
+ */
+void Transition::nextStep(FrameBuffer* frameBuffer) {
+    if (!isRunning()) {
+        return;
+    }
+    byte n = 0; // laufende Nummer der geaenderten Pixel (fuer TRANSITION_LETTERS)
+    for (byte y = 0; y < FRAMEBUFFER_ROWS; y++) {
+        for (byte x = 0; x < FRAMEBUFFER_COLS; x++) {
+            frameBuffer->setPixel(x, y, pixelAt(x, y, n));
+            if ((_from[y] ^ _to[y]) & FrameBuffer::columnMask(x)) {
+                n++;
+            }
+        }
+    }
+    _step++;
+}
+
+/**
+ * Die Helligkeit eines Pixels im aktuellen Schritt.
+ *
+ * @param n Die Nummer des Pixels unter den geaenderten (in Lesereihenfolge).
+ */
+byte Transition::pixelAt(byte x, byte y, byte n) {
+    word mask = FrameBuffer::columnMask(x);
+    byte from = (_from[y] & mask) ? FRAMEBUFFER_MAX : 0;
+    byte to = (_to[y] & mask) ? FRAMEBUFFER_MAX : 0;
+
+    if (_step == _steps - 1) {
+        return to;
+    }
+
+    if (_type == TRANSITION_RAIN) {
+        // Jede Spalte faellt mit eigener Verzoegerung, ueber dem Tropfen steht schon das Ziel.
+        int head = _step - ((x * 5 + 3) % (TRANSITION_RAIN_MAX_DELAY + 1));
+        if (y == head) {
+            return FRAMEBUFFER_MAX;
+        }
+        if (y == head - 1) {
+            return to ? to : TRANSITION_RAIN_TRAIL;
+        }
+        return (y < head) ? to : from;
+    }
+
+    if (from == to) {
+        return to;
+    }
+
+    switch (_type) {
+        case TRANSITION_CROSSFADE:
+            return from ? FRAMEBUFFER_MAX - _step : _step;
+        case TRANSITION_WIPE:
+            if (x < _step) {
+                return to;
+            }
+            if (x == _step) {
+                return FRAMEBUFFER_MAX / 2;
+            }
+            return from;
+        case TRANSITION_LETTERS:
+            return (n < _step) ? to : from;
+        default:
+            return to;
+    }
+}
@@ -0,0 +1,50 @@
+/**
+ * Transition
+ * Uebergaenge zwischen zwei Bildschirminhalten (Ueberblenden, Wischen,
+ * Buchstabe fuer Buchstabe, Matrix-Regen). Jeder Modus kann einen
+ * Uebergang anfordern, die Schritte werden in einen FrameBuffer gerendert.
+ *
+ * RAM-Budget (ATmega328P, 2 KB):
+ *   Transition:  2 * 10 words (von/nach) + 3 Bytes Zustand = 43 Bytes
+ *   FrameBuffer: 60 Bytes (im Hauptprogramm)
+ *   LedDriverBAM: 2 * 60 Bytes (doppelter Puffer) + 16 Bytes Bitebenen + 16 Bytes Leuchtdauern
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include "Arduino.h"
+#include "FrameBuffer.h"
+
+#define TRANSITION_NONE      0
+#define TRANSITION_CROSSFADE 1
+#define TRANSITION_WIPE      2
+#define TRANSITION_LETTERS   3
+#define TRANSITION_RAIN      4
+
+class Transition {
+public:
+    Transition();
+
+    boolean start(byte type, word matrix[16]);
+    boolean isRunning();
+    void nextStep(FrameBuffer* frameBuffer);
+
+private:
+    byte _type;
+    byte _step;
+    byte _steps;
+    word _from[FRAMEBUFFER_ROWS];
+    word _to[FRAMEBUFFER_ROWS];
+
+    byte pixelAt(byte x, byte y, byte n);
+};
+
+#endif
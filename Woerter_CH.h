@@ -1,56 +1,95 @@
 /**
  * Woerter_CH
  * Definition der schweizerischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
- *
- *   01234567890
- * 0 ESKISCHAFÜF
- * 1 VIERTUBFZÄÄ
- * 2 ZWÄNZGSIVOR
- * 3 ABOHAUBIEGE
- * 4 EISZWÖISDRÜ
- * 5 VIERIFÜFIQT
- * 6 SÄCHSISIBNI
- * 7 ACHTINÜNIEL
- * 8 ZÄNIERBEUFI
- * 9 ZWÖUFINAUHR
+ * Die Woerter sind Indizes in die Tabelle CH_WORDS (Zeile, Startspalte, Laenge).
  *
  * @mc       Arduino/RBBB
  * @autor    Thomas Schuler / thomas.schuler _AT_ vtg _DOT_ admin _DOT_ ch (Basis)
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com (Anpassung)
- * @version  1.1
+ * @version  1.4
  * @created  18.3.2012
- * @updated  4.4.2013
+ * @updated  18.10.2026
  *
  * Version 1.1: - Layoutanpassung
+ * Version 1.2: - Woerter als Tabelle im PROGMEM fuer den Renderer.
+ * Version 1.3: - Woerter als Zeile, Startspalte und Laenge.
+ * Version 1.4: - Tabelle aus layouts/CH.txt erzeugt (tools/woerter.cmake).
  */
 #ifndef WOERTER_CH_H
 #define WOERTER_CH_H
 
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Renderer.h"
+
 /**
  * Definition der Woerter
  */
-#define CH_VOR          matrix[2] |= 0b0000000011100000
-#define CH_AB           matrix[3] |= 0b1100000000000000
-#define CH_ESISCH       matrix[0] |= 0b1101111000000000
+#define CH_VOR          1
+#define CH_AB           2
+#define CH_ESISCH       3
+
+#define CH_FUEF         5
+#define CH_ZAEAE        6
+#define CH_VIERTU       7
+#define CH_ZWAENZG      8
+#define CH_HAUBI        9
 
-#define CH_FUEF         matrix[0] |= 0b0000000011100000
-#define CH_ZAEAE        matrix[1] |= 0b0000000011100000
-#define CH_VIERTU       matrix[1] |= 0b1111110000000000
-#define CH_ZWAENZG      matrix[2] |= 0b1111110000000000
-#define CH_HAUBI        matrix[3] |= 0b0001111100000000
+#define CH_H_EIS        10
+#define CH_H_ZWOEI      11
+#define CH_H_DRUE       12
+#define CH_H_VIER       13
+#define CH_H_FUEFI      14
+#define CH_H_SAECHSI    15
+#define CH_H_SIEBNI     16
+#define CH_H_ACHTI      17
+#define CH_H_NUENI      18
+#define CH_H_ZAENI      19
+#define CH_H_EUFI       20
+#define CH_H_ZWOEUFI    21
 
-#define CH_H_EIS        matrix[4] |= 0b1110000000000000
-#define CH_H_ZWOEI      matrix[4] |= 0b0001111000000000
-#define CH_H_DRUE       matrix[4] |= 0b0000000011100000
-#define CH_H_VIER       matrix[5] |= 0b1111100000000000
-#define CH_H_FUEFI      matrix[5] |= 0b0000011110000000
-#define CH_H_SAECHSI    matrix[6] |= 0b1111110000000000
-#define CH_H_SIEBNI     matrix[6] |= 0b0000001111100000
-#define CH_H_ACHTI      matrix[7] |= 0b1111100000000000
-#define CH_H_NUENI      matrix[7] |= 0b0000011110000000
-#define CH_H_ZAENI      matrix[8] |= 0b1111000000000000
-#define CH_H_EUFI       matrix[8] |= 0b0000000111100000
-#define CH_H_ZWOEUFI    matrix[9] |= 0b1111110000000000
+/**
+ * Die Woerter als Zeile, Startspalte und Laenge. Index 0 ist 'kein Wort'.
+ * Woerter aus mehreren Teilen (z.B. ES IST) haben WORD_MORE bis auf den letzten Teil.
+ *
+ *   01234567890
+ * 0 ESKISCHAFÜF
+ * 1 VIERTUBFZÄÄ
+ * 2 ZWÄNZGSIVOR
+ * 3 ABOHAUBIEGE
+ * 4 EISZWÖISDRÜ
+ * 5 VIERIFÜFIQT
+ * 6 SÄCHSISIBNI
+ * 7 ACHTINÜNIEL
+ * 8 ZÄNIERBEUFI
+ * 9 ZWÖUFINAUHR
+ *
+ * Erzeugt mit tools/woerter.cmake aus layouts/CH.txt, nicht von Hand aendern.
+ */
+extern const word CH_WORDS[] PROGMEM;
+const word CH_WORDS[] = {
+    0,
+    WORD_LAYOUT(2,  8,  3),              // VOR
+    WORD_LAYOUT(3,  0,  2),              // AB
+    WORD_LAYOUT(0,  0,  2) | WORD_MORE,  // ESISCH
+    WORD_LAYOUT(0,  3,  4),
+    WORD_LAYOUT(0,  8,  3),              // FUEF
+    WORD_LAYOUT(1,  8,  3),              // ZAEAE
+    WORD_LAYOUT(1,  0,  6),              // VIERTU
+    WORD_LAYOUT(2,  0,  6),              // ZWAENZG
+    WORD_LAYOUT(3,  3,  5),              // HAUBI
+    WORD_LAYOUT(4,  0,  3),              // H_EIS
+    WORD_LAYOUT(4,  3,  4),              // H_ZWOEI
+    WORD_LAYOUT(4,  8,  3),              // H_DRUE
+    WORD_LAYOUT(5,  0,  5),              // H_VIER
+    WORD_LAYOUT(5,  5,  4),              // H_FUEFI
+    WORD_LAYOUT(6,  0,  6),              // H_SAECHSI
+    WORD_LAYOUT(6,  6,  5),              // H_SIEBNI
+    WORD_LAYOUT(7,  0,  5),              // H_ACHTI
+    WORD_LAYOUT(7,  5,  4),              // H_NUENI
+    WORD_LAYOUT(8,  0,  4),              // H_ZAENI
+    WORD_LAYOUT(8,  7,  4),              // H_EUFI
+    WORD_LAYOUT(9,  0,  6)               // H_ZWOEUFI
+};
 
 #endif
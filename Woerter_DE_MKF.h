@@ -3,7 +3,58 @@
  * Definition der deutschen Woerter fuer die Zeitansage.
  * Hier in einer anderen Variante nach der Matix von Gerog M.
  * Sie entspricht dem Layout aus dem Mikrocontroller.net
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle DE_WORDS (Zeile, Startspalte, Laenge).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.3
+ * @created  28.10.2012
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.1:  - Woerter als Tabelle im PROGMEM fuer den Renderer.
+ * V 1.2:  - Woerter als Zeile, Startspalte und Laenge.
+ * V 1.3:  - Tabelle aus layouts/DE_MKF.txt erzeugt (tools/woerter.cmake).
+ */
+#ifndef WOERTER_DE_H
+#define WOERTER_DE_H
+
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Renderer.h"
+
+/**
+ * Definition der Woerter
+ */
+#define DE_VOR          1
+#define DE_NACH         2
+#define DE_ESIST        3
+#define DE_UHR          5
+
+#define DE_FUENF        6
+#define DE_ZEHN         7
+#define DE_VIERTEL      8
+#define DE_ZWANZIG      9
+#define DE_HALB         10
+#define DE_DREIVIERTEL  11
+
+#define DE_H_EIN        12
+#define DE_H_EINS       13
+#define DE_H_ZWEI       14
+#define DE_H_DREI       15
+#define DE_H_VIER       16
+#define DE_H_FUENF      17
+#define DE_H_SECHS      18
+#define DE_H_SIEBEN     19
+#define DE_H_ACHT       20
+#define DE_H_NEUN       21
+#define DE_H_ZEHN       22
+#define DE_H_ELF        23
+#define DE_H_ZWOELF     24
+
+/**
+ * Die Woerter als Zeile, Startspalte und Laenge. Index 0 ist 'kein Wort'.
+ * Woerter aus mehreren Teilen (z.B. ES IST) haben WORD_MORE bis auf den letzten Teil.
  *
  *   01234567890
  * 0 ESKISTLFUNF
@@ -17,41 +68,35 @@
  * 8 WACHTZEHNRS
  * 9 BSECHSFMUHR
  *
- * @mc       Arduino/RBBB
- * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
- * @created  28.10.2012
- */
-#ifndef WOERTER_DE_H
-#define WOERTER_DE_H
-
-/**
- * Definition der Woerter
+ * Erzeugt mit tools/woerter.cmake aus layouts/DE_MKF.txt, nicht von Hand aendern.
  */
-#define DE_VOR          matrix[3] |= 0b0000001110000000
-#define DE_NACH         matrix[3] |= 0b0011110000000000
-#define DE_ESIST        matrix[0] |= 0b1101110000000000
-#define DE_UHR          matrix[9] |= 0b0000000011100000
-
-#define DE_FUENF        matrix[0] |= 0b0000000111100000
-#define DE_ZEHN         matrix[1] |= 0b1111000000000000
-#define DE_VIERTEL      matrix[2] |= 0b0000111111100000
-#define DE_ZWANZIG      matrix[1] |= 0b0000111111100000
-#define DE_HALB         matrix[4] |= 0b1111000000000000
-#define DE_DREIVIERTEL  matrix[2] |= 0b1111111111100000
-
-#define DE_H_EIN        matrix[5] |= 0b0011100000000000
-#define DE_H_EINS       matrix[5] |= 0b0011110000000000
-#define DE_H_ZWEI       matrix[5] |= 0b1111000000000000
-#define DE_H_DREI       matrix[6] |= 0b0111100000000000
-#define DE_H_VIER       matrix[7] |= 0b0000000111100000
-#define DE_H_FUENF      matrix[6] |= 0b0000000111100000
-#define DE_H_SECHS      matrix[9] |= 0b0111110000000000
-#define DE_H_SIEBEN     matrix[5] |= 0b0000011111100000
-#define DE_H_ACHT       matrix[8] |= 0b0111100000000000
-#define DE_H_NEUN       matrix[7] |= 0b0001111000000000
-#define DE_H_ZEHN       matrix[8] |= 0b0000011110000000
-#define DE_H_ELF        matrix[7] |= 0b1110000000000000
-#define DE_H_ZWOELF     matrix[4] |= 0b0000011111000000
+extern const word DE_WORDS[] PROGMEM;
+const word DE_WORDS[] = {
+    0,
+    WORD_LAYOUT(3,  6,  3),              // VOR
+    WORD_LAYOUT(3,  2,  4),              // NACH
+    WORD_LAYOUT(0,  0,  2) | WORD_MORE,  // ESIST
+    WORD_LAYOUT(0,  3,  3),
+    WORD_LAYOUT(9,  8,  3),              // UHR
+    WORD_LAYOUT(0,  7,  4),              // FUENF
+    WORD_LAYOUT(1,  0,  4),              // ZEHN
+    WORD_LAYOUT(2,  4,  7),              // VIERTEL
+    WORD_LAYOUT(1,  4,  7),              // ZWANZIG
+    WORD_LAYOUT(4,  0,  4),              // HALB
+    WORD_LAYOUT(2,  0, 11),              // DREIVIERTEL
+    WORD_LAYOUT(5,  2,  3),              // H_EIN
+    WORD_LAYOUT(5,  2,  4),              // H_EINS
+    WORD_LAYOUT(5,  0,  4),              // H_ZWEI
+    WORD_LAYOUT(6,  1,  4),              // H_DREI
+    WORD_LAYOUT(7,  7,  4),              // H_VIER
+    WORD_LAYOUT(6,  7,  4),              // H_FUENF
+    WORD_LAYOUT(9,  1,  5),              // H_SECHS
+    WORD_LAYOUT(5,  5,  6),              // H_SIEBEN
+    WORD_LAYOUT(8,  1,  4),              // H_ACHT
+    WORD_LAYOUT(7,  3,  4),              // H_NEUN
+    WORD_LAYOUT(8,  5,  4),              // H_ZEHN
+    WORD_LAYOUT(7,  0,  3),              // H_ELF
+    WORD_LAYOUT(4,  5,  5)               // H_ZWOELF
+};
 
 #endif
@@ -1,56 +1,101 @@
 /**
  * Woerter_EN
  * Definition der englischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
- *
- *   01234567890
- * 0 ITLISASTIME
- * 1 ACQUARTERDC
- * 2 TWENTYFIFEX
- * 3 HALFBTENFTO
- * 4 PASTERUNINE
- * 5 ONESIXTHREE
- * 6 FOURFIVETWO
- * 7 EIGHTELEVEN
- * 8 SEVENTWELVE
- * 9 TENSEOCLOCK
+ * Die Woerter sind Indizes in die Tabelle EN_WORDS (Zeile, Startspalte, Laenge).
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
+ * @version  1.3
  * @created  17.12.2012
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.1:  - Woerter als Tabelle im PROGMEM fuer den Renderer.
+ * V 1.2:  - Woerter als Zeile, Startspalte und Laenge.
+ * V 1.3:  - Tabelle aus layouts/EN.txt erzeugt (tools/woerter.cmake).
  */
 #ifndef WOERTER_EN_H
 #define WOERTER_EN_H
 
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Renderer.h"
+
 /**
  * Definition der Woerter.
  */
 
-#define EN_ITIS     matrix[0] |= 0b1101100000000000
-#define EN_TIME     matrix[0] |= 0b0000000111100000
-#define EN_A        matrix[1] |= 0b1000000000000000
-#define EN_OCLOCK   matrix[9] |= 0b0000011111100000
+#define EN_ITIS     1
+#define EN_TIME     3
+#define EN_A        4
+#define EN_OCLOCK   5
+
+#define EN_QUATER   6
+#define EN_TWENTY   7
+#define EN_FIVE     8
+#define EN_HALF     9
+#define EN_TEN      10
+#define EN_TO       11
+#define EN_PAST     12
 
-#define EN_QUATER   matrix[1] |= 0b0011111110000000
-#define EN_TWENTY   matrix[2] |= 0b1111110000000000
-#define EN_FIVE     matrix[2] |= 0b0000001111000000
-#define EN_HALF     matrix[3] |= 0b1111000000000000
-#define EN_TEN      matrix[3] |= 0b0000011100000000
-#define EN_TO       matrix[3] |= 0b0000000001100000
-#define EN_PAST     matrix[4] |= 0b1111000000000000
+#define EN_H_NINE   13
+#define EN_H_ONE    14
+#define EN_H_SIX    15
+#define EN_H_THREE  16
+#define EN_H_FOUR   17
+#define EN_H_FIVE   18
+#define EN_H_TWO    19
+#define EN_H_EIGHT  20
+#define EN_H_ELEVEN 21
+#define EN_H_SEVEN  22
+#define EN_H_TWELVE 23
+#define EN_H_TEN    24
 
-#define EN_H_NINE   matrix[4] |= 0b0000000111100000
-#define EN_H_ONE    matrix[5] |= 0b1110000000000000
-#define EN_H_SIX    matrix[5] |= 0b0001110000000000
-#define EN_H_THREE  matrix[5] |= 0b0000001111100000
-#define EN_H_FOUR   matrix[6] |= 0b1111000000000000
-#define EN_H_FIVE   matrix[6] |= 0b0000111100000000
-#define EN_H_TWO    matrix[6] |= 0b0000000011100000
-#define EN_H_EIGHT  matrix[7] |= 0b1111100000000000
-#define EN_H_ELEVEN matrix[7] |= 0b0000011111100000
-#define EN_H_SEVEN  matrix[8] |= 0b1111100000000000
-#define EN_H_TWELVE matrix[8] |= 0b0000011111100000
-#define EN_H_TEN    matrix[9] |= 0b1110000000000000
+/**
+ * Die Woerter als Zeile, Startspalte und Laenge. Index 0 ist 'kein Wort'.
+ * Woerter aus mehreren Teilen (z.B. ES IST) haben WORD_MORE bis auf den letzten Teil.
+ *
+ *   01234567890
+ * 0 ITLISASTIME
+ * 1 ACQUARTERDC
+ * 2 TWENTYFIVEX
+ * 3 HALFBTENFTO
+ * 4 PASTERUNINE
+ * 5 ONESIXTHREE
+ * 6 FOURFIVETWO
+ * 7 EIGHTELEVEN
+ * 8 SEVENTWELVE
+ * 9 TENSEOCLOCK
+ *
+ * Erzeugt mit tools/woerter.cmake aus layouts/EN.txt, nicht von Hand aendern.
+ */
+extern const word EN_WORDS[] PROGMEM;
+const word EN_WORDS[] = {
+    0,
+    WORD_LAYOUT(0,  0,  2) | WORD_MORE,  // ITIS
+    WORD_LAYOUT(0,  3,  2),
+    WORD_LAYOUT(0,  7,  4),              // TIME
+    WORD_LAYOUT(1,  0,  1),              // A
+    WORD_LAYOUT(9,  5,  6),              // OCLOCK
+    WORD_LAYOUT(1,  2,  7),              // QUATER
+    WORD_LAYOUT(2,  0,  6),              // TWENTY
+    WORD_LAYOUT(2,  6,  4),              // FIVE
+    WORD_LAYOUT(3,  0,  4),              // HALF
+    WORD_LAYOUT(3,  5,  3),              // TEN
+    WORD_LAYOUT(3,  9,  2),              // TO
+    WORD_LAYOUT(4,  0,  4),              // PAST
+    WORD_LAYOUT(4,  7,  4),              // H_NINE
+    WORD_LAYOUT(5,  0,  3),              // H_ONE
+    WORD_LAYOUT(5,  3,  3),              // H_SIX
+    WORD_LAYOUT(5,  6,  5),              // H_THREE
+    WORD_LAYOUT(6,  0,  4),              // H_FOUR
+    WORD_LAYOUT(6,  4,  4),              // H_FIVE
+    WORD_LAYOUT(6,  8,  3),              // H_TWO
+    WORD_LAYOUT(7,  0,  5),              // H_EIGHT
+    WORD_LAYOUT(7,  5,  6),              // H_ELEVEN
+    WORD_LAYOUT(8,  0,  5),              // H_SEVEN
+    WORD_LAYOUT(8,  5,  6),              // H_TWELVE
+    WORD_LAYOUT(9,  0,  3)               // H_TEN
+};
 
 #endif
@@ -1,78 +1,100 @@
 /**
  * Woerter_ES
  * Definition der spanischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
- *
- *   01234567890
- * 0 ESONELASUNA
- * 1 DOSITRESORE
- * 2 CUATROCINCO
- * 3 SEISASIETEN
- * 4 OCHONUEVEYO
- * 5 LADIEZSONCE
- * 6 DOCELYMENOS
- * 7 OVEINTEDIEZ
- * 8 VEINTICINCO
- * 9 MEDIACUARTO
+ * Die Woerter sind Indizes in die Tabelle ES_WORDS (Zeile, Startspalte, Laenge).
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
+ * @version  1.3
  * @created  17.12.2012
- * @updated  13.5.2013
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.1:  - Woerter als Tabelle im PROGMEM fuer den Renderer.
+ * V 1.2:  - Woerter als Zeile, Startspalte und Laenge.
+ * V 1.3:  - Tabelle aus layouts/ES.txt erzeugt (tools/woerter.cmake).
  */
 #ifndef WOERTER_ES_H
 #define WOERTER_ES_H
 
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Renderer.h"
+
 /**
  * Definition der Woerter.
  */
-//                            0       ESONELASUNA
-#define ES_SONLAS      matrix[0] |= 0b0111011100000000
-//                            0       ESONELASUNA
-#define ES_ESLA        matrix[0] |= 0b1100011000000000
+#define ES_SONLAS      1
+#define ES_ESLA        3
+
+#define ES_Y           5
+#define ES_MENOS       6
 
-//                            6       DOCELYMENOS
-#define ES_Y           matrix[6] |= 0b0000010000000000
-//                            6       DOCELYMENOS
-#define ES_MENOS       matrix[6] |= 0b0000001111100000
+#define ES_CINCO       7
+#define ES_DIEZ        8
+#define ES_CUARTO      9
+#define ES_VEINTE      10
+#define ES_VEINTICINCO 11
+#define ES_MEDIA       12
 
-//                            8       VEINTICINCO
-#define ES_CINCO       matrix[8] |= 0b0000001111100000
-//                            7       OVEINTEDIEZ
-#define ES_DIEZ        matrix[7] |= 0b0000000111100000
-//                            9       MEDIACUARTO
-#define ES_CUARTO      matrix[9] |= 0b0000011111100000
-//                            7       OVEINTEDIEZ
-#define ES_VEINTE      matrix[7] |= 0b0111111000000000
-//                            8       VEINTICINCO
-#define ES_VEINTICINCO matrix[8] |= 0b1111111111100000
-//                            9       MEDIACUARTO
-#define ES_MEDIA       matrix[9] |= 0b1111100000000000
+#define ES_H_UNA       13
+#define ES_H_DOS       14
+#define ES_H_TRES      15
+#define ES_H_CUATRO    16
+#define ES_H_CINCO     17
+#define ES_H_SEIS      18
+#define ES_H_SIETE     19
+#define ES_H_OCHO      20
+#define ES_H_NUEVE     21
+#define ES_H_DIEZ      22
+#define ES_H_ONCE      23
+#define ES_H_DOCE      24
 
-//                            0       ESONELASUNA
-#define ES_H_UNA       matrix[0] |= 0b0000000011100000
-//                            1       DOSITRESORE
-#define ES_H_DOS       matrix[1] |= 0b1110000000000000
-//                            1       DOSITRESORE
-#define ES_H_TRES      matrix[1] |= 0b0000111100000000
-//                            2       CUATROCINCO
-#define ES_H_CUATRO    matrix[2] |= 0b1111110000000000
-//                            2       CUATROCINCO
-#define ES_H_CINCO     matrix[2] |= 0b0000001111100000
-//                            3       SEISASIETEN
-#define ES_H_SEIS      matrix[3] |= 0b1111000000000000
-//                            3       SEISASIETEN
-#define ES_H_SIETE     matrix[3] |= 0b0000011111000000
-//                            4       OCHONUEVEYO
-#define ES_H_OCHO      matrix[4] |= 0b1111000000000000
-//                            4       OCHONUEVEYO
-#define ES_H_NUEVE     matrix[4] |= 0b0000111110000000
-//                            5       LADIEZSONCE
-#define ES_H_DIEZ      matrix[5] |= 0b0011110000000000
-//                            5       LADIEZSONCE
-#define ES_H_ONCE      matrix[5] |= 0b0000000111100000
-//                            6       DOCELYMENOS
-#define ES_H_DOCE      matrix[6] |= 0b1111000000000000
+/**
+ * Die Woerter als Zeile, Startspalte und Laenge. Index 0 ist 'kein Wort'.
+ * Woerter aus mehreren Teilen (z.B. ES IST) haben WORD_MORE bis auf den letzten Teil.
+ *
+ *   01234567890
+ * 0 ESONELASUNA
+ * 1 DOSITRESORE
+ * 2 CUATROCINCO
+ * 3 SEISASIETEN
+ * 4 OCHONUEVEYO
+ * 5 LADIEZSONCE
+ * 6 DOCELYMENOS
+ * 7 OVEINTEDIEZ
+ * 8 VEINTICINCO
+ * 9 MEDIACUARTO
+ *
+ * Erzeugt mit tools/woerter.cmake aus layouts/ES.txt, nicht von Hand aendern.
+ */
+extern const word ES_WORDS[] PROGMEM;
+const word ES_WORDS[] = {
+    0,
+    WORD_LAYOUT(0,  1,  3) | WORD_MORE,  // SONLAS
+    WORD_LAYOUT(0,  5,  3),
+    WORD_LAYOUT(0,  0,  2) | WORD_MORE,  // ESLA
+    WORD_LAYOUT(0,  5,  2),
+    WORD_LAYOUT(6,  5,  1),              // Y
+    WORD_LAYOUT(6,  6,  5),              // MENOS
+    WORD_LAYOUT(8,  6,  5),              // CINCO
+    WORD_LAYOUT(7,  7,  4),              // DIEZ
+    WORD_LAYOUT(9,  5,  6),              // CUARTO
+    WORD_LAYOUT(7,  1,  6),              // VEINTE
+    WORD_LAYOUT(8,  0, 11),              // VEINTICINCO
+    WORD_LAYOUT(9,  0,  5),              // MEDIA
+    WORD_LAYOUT(0,  8,  3),              // H_UNA
+    WORD_LAYOUT(1,  0,  3),              // H_DOS
+    WORD_LAYOUT(1,  4,  4),              // H_TRES
+    WORD_LAYOUT(2,  0,  6),              // H_CUATRO
+    WORD_LAYOUT(2,  6,  5),              // H_CINCO
+    WORD_LAYOUT(3,  0,  4),              // H_SEIS
+    WORD_LAYOUT(3,  5,  5),              // H_SIETE
+    WORD_LAYOUT(4,  0,  4),              // H_OCHO
+    WORD_LAYOUT(4,  4,  5),              // H_NUEVE
+    WORD_LAYOUT(5,  2,  4),              // H_DIEZ
+    WORD_LAYOUT(5,  7,  4),              // H_ONCE
+    WORD_LAYOUT(6,  0,  4)               // H_DOCE
+};
 
 #endif
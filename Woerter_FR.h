@@ -1,58 +1,105 @@
 /**
  * Woerter_FR
  * Definition der franzoesischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
- *
- *   01234567890
- * 0 ILNESTODEUX
- * 1 QUATRETROIS
- * 2 NEUFUNESEPT
- * 3 HUITSIXCINQ
- * 4 MIDIXMINUIT
- * 5 ONZERHEURES
- * 6 MOINSOLEDIX
- * 7 ETRQUARTPMD
- * 8 VINGT-CINQU
- * 9 ETSDEMIEPAM
+ * Die Woerter sind Indizes in die Tabelle FR_WORDS (Zeile, Startspalte, Laenge).
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
+ * @version  1.3
  * @created  12.12.2012
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.1:  - Woerter als Tabelle im PROGMEM fuer den Renderer.
+ * V 1.2:  - Woerter als Zeile, Startspalte und Laenge.
+ * V 1.3:  - Tabelle aus layouts/FR.txt erzeugt (tools/woerter.cmake).
  */
 #ifndef WOERTER_FR_H
 #define WOERTER_FR_H
 
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Renderer.h"
+
 /**
  * Definition der Woerter
  */
 // Trait = Bindestrich (-)
-#define FR_TRAIT        matrix[8] |= 0b0000010000000000
-#define FR_ET           matrix[7] |= 0b1100000000000000
-#define FR_LE           matrix[6] |= 0b0000001100000000
-#define FR_MOINS        matrix[6] |= 0b1111100000000000
-#define FR_ILEST        matrix[0] |= 0b1101110000000000
-#define FR_HEURE        matrix[5] |= 0b0000011111000000
-#define FR_HEURES       matrix[5] |= 0b0000011111100000
+#define FR_TRAIT        1
+#define FR_ET           2
+#define FR_LE           3
+#define FR_MOINS        4
+#define FR_ILEST        5
+#define FR_HEURE        7
+#define FR_HEURES       8
+
+#define FR_CINQ         9
+#define FR_DIX          10
+#define FR_QUART        11
+#define FR_VINGT        12
+#define FR_DEMI         13
 
-#define FR_CINQ         matrix[8] |= 0b0000001111000000
-#define FR_DIX          matrix[6] |= 0b0000000011100000
-#define FR_QUART        matrix[7] |= 0b0001111100000000
-#define FR_VINGT        matrix[8] |= 0b1111100000000000
-#define FR_DEMI         matrix[9] |= 0b0001111000000000
+#define FR_H_UNE        14
+#define FR_H_DEUX       15
+#define FR_H_TROIS      16
+#define FR_H_QUATRE     17
+#define FR_H_CINQ       18
+#define FR_H_SIX        19
+#define FR_H_SEPT       20
+#define FR_H_HUIT       21
+#define FR_H_NEUF       22
+#define FR_H_DIX        23
+#define FR_H_ONZE       24
+#define FR_H_MIDI       25
+#define FR_H_MINUIT     26
 
-#define FR_H_UNE        matrix[2] |= 0b0000111000000000
-#define FR_H_DEUX       matrix[0] |= 0b0000000111100000
-#define FR_H_TROIS      matrix[1] |= 0b0000001111100000
-#define FR_H_QUATRE     matrix[1] |= 0b1111110000000000
-#define FR_H_CINQ       matrix[3] |= 0b0000000111100000
-#define FR_H_SIX        matrix[3] |= 0b0000111000000000
-#define FR_H_SEPT       matrix[2] |= 0b0000000111100000
-#define FR_H_HUIT       matrix[3] |= 0b1111000000000000
-#define FR_H_NEUF       matrix[2] |= 0b1111000000000000
-#define FR_H_DIX        matrix[4] |= 0b0011100000000000
-#define FR_H_ONZE       matrix[5] |= 0b1111000000000000
-#define FR_H_MIDI       matrix[4] |= 0b1111000000000000
-#define FR_H_MINUIT     matrix[4] |= 0b0000011111100000
+/**
+ * Die Woerter als Zeile, Startspalte und Laenge. Index 0 ist 'kein Wort'.
+ * Woerter aus mehreren Teilen (z.B. ES IST) haben WORD_MORE bis auf den letzten Teil.
+ *
+ *   01234567890
+ * 0 ILNESTODEUX
+ * 1 QUATRETROIS
+ * 2 NEUFUNESEPT
+ * 3 HUITSIXCINQ
+ * 4 MIDIXMINUIT
+ * 5 ONZERHEURES
+ * 6 MOINSOLEDIX
+ * 7 ETRQUARTPMD
+ * 8 VINGT-CINQU
+ * 9 ETSDEMIEPAM
+ *
+ * Erzeugt mit tools/woerter.cmake aus layouts/FR.txt, nicht von Hand aendern.
+ */
+extern const word FR_WORDS[] PROGMEM;
+const word FR_WORDS[] = {
+    0,
+    WORD_LAYOUT(8,  5,  1),              // TRAIT
+    WORD_LAYOUT(7,  0,  2),              // ET
+    WORD_LAYOUT(6,  6,  2),              // LE
+    WORD_LAYOUT(6,  0,  5),              // MOINS
+    WORD_LAYOUT(0,  0,  2) | WORD_MORE,  // ILEST
+    WORD_LAYOUT(0,  3,  3),
+    WORD_LAYOUT(5,  5,  5),              // HEURE
+    WORD_LAYOUT(5,  5,  6),              // HEURES
+    WORD_LAYOUT(8,  6,  4),              // CINQ
+    WORD_LAYOUT(6,  8,  3),              // DIX
+    WORD_LAYOUT(7,  3,  5),              // QUART
+    WORD_LAYOUT(8,  0,  5),              // VINGT
+    WORD_LAYOUT(9,  3,  4),              // DEMI
+    WORD_LAYOUT(2,  4,  3),              // H_UNE
+    WORD_LAYOUT(0,  7,  4),              // H_DEUX
+    WORD_LAYOUT(1,  6,  5),              // H_TROIS
+    WORD_LAYOUT(1,  0,  6),              // H_QUATRE
+    WORD_LAYOUT(3,  7,  4),              // H_CINQ
+    WORD_LAYOUT(3,  4,  3),              // H_SIX
+    WORD_LAYOUT(2,  7,  4),              // H_SEPT
+    WORD_LAYOUT(3,  0,  4),              // H_HUIT
+    WORD_LAYOUT(2,  0,  4),              // H_NEUF
+    WORD_LAYOUT(4,  2,  3),              // H_DIX
+    WORD_LAYOUT(5,  0,  4),              // H_ONZE
+    WORD_LAYOUT(4,  0,  4),              // H_MIDI
+    WORD_LAYOUT(4,  5,  6)               // H_MINUIT
+};
 
 #endif
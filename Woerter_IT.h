@@ -1,7 +1,59 @@
 /**
  * Woerter_IT
  * Definition der italienischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle IT_WORDS (Zeile, Startspalte, Laenge).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.3
+ * @created  17.12.2012
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.1:  - Woerter als Tabelle im PROGMEM fuer den Renderer.
+ * V 1.2:  - Woerter als Zeile, Startspalte und Laenge.
+ * V 1.3:  - Tabelle aus layouts/IT.txt erzeugt (tools/woerter.cmake).
+ */
+#ifndef WOERTER_IT_H
+#define WOERTER_IT_H
+
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Renderer.h"
+
+/**
+ * Definition der Woerter.
+ */
+#define IT_SONOLE    1
+#define IT_LE        3
+#define IT_ORE       4
+#define IT_E         5
+
+#define IT_H_LUNA    6
+#define IT_H_DUE     7
+#define IT_H_TRE     8
+#define IT_H_OTTO    9
+#define IT_H_NOVE    10
+#define IT_H_DIECI   11
+#define IT_H_UNDICI  12
+#define IT_H_DODICI  13
+#define IT_H_SETTE   14
+#define IT_H_QUATTRO 15
+#define IT_H_SEI     16
+#define IT_H_CINQUE  17
+
+#define IT_MENO      18
+#define IT_E2        19
+#define IT_UN        20
+#define IT_QUARTO    21
+#define IT_VENTI     22
+#define IT_CINQUE    23
+#define IT_DIECI     24
+#define IT_MEZZA     25
+
+/**
+ * Die Woerter als Zeile, Startspalte und Laenge. Index 0 ist 'kein Wort'.
+ * Woerter aus mehreren Teilen (z.B. ES IST) haben WORD_MORE bis auf den letzten Teil.
  *
  *   01234567890
  * 0 SONORLEBORE
@@ -15,42 +67,36 @@
  * 8 VENTICINQUE
  * 9 DIECIEMEZZA
  *
- * @mc       Arduino/RBBB
- * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
- * @created  17.12.2012
- */
-#ifndef WOERTER_IT_H
-#define WOERTER_IT_H
-
-/**
- * Definition der Woerter.
+ * Erzeugt mit tools/woerter.cmake aus layouts/IT.txt, nicht von Hand aendern.
  */
-#define IT_SONOLE    matrix[0] |= 0b1111011000000000
-#define IT_LE        matrix[0] |= 0b0000011000000000
-#define IT_ORE       matrix[0] |= 0b0000000011100000
-#define IT_E         matrix[1] |= 0b1000000000000000
-
-#define IT_H_LUNA    matrix[1] |= 0b0011110000000000
-#define IT_H_DUE     matrix[1] |= 0b0000000111000000
-#define IT_H_TRE     matrix[2] |= 0b1110000000000000
-#define IT_H_OTTO    matrix[2] |= 0b0001111000000000
-#define IT_H_NOVE    matrix[2] |= 0b0000000111100000
-#define IT_H_DIECI   matrix[3] |= 0b1111100000000000
-#define IT_H_UNDICI  matrix[3] |= 0b0000011111100000
-#define IT_H_DODICI  matrix[4] |= 0b1111110000000000
-#define IT_H_SETTE   matrix[4] |= 0b0000001111100000
-#define IT_H_QUATTRO matrix[5] |= 0b1111111000000000
-#define IT_H_SEI     matrix[5] |= 0b0000000011100000
-#define IT_H_CINQUE  matrix[6] |= 0b1111110000000000
-
-#define IT_MENO      matrix[6] |= 0b0000000111100000
-#define IT_E2        matrix[7] |= 0b1000000000000000
-#define IT_UN        matrix[7] |= 0b0011000000000000
-#define IT_QUARTO    matrix[7] |= 0b0000011111100000
-#define IT_VENTI     matrix[8] |= 0b1111100000000000
-#define IT_CINQUE    matrix[8] |= 0b0000011111100000
-#define IT_DIECI     matrix[9] |= 0b1111100000000000
-#define IT_MEZZA     matrix[9] |= 0b0000001111100000
+extern const word IT_WORDS[] PROGMEM;
+const word IT_WORDS[] = {
+    0,
+    WORD_LAYOUT(0,  0,  4) | WORD_MORE,  // SONOLE
+    WORD_LAYOUT(0,  5,  2),
+    WORD_LAYOUT(0,  5,  2),              // LE
+    WORD_LAYOUT(0,  8,  3),              // ORE
+    WORD_LAYOUT(1,  0,  1),              // E
+    WORD_LAYOUT(1,  2,  4),              // H_LUNA
+    WORD_LAYOUT(1,  7,  3),              // H_DUE
+    WORD_LAYOUT(2,  0,  3),              // H_TRE
+    WORD_LAYOUT(2,  3,  4),              // H_OTTO
+    WORD_LAYOUT(2,  7,  4),              // H_NOVE
+    WORD_LAYOUT(3,  0,  5),              // H_DIECI
+    WORD_LAYOUT(3,  5,  6),              // H_UNDICI
+    WORD_LAYOUT(4,  0,  6),              // H_DODICI
+    WORD_LAYOUT(4,  6,  5),              // H_SETTE
+    WORD_LAYOUT(5,  0,  7),              // H_QUATTRO
+    WORD_LAYOUT(5,  8,  3),              // H_SEI
+    WORD_LAYOUT(6,  0,  6),              // H_CINQUE
+    WORD_LAYOUT(6,  7,  4),              // MENO
+    WORD_LAYOUT(7,  0,  1),              // E2
+    WORD_LAYOUT(7,  2,  2),              // UN
+    WORD_LAYOUT(7,  5,  6),              // QUARTO
+    WORD_LAYOUT(8,  0,  5),              // VENTI
+    WORD_LAYOUT(8,  5,  6),              // CINQUE
+    WORD_LAYOUT(9,  0,  5),              // DIECI
+    WORD_LAYOUT(9,  6,  5)               // MEZZA
+};
 
 #endif
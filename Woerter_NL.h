@@ -1,64 +1,104 @@
 /**
  * Woerter_NL
  * Definition der niederlaendischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle NL_WORDS (Zeile, Startspalte, Laenge).
  *
  * @mc       Arduino/RBBB
  * @autor    Rudolf Klimesch (Vorlage: Christian Aschoff)
- * @version  1.01
+ * @version  1.04
  * @created  17.1.2013
- * @update   29.9.2014
+ * @update   18.10.2026
  *
  * Historie:
  * V 1.01 - Falsches O bei ZEVEN behoben.
+ * V 1.02 - Woerter als Tabelle im PROGMEM fuer den Renderer.
+ * V 1.03 - Woerter als Zeile, Startspalte und Laenge.
+ * V 1.04 - Tabelle aus layouts/NL.txt erzeugt (tools/woerter.cmake).
  *
  */
 #ifndef WOERTER_NL_H
 #define WOERTER_NL_H
 
-/*
- * VORLAGE FUER DIE MATRIX
- *
- *  H E T K I S A V I J F     HET=ES, IS=IST, VIJF=FUNF
- *  T I E N B T Z V O O R     TIEN=ZEHN, VOOR=VOR
- *  O V E R M E K W A R T     OVER=NACH, KWART=VIERTEL
- *  H A L F S P W O V E R     HALF=HALB, OVER=NACH
- *  V O O R T H G E E N S     VOOR=VOR, EENS=EINS
- *  T W E E P V C D R I E     TWEE=ZWEI, DRIE=DREI
- *  V I E R V I J F Z E S     VIER=VIER, VIJF=FUNF, ZES=SECHS
- *  Z E V E N O N E G E N     ZEVEN=SIEBEN, NEGEN=NEUN
- *  A C H T T I E N E L F     ACHT=ACHT, TIEN=ZEHN, ELF=ELF
- *  T W A A L F B F U U R     TWAALF=ZWOLF, UUR=STUNDE
- */
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Renderer.h"
 
 /**
  * Definition der Woerter
  */
-#define NL_VOOR         matrix[1] |= 0b0000000111100000 // VOR
-#define NL_OVER         matrix[2] |= 0b1111000000000000 // NACH
-#define NL_VOOR2        matrix[4] |= 0b1111000000000000 // VOR2
-#define NL_OVER2        matrix[3] |= 0b0000000111100000 // NACH2
-#define NL_HETIS        matrix[0] |= 0b1110110000000000 // ESIST
-#define NL_UUR          matrix[9] |= 0b0000000011100000 // UHR
+#define NL_VOOR         1  // VOR
+#define NL_OVER         2  // NACH
+#define NL_VOOR2        3  // VOR2
+#define NL_OVER2        4  // NACH2
+#define NL_HETIS        5  // ESIST
+#define NL_UUR          7  // UHR
 
-#define NL_VIJF         matrix[0] |= 0b0000000111100000 // FUENF
-#define NL_TIEN         matrix[1] |= 0b1111000000000000 // ZEHN
-#define NL_KWART        matrix[2] |= 0b0000001111100000 // VIERTEL
-#define NL_ZWANZIG      matrix[1] |= 0b0000111111100000 // ZWANZIG
-#define NL_HALF         matrix[3] |= 0b1111000000000000 // HALB
+#define NL_VIJF         8  // FUENF
+#define NL_TIEN         9  // ZEHN
+#define NL_KWART        10  // VIERTEL
+#define NL_ZWANZIG      11 // ZWANZIG
+#define NL_HALF         12 // HALB
 
-#define NL_H_EEN        matrix[4] |= 0b0000000111000000 // H_EIN
-#define NL_H_EENS       matrix[4] |= 0b0000000111100000 // H_EINS
-#define NL_H_TWEE       matrix[5] |= 0b1111000000000000 // H_ZWEI
-#define NL_H_DRIE       matrix[5] |= 0b0000000111100000 // H_DREI
-#define NL_H_VIER       matrix[6] |= 0b1111000000000000 // H_VIER
-#define NL_H_VIJF       matrix[6] |= 0b0000111100000000 // H_FUENF
-#define NL_H_ZES        matrix[6] |= 0b0000000011100000 // H_SECHS
-#define NL_H_ZEVEN      matrix[7] |= 0b1111100000000000 // H_SIEBEN
-#define NL_H_ACHT       matrix[8] |= 0b1111000000000000 // H_ACHT
-#define NL_H_NEGEN      matrix[7] |= 0b0000001111100000 // H_NEUN
-#define NL_H_TIEN       matrix[8] |= 0b0000111100000000 // H_ZEHN
-#define NL_H_ELF        matrix[8] |= 0b0000000011100000 // H_ELF
-#define NL_H_TWAALF     matrix[9] |= 0b1111110000000000 // H_ZWOELF
+#define NL_H_EEN        13 // H_EIN
+#define NL_H_EENS       14 // H_EINS
+#define NL_H_TWEE       15 // H_ZWEI
+#define NL_H_DRIE       16 // H_DREI
+#define NL_H_VIER       17 // H_VIER
+#define NL_H_VIJF       18 // H_FUENF
+#define NL_H_ZES        19 // H_SECHS
+#define NL_H_ZEVEN      20 // H_SIEBEN
+#define NL_H_ACHT       21 // H_ACHT
+#define NL_H_NEGEN      22 // H_NEUN
+#define NL_H_TIEN       23 // H_ZEHN
+#define NL_H_ELF        24 // H_ELF
+#define NL_H_TWAALF     25 // H_ZWOELF
+
+/**
+ * Die Woerter als Zeile, Startspalte und Laenge. Index 0 ist 'kein Wort'.
+ * Woerter aus mehreren Teilen (z.B. ES IST) haben WORD_MORE bis auf den letzten Teil.
+ *
+ *   01234567890
+ * 0 HETKISAVIJF
+ * 1 TIENBTZVOOR
+ * 2 OVERMEKWART
+ * 3 HALFSPWOVER
+ * 4 VOORTHGEENS
+ * 5 TWEEPVCDRIE
+ * 6 VIERVIJFZES
+ * 7 ZEVENONEGEN
+ * 8 ACHTTIENELF
+ * 9 TWAALFBFUUR
+ *
+ * Erzeugt mit tools/woerter.cmake aus layouts/NL.txt, nicht von Hand aendern.
+ */
+extern const word NL_WORDS[] PROGMEM;
+const word NL_WORDS[] = {
+    0,
+    WORD_LAYOUT(1,  7,  4),              // VOOR
+    WORD_LAYOUT(2,  0,  4),              // OVER
+    WORD_LAYOUT(4,  0,  4),              // VOOR2
+    WORD_LAYOUT(3,  7,  4),              // OVER2
+    WORD_LAYOUT(0,  0,  3) | WORD_MORE,  // HETIS
+    WORD_LAYOUT(0,  4,  2),
+    WORD_LAYOUT(9,  8,  3),              // UUR
+    WORD_LAYOUT(0,  7,  4),              // VIJF
+    WORD_LAYOUT(1,  0,  4),              // TIEN
+    WORD_LAYOUT(2,  6,  5),              // KWART
+    WORD_LAYOUT(1,  4,  7),              // ZWANZIG
+    WORD_LAYOUT(3,  0,  4),              // HALF
+    WORD_LAYOUT(4,  7,  3),              // H_EEN
+    WORD_LAYOUT(4,  7,  4),              // H_EENS
+    WORD_LAYOUT(5,  0,  4),              // H_TWEE
+    WORD_LAYOUT(5,  7,  4),              // H_DRIE
+    WORD_LAYOUT(6,  0,  4),              // H_VIER
+    WORD_LAYOUT(6,  4,  4),              // H_VIJF
+    WORD_LAYOUT(6,  8,  3),              // H_ZES
+    WORD_LAYOUT(7,  0,  5),              // H_ZEVEN
+    WORD_LAYOUT(8,  0,  4),              // H_ACHT
+    WORD_LAYOUT(7,  6,  5),              // H_NEGEN
+    WORD_LAYOUT(8,  4,  4),              // H_TIEN
+    WORD_LAYOUT(8,  8,  3),              // H_ELF
+    WORD_LAYOUT(9,  0,  6)               // H_TWAALF
+};
 
 #endif
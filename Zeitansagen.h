@@ -0,0 +1,368 @@
+/**
+ * Zeitansagen
+ * Die Zeitansage pro Sprache als Tabellen fuer den Renderer. Die Woerter
+ * sind Indizes aus den Woerter_XX.h, 0 ist 'kein Wort'. Die Tabellen sind
+ * damit unabhaengig vom Layout der Front.
+ *
+ * XX_MINUTES: pro 5-Minuten-Schritt die Flags und bis zu 4 Minutenwoerter.
+ * XX_HOURS:   pro Stunde das Stundenwort, das Stundenwort zur vollen Stunde
+ *             ('glatt', z.B. EIN statt EINS) und ein Zusatzwort (z.B. HEURES).
+ *             12 Zeilen, nur Franzoesisch braucht 24 (MIDI/MINUIT).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.1
+ * @created  17.10.2026
+ * @updated  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt aus den switch-Anweisungen in Renderer::setMinutes/setHours.
+ * V 1.1:  - Nur die Tabellen der eingeschalteten Sprachen (ENABLE_LANGUAGE_XX).
+ */
+#ifndef ZEITANSAGEN_H
+#define ZEITANSAGEN_H
+
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Configuration.h"
+
+// Volle Stunde: Wort fuer 'Uhr' und das 'glatte' Stundenwort nehmen.
+#define ZEIT_GLATT           0b00000001
+// Die Ansage bezieht sich auf die naechste Stunde ('fuenf vor halb drei').
+#define ZEIT_NAECHSTE_STUNDE 0b00000010
+
+#define ZEIT_MINUTES_WIDTH 5
+#define ZEIT_HOURS_WIDTH   3
+
+#ifdef ENABLE_LANGUAGE_DE
+/**
+ * Deutsch: Hochdeutsch
+ */
+extern const byte DE_DE_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte DE_DE_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {ZEIT_GLATT,           0,           0,       0,       0}, // glatte Stunde
+    {0,                    DE_FUENF,    DE_NACH, 0,       0}, // 5 nach
+    {0,                    DE_ZEHN,     DE_NACH, 0,       0}, // 10 nach
+    {0,                    DE_VIERTEL,  DE_NACH, 0,       0}, // viertel nach
+    {0,                    DE_ZWANZIG,  DE_NACH, 0,       0}, // 20 nach
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,    DE_VOR,  DE_HALB, 0}, // 5 vor halb
+    {ZEIT_NAECHSTE_STUNDE, DE_HALB,     0,       0,       0}, // halb
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,    DE_NACH, DE_HALB, 0}, // 5 nach halb
+    {ZEIT_NAECHSTE_STUNDE, DE_ZWANZIG,  DE_VOR,  0,       0}, // 20 vor
+    {ZEIT_NAECHSTE_STUNDE, DE_VIERTEL,  DE_VOR,  0,       0}, // viertel vor
+    {ZEIT_NAECHSTE_STUNDE, DE_ZEHN,     DE_VOR,  0,       0}, // 10 vor
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,    DE_VOR,  0,       0}  // 5 vor
+};
+
+/**
+ * Deutsch: Schwaebisch ('viertel elf', 'dreiviertel elf')
+ */
+extern const byte DE_SW_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte DE_SW_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {ZEIT_GLATT,           0,              0,       0,       0},
+    {0,                    DE_FUENF,       DE_NACH, 0,       0},
+    {0,                    DE_ZEHN,        DE_NACH, 0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_VIERTEL,     0,       0,       0},
+    {0,                    DE_ZWANZIG,     DE_NACH, 0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,       DE_VOR,  DE_HALB, 0},
+    {ZEIT_NAECHSTE_STUNDE, DE_HALB,        0,       0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,       DE_NACH, DE_HALB, 0},
+    {ZEIT_NAECHSTE_STUNDE, DE_ZWANZIG,     DE_VOR,  0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_DREIVIERTEL, 0,       0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_ZEHN,        DE_VOR,  0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,       DE_VOR,  0,       0}
+};
+
+/**
+ * Deutsch: Bayrisch ('viertel nach zehn', aber 'dreiviertel elf')
+ */
+extern const byte DE_BA_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte DE_BA_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {ZEIT_GLATT,           0,              0,       0,       0},
+    {0,                    DE_FUENF,       DE_NACH, 0,       0},
+    {0,                    DE_ZEHN,        DE_NACH, 0,       0},
+    {0,                    DE_VIERTEL,     DE_NACH, 0,       0},
+    {0,                    DE_ZWANZIG,     DE_NACH, 0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,       DE_VOR,  DE_HALB, 0},
+    {ZEIT_NAECHSTE_STUNDE, DE_HALB,        0,       0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,       DE_NACH, DE_HALB, 0},
+    {ZEIT_NAECHSTE_STUNDE, DE_ZWANZIG,     DE_VOR,  0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_DREIVIERTEL, 0,       0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_ZEHN,        DE_VOR,  0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,       DE_VOR,  0,       0}
+};
+
+/**
+ * Deutsch: Saechsisch ('zehn vor halb', 'zehn nach halb')
+ */
+extern const byte DE_SA_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte DE_SA_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {ZEIT_GLATT,           0,              0,       0,       0},
+    {0,                    DE_FUENF,       DE_NACH, 0,       0},
+    {0,                    DE_ZEHN,        DE_NACH, 0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_VIERTEL,     0,       0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_ZEHN,        DE_VOR,  DE_HALB, 0},
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,       DE_VOR,  DE_HALB, 0},
+    {ZEIT_NAECHSTE_STUNDE, DE_HALB,        0,       0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,       DE_NACH, DE_HALB, 0},
+    {ZEIT_NAECHSTE_STUNDE, DE_ZEHN,        DE_NACH, DE_HALB, 0},
+    {ZEIT_NAECHSTE_STUNDE, DE_DREIVIERTEL, 0,       0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_ZEHN,        DE_VOR,  0,       0},
+    {ZEIT_NAECHSTE_STUNDE, DE_FUENF,       DE_VOR,  0,       0}
+};
+
+extern const byte DE_HOURS[12][ZEIT_HOURS_WIDTH] PROGMEM;
+const byte DE_HOURS[12][ZEIT_HOURS_WIDTH] = {
+    {DE_H_ZWOELF, DE_H_ZWOELF, 0},
+    {DE_H_EINS,   DE_H_EIN,    0},
+    {DE_H_ZWEI,   DE_H_ZWEI,   0},
+    {DE_H_DREI,   DE_H_DREI,   0},
+    {DE_H_VIER,   DE_H_VIER,   0},
+    {DE_H_FUENF,  DE_H_FUENF,  0},
+    {DE_H_SECHS,  DE_H_SECHS,  0},
+    {DE_H_SIEBEN, DE_H_SIEBEN, 0},
+    {DE_H_ACHT,   DE_H_ACHT,   0},
+    {DE_H_NEUN,   DE_H_NEUN,   0},
+    {DE_H_ZEHN,   DE_H_ZEHN,   0},
+    {DE_H_ELF,    DE_H_ELF,    0}
+};
+#endif
+
+#ifdef ENABLE_LANGUAGE_CH
+/**
+ * Schweiz: Berner-Deutsch
+ */
+extern const byte CH_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte CH_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {ZEIT_GLATT,           0,          0,      0,        0},
+    {0,                    CH_FUEF,    CH_AB,  0,        0},
+    {0,                    CH_ZAEAE,   CH_AB,  0,        0},
+    {0,                    CH_VIERTU,  CH_AB,  0,        0},
+    {0,                    CH_ZWAENZG, CH_AB,  0,        0},
+    {ZEIT_NAECHSTE_STUNDE, CH_FUEF,    CH_VOR, CH_HAUBI, 0},
+    {ZEIT_NAECHSTE_STUNDE, CH_HAUBI,   0,      0,        0},
+    {ZEIT_NAECHSTE_STUNDE, CH_FUEF,    CH_AB,  CH_HAUBI, 0},
+    {ZEIT_NAECHSTE_STUNDE, CH_ZWAENZG, CH_VOR, 0,        0},
+    {ZEIT_NAECHSTE_STUNDE, CH_VIERTU,  CH_VOR, 0,        0},
+    {ZEIT_NAECHSTE_STUNDE, CH_ZAEAE,   CH_VOR, 0,        0},
+    {ZEIT_NAECHSTE_STUNDE, CH_FUEF,    CH_VOR, 0,        0}
+};
+
+extern const byte CH_HOURS[12][ZEIT_HOURS_WIDTH] PROGMEM;
+const byte CH_HOURS[12][ZEIT_HOURS_WIDTH] = {
+    {CH_H_ZWOEUFI, CH_H_ZWOEUFI, 0},
+    {CH_H_EIS,     CH_H_EIS,     0},
+    {CH_H_ZWOEI,   CH_H_ZWOEI,   0},
+    {CH_H_DRUE,    CH_H_DRUE,    0},
+    {CH_H_VIER,    CH_H_VIER,    0},
+    {CH_H_FUEFI,   CH_H_FUEFI,   0},
+    {CH_H_SAECHSI, CH_H_SAECHSI, 0},
+    {CH_H_SIEBNI,  CH_H_SIEBNI,  0},
+    {CH_H_ACHTI,   CH_H_ACHTI,   0},
+    {CH_H_NUENI,   CH_H_NUENI,   0},
+    {CH_H_ZAENI,   CH_H_ZAENI,   0},
+    {CH_H_EUFI,    CH_H_EUFI,    0}
+};
+#endif
+
+#ifdef ENABLE_LANGUAGE_EN
+/**
+ * Englisch
+ */
+extern const byte EN_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte EN_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {ZEIT_GLATT,           0,         0,         0,       0},
+    {0,                    EN_FIVE,   EN_PAST,   0,       0},
+    {0,                    EN_TEN,    EN_PAST,   0,       0},
+    {0,                    EN_A,      EN_QUATER, EN_PAST, 0},
+    {0,                    EN_TWENTY, EN_PAST,   0,       0},
+    {0,                    EN_TWENTY, EN_FIVE,   EN_PAST, 0},
+    {0,                    EN_HALF,   EN_PAST,   0,       0},
+    {ZEIT_NAECHSTE_STUNDE, EN_TWENTY, EN_FIVE,   EN_TO,   0},
+    {ZEIT_NAECHSTE_STUNDE, EN_TWENTY, EN_TO,     0,       0},
+    {ZEIT_NAECHSTE_STUNDE, EN_A,      EN_QUATER, EN_TO,   0},
+    {ZEIT_NAECHSTE_STUNDE, EN_TEN,    EN_TO,     0,       0},
+    {ZEIT_NAECHSTE_STUNDE, EN_FIVE,   EN_TO,     0,       0}
+};
+
+extern const byte EN_HOURS[12][ZEIT_HOURS_WIDTH] PROGMEM;
+const byte EN_HOURS[12][ZEIT_HOURS_WIDTH] = {
+    {EN_H_TWELVE, EN_H_TWELVE, 0},
+    {EN_H_ONE,    EN_H_ONE,    0},
+    {EN_H_TWO,    EN_H_TWO,    0},
+    {EN_H_THREE,  EN_H_THREE,  0},
+    {EN_H_FOUR,   EN_H_FOUR,   0},
+    {EN_H_FIVE,   EN_H_FIVE,   0},
+    {EN_H_SIX,    EN_H_SIX,    0},
+    {EN_H_SEVEN,  EN_H_SEVEN,  0},
+    {EN_H_EIGHT,  EN_H_EIGHT,  0},
+    {EN_H_NINE,   EN_H_NINE,   0},
+    {EN_H_TEN,    EN_H_TEN,    0},
+    {EN_H_ELEVEN, EN_H_ELEVEN, 0}
+};
+#endif
+
+#ifdef ENABLE_LANGUAGE_FR
+/**
+ * Franzoesisch
+ */
+extern const byte FR_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte FR_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {ZEIT_GLATT,           0,        0,        0,        0},
+    {0,                    FR_CINQ,  0,        0,        0},
+    {0,                    FR_DIX,   0,        0,        0},
+    {0,                    FR_ET,    FR_QUART, 0,        0},
+    {0,                    FR_VINGT, 0,        0,        0},
+    {0,                    FR_VINGT, FR_TRAIT, FR_CINQ,  0},
+    {0,                    FR_ET,    FR_DEMI,  0,        0},
+    {ZEIT_NAECHSTE_STUNDE, FR_MOINS, FR_VINGT, FR_TRAIT, FR_CINQ},
+    {ZEIT_NAECHSTE_STUNDE, FR_MOINS, FR_VINGT, 0,        0},
+    {ZEIT_NAECHSTE_STUNDE, FR_MOINS, FR_LE,    FR_QUART, 0},
+    {ZEIT_NAECHSTE_STUNDE, FR_MOINS, FR_DIX,   0,        0},
+    {ZEIT_NAECHSTE_STUNDE, FR_MOINS, FR_CINQ,  0,        0}
+};
+
+// MIDI und MINUIT ohne HEURES, UNE mit HEURE.
+extern const byte FR_HOURS[24][ZEIT_HOURS_WIDTH] PROGMEM;
+const byte FR_HOURS[24][ZEIT_HOURS_WIDTH] = {
+    {FR_H_MINUIT, FR_H_MINUIT, 0},
+    {FR_H_UNE,    FR_H_UNE,    FR_HEURE},
+    {FR_H_DEUX,   FR_H_DEUX,   FR_HEURES},
+    {FR_H_TROIS,  FR_H_TROIS,  FR_HEURES},
+    {FR_H_QUATRE, FR_H_QUATRE, FR_HEURES},
+    {FR_H_CINQ,   FR_H_CINQ,   FR_HEURES},
+    {FR_H_SIX,    FR_H_SIX,    FR_HEURES},
+    {FR_H_SEPT,   FR_H_SEPT,   FR_HEURES},
+    {FR_H_HUIT,   FR_H_HUIT,   FR_HEURES},
+    {FR_H_NEUF,   FR_H_NEUF,   FR_HEURES},
+    {FR_H_DIX,    FR_H_DIX,    FR_HEURES},
+    {FR_H_ONZE,   FR_H_ONZE,   FR_HEURES},
+    {FR_H_MIDI,   FR_H_MIDI,   0},
+    {FR_H_UNE,    FR_H_UNE,    FR_HEURE},
+    {FR_H_DEUX,   FR_H_DEUX,   FR_HEURES},
+    {FR_H_TROIS,  FR_H_TROIS,  FR_HEURES},
+    {FR_H_QUATRE, FR_H_QUATRE, FR_HEURES},
+    {FR_H_CINQ,   FR_H_CINQ,   FR_HEURES},
+    {FR_H_SIX,    FR_H_SIX,    FR_HEURES},
+    {FR_H_SEPT,   FR_H_SEPT,   FR_HEURES},
+    {FR_H_HUIT,   FR_H_HUIT,   FR_HEURES},
+    {FR_H_NEUF,   FR_H_NEUF,   FR_HEURES},
+    {FR_H_DIX,    FR_H_DIX,    FR_HEURES},
+    {FR_H_ONZE,   FR_H_ONZE,   FR_HEURES}
+};
+#endif
+
+#ifdef ENABLE_LANGUAGE_IT
+/**
+ * Italienisch
+ */
+extern const byte IT_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte IT_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {ZEIT_GLATT,           0,       0,         0,         0},
+    {0,                    IT_E2,   IT_CINQUE, 0,         0},
+    {0,                    IT_E2,   IT_DIECI,  0,         0},
+    {0,                    IT_E2,   IT_UN,     IT_QUARTO, 0},
+    {0,                    IT_E2,   IT_VENTI,  0,         0},
+    {0,                    IT_E2,   IT_VENTI,  IT_CINQUE, 0},
+    {0,                    IT_E2,   IT_MEZZA,  0,         0},
+    {ZEIT_NAECHSTE_STUNDE, IT_MENO, IT_VENTI,  IT_CINQUE, 0},
+    {ZEIT_NAECHSTE_STUNDE, IT_MENO, IT_VENTI,  0,         0},
+    {ZEIT_NAECHSTE_STUNDE, IT_MENO, IT_UN,     IT_QUARTO, 0},
+    {ZEIT_NAECHSTE_STUNDE, IT_MENO, IT_DIECI,  0,         0},
+    {ZEIT_NAECHSTE_STUNDE, IT_MENO, IT_CINQUE, 0,         0}
+};
+
+// L'UNA mit E, sonst SONO LE.
+extern const byte IT_HOURS[12][ZEIT_HOURS_WIDTH] PROGMEM;
+const byte IT_HOURS[12][ZEIT_HOURS_WIDTH] = {
+    {IT_H_DODICI,  IT_H_DODICI,  IT_SONOLE},
+    {IT_H_LUNA,    IT_H_LUNA,    IT_E},
+    {IT_H_DUE,     IT_H_DUE,     IT_SONOLE},
+    {IT_H_TRE,     IT_H_TRE,     IT_SONOLE},
+    {IT_H_QUATTRO, IT_H_QUATTRO, IT_SONOLE},
+    {IT_H_CINQUE,  IT_H_CINQUE,  IT_SONOLE},
+    {IT_H_SEI,     IT_H_SEI,     IT_SONOLE},
+    {IT_H_SETTE,   IT_H_SETTE,   IT_SONOLE},
+    {IT_H_OTTO,    IT_H_OTTO,    IT_SONOLE},
+    {IT_H_NOVE,    IT_H_NOVE,    IT_SONOLE},
+    {IT_H_DIECI,   IT_H_DIECI,   IT_SONOLE},
+    {IT_H_UNDICI,  IT_H_UNDICI,  IT_SONOLE}
+};
+#endif
+
+#ifdef ENABLE_LANGUAGE_NL
+/**
+ * Niederlaendisch
+ */
+extern const byte NL_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte NL_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {ZEIT_GLATT,           0,        0,        0,       0},
+    {0,                    NL_VIJF,  NL_OVER,  0,       0},
+    {0,                    NL_TIEN,  NL_OVER,  0,       0},
+    {0,                    NL_KWART, NL_OVER2, 0,       0},
+    {ZEIT_NAECHSTE_STUNDE, NL_TIEN,  NL_VOOR,  NL_HALF, 0},
+    {ZEIT_NAECHSTE_STUNDE, NL_VIJF,  NL_VOOR,  NL_HALF, 0},
+    {ZEIT_NAECHSTE_STUNDE, NL_HALF,  0,        0,       0},
+    {ZEIT_NAECHSTE_STUNDE, NL_VIJF,  NL_OVER,  NL_HALF, 0},
+    {ZEIT_NAECHSTE_STUNDE, NL_TIEN,  NL_OVER,  NL_HALF, 0},
+    {ZEIT_NAECHSTE_STUNDE, NL_KWART, NL_VOOR2, 0,       0},
+    {ZEIT_NAECHSTE_STUNDE, NL_TIEN,  NL_VOOR,  0,       0},
+    {ZEIT_NAECHSTE_STUNDE, NL_VIJF,  NL_VOOR,  0,       0}
+};
+
+extern const byte NL_HOURS[12][ZEIT_HOURS_WIDTH] PROGMEM;
+const byte NL_HOURS[12][ZEIT_HOURS_WIDTH] = {
+    {NL_H_TWAALF, NL_H_TWAALF, 0},
+    {NL_H_EEN,    NL_H_EEN,    0},
+    {NL_H_TWEE,   NL_H_TWEE,   0},
+    {NL_H_DRIE,   NL_H_DRIE,   0},
+    {NL_H_VIER,   NL_H_VIER,   0},
+    {NL_H_VIJF,   NL_H_VIJF,   0},
+    {NL_H_ZES,    NL_H_ZES,    0},
+    {NL_H_ZEVEN,  NL_H_ZEVEN,  0},
+    {NL_H_ACHT,   NL_H_ACHT,   0},
+    {NL_H_NEGEN,  NL_H_NEGEN,  0},
+    {NL_H_TIEN,   NL_H_TIEN,   0},
+    {NL_H_ELF,    NL_H_ELF,    0}
+};
+#endif
+
+#ifdef ENABLE_LANGUAGE_ES
+/**
+ * Spanisch
+ */
+extern const byte ES_MINUTES[12][ZEIT_MINUTES_WIDTH] PROGMEM;
+const byte ES_MINUTES[12][ZEIT_MINUTES_WIDTH] = {
+    {0,                    0,        0,              0, 0},
+    {0,                    ES_Y,     ES_CINCO,       0, 0},
+    {0,                    ES_Y,     ES_DIEZ,        0, 0},
+    {0,                    ES_Y,     ES_CUARTO,      0, 0},
+    {0,                    ES_Y,     ES_VEINTE,      0, 0},
+    {0,                    ES_Y,     ES_VEINTICINCO, 0, 0},
+    {0,                    ES_Y,     ES_MEDIA,       0, 0},
+    {ZEIT_NAECHSTE_STUNDE, ES_MENOS, ES_VEINTICINCO, 0, 0},
+    {ZEIT_NAECHSTE_STUNDE, ES_MENOS, ES_VEINTE,      0, 0},
+    {ZEIT_NAECHSTE_STUNDE, ES_MENOS, ES_CUARTO,      0, 0},
+    {ZEIT_NAECHSTE_STUNDE, ES_MENOS, ES_DIEZ,        0, 0},
+    {ZEIT_NAECHSTE_STUNDE, ES_MENOS, ES_CINCO,       0, 0}
+};
+
+// ES LA UNA, sonst SON LAS.
+extern const byte ES_HOURS[12][ZEIT_HOURS_WIDTH] PROGMEM;
+const byte ES_HOURS[12][ZEIT_HOURS_WIDTH] = {
+    {ES_H_DOCE,   ES_H_DOCE,   ES_SONLAS},
+    {ES_H_UNA,    ES_H_UNA,    ES_ESLA},
+    {ES_H_DOS,    ES_H_DOS,    ES_SONLAS},
+    {ES_H_TRES,   ES_H_TRES,   ES_SONLAS},
+    {ES_H_CUATRO, ES_H_CUATRO, ES_SONLAS},
+    {ES_H_CINCO,  ES_H_CINCO,  ES_SONLAS},
+    {ES_H_SEIS,   ES_H_SEIS,   ES_SONLAS},
+    {ES_H_SIETE,  ES_H_SIETE,  ES_SONLAS},
+    {ES_H_OCHO,   ES_H_OCHO,   ES_SONLAS},
+    {ES_H_NUEVE,  ES_H_NUEVE,  ES_SONLAS},
+    {ES_H_DIEZ,   ES_H_DIEZ,   ES_SONLAS},
+    {ES_H_ONCE,   ES_H_ONCE,   ES_SONLAS}
+};
+#endif
+
+#endif
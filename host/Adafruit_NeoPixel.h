@@ -0,0 +1,16 @@
+/**
+ * Adafruit_NeoPixel (Host)
+ * Die Firmware bindet die Library immer ein, benutzt sie aber nur mit ihrem LED-Treiber. Auf dem Host gibt es nur LED_DRIVER_DEFAULT und LED_DRIVER_BAM.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_ADAFRUIT_NEOPIXEL_H
+#define HOST_ADAFRUIT_NEOPIXEL_H
+
+#endif
@@ -0,0 +1,184 @@
+/**
+ * Arduino (Host)
+ * Ersatz fuer die Arduino-Umgebung, damit die Firmware unter Linux uebersetzt und
+ * ausgefuehrt werden kann (siehe HostHal.h). Nur was die Firmware wirklich benutzt.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+#include "binary.h"
+
+#ifndef ARDUINO
+#define ARDUINO 10607
+#endif
+
+typedef uint8_t byte;
+typedef uint16_t word;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define SDA 18
+#define SCL 19
+#define LED_BUILTIN 13
+
+#define NUM_DIGITAL_PINS 20
+
+/*
+ * min() und max() sind hier Templates statt Makros, sonst gehen die
+ * Header der Standardbibliothek in den Tests kaputt.
+ */
+template <class A, class B> inline A min(A a, B b) {
+    return (b < a) ? (A)b : a;
+}
+template <class A, class B> inline A max(A a, B b) {
+    return (a < b) ? (A)b : a;
+}
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define bit(b) (1UL << (b))
+
+inline word makeWord(unsigned int w) {
+    return w;
+}
+inline word makeWord(byte h, byte l) {
+    return ((word)h << 8) | l;
+}
+#define word(...) makeWord(__VA_ARGS__)
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(PSTR(string_literal)))
+
+#define interrupts() sei()
+#define noInterrupts() cli()
+
+#define digitalPinToInterrupt(p) ((p) == 2 ? 0 : ((p) == 3 ? 1 : -1))
+
+/*
+ * Pins auf Ports wie beim ATmega328P: D0-D7 PORTD, D8-D13 PORTB, A0-A5 PORTC.
+ */
+#define digitalPinToPort(p) ((p) < 8 ? 4 : ((p) < 14 ? 2 : 3))
+#define digitalPinToBitMask(p) ((uint8_t)(1 << ((p) < 8 ? (p) : ((p) < 14 ? (p) - 8 : (p) - 14))))
+#define portInputRegister(P) (&_SFR_MEM8((P) == 2 ? 0x23 : ((P) == 3 ? 0x26 : 0x29)).value)
+#define digitalPinToPCICR(p) (&PCICR)
+#define digitalPinToPCICRbit(p) ((p) < 8 ? 2 : ((p) < 14 ? 0 : 1))
+#define digitalPinToPCMSK(p) ((p) < 8 ? &PCMSK2 : ((p) < 14 ? &PCMSK0 : &PCMSK1))
+#define digitalPinToPCMSKbit(p) ((p) < 8 ? (p) : ((p) < 14 ? (p) - 8 : (p) - 14))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(), int mode);
+void detachInterrupt(uint8_t interruptNum);
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t pin);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+/**
+ * Die serielle Schnittstelle. Ausgaben landen in einem Puffer (halSerialOutput()),
+ * Eingaben kommen aus halSerialInput().
+ */
+class HardwareSerial {
+public:
+    void begin(unsigned long baud);
+    void end();
+    int available();
+    int read();
+    int peek();
+    void flush();
+    long parseInt();
+    void setTimeout(unsigned long timeout);
+
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str);
+
+    size_t print(const __FlashStringHelper* str);
+    size_t print(const char* str);
+    size_t print(char c);
+    size_t print(unsigned char n, int base = DEC);
+    size_t print(int n, int base = DEC);
+    size_t print(unsigned int n, int base = DEC);
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+
+    size_t println();
+    template <class T> size_t println(T value) {
+        size_t n = print(value);
+        return n + println();
+    }
+    template <class T> size_t println(T value, int format) {
+        size_t n = print(value, format);
+        return n + println();
+    }
+
+private:
+    size_t printNumber(unsigned long n, uint8_t base);
+    unsigned long _timeout = 1000;
+};
+
+extern HardwareSerial Serial;
+
+void setup();
+void loop();
+
+#endif
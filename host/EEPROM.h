@@ -0,0 +1,37 @@
+/**
+ * EEPROM (Host)
+ * Die EEPROM-Library, liest und schreibt das EEPROM aus HostHal.cpp.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+#include "Arduino.h"
+#include <avr/eeprom.h>
+
+class EEPROMClass {
+public:
+    uint8_t read(int address) {
+        return eeprom_read_byte((const uint8_t*)(uintptr_t)address);
+    }
+    void write(int address, uint8_t value) {
+        eeprom_write_byte((uint8_t*)(uintptr_t)address, value);
+    }
+    void update(int address, uint8_t value) {
+        eeprom_update_byte((uint8_t*)(uintptr_t)address, value);
+    }
+    uint16_t length() {
+        return E2END + 1;
+    }
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,355 @@
+/**
+ * HostArduino
+ * Die Arduino-Bibliotheken auf dem Host: Serial, Wire, EEPROM, random(), map().
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostHal.h"
+#include "HostHalIntern.h"
+#include "Wire.h"
+#include "EEPROM.h"
+
+HardwareSerial Serial;
+TwoWire Wire;
+EEPROMClass EEPROM;
+
+/******************************************************************************
+ * Serial
+ ******************************************************************************/
+
+#define HAL_SERIAL_BUFFER 65536
+
+static char _serialOut[HAL_SERIAL_BUFFER];
+static size_t _serialOutLength;
+static char _serialIn[1024];
+static size_t _serialInHead;
+static size_t _serialInLength;
+static boolean _serialEcho;
+
+void halSerialReset() {
+    _serialOutLength = 0;
+    _serialOut[0] = 0;
+    _serialInHead = 0;
+    _serialInLength = 0;
+}
+
+void halSerialInput(const char* text) {
+    size_t n = strlen(text);
+    if (_serialInHead > 0) {
+        memmove(_serialIn, _serialIn + _serialInHead, _serialInLength - _serialInHead);
+        _serialInLength -= _serialInHead;
+        _serialInHead = 0;
+    }
+    n = min(n, sizeof(_serialIn) - _serialInLength);
+    memcpy(_serialIn + _serialInLength, text, n);
+    _serialInLength += n;
+}
+
+const char* halSerialOutput() {
+    return _serialOut;
+}
+
+void halSerialClear() {
+    _serialOutLength = 0;
+    _serialOut[0] = 0;
+}
+
+void halSerialEcho(boolean echo) {
+    _serialEcho = echo;
+}
+
+void HardwareSerial::begin(unsigned long) {
+}
+
+void HardwareSerial::end() {
+}
+
+int HardwareSerial::available() {
+    return _serialInLength - _serialInHead;
+}
+
+int HardwareSerial::read() {
+    if (_serialInHead >= _serialInLength) {
+        return -1;
+    }
+    return (uint8_t)_serialIn[_serialInHead++];
+}
+
+int HardwareSerial::peek() {
+    if (_serialInHead >= _serialInLength) {
+        return -1;
+    }
+    return (uint8_t)_serialIn[_serialInHead];
+}
+
+void HardwareSerial::flush() {
+}
+
+void HardwareSerial::setTimeout(unsigned long timeout) {
+    _timeout = timeout;
+}
+
+/*
+ * Wie Stream::parseInt(): Zeichen bis zur ersten Ziffer (oder '-') ueberspringen,
+ * dann Ziffern lesen. Ohne Zeichen wartet das Original _timeout Millisekunden.
+ */
+long HardwareSerial::parseInt() {
+    while ((peek() >= 0) && (peek() != '-') && ((peek() < '0') || (peek() > '9'))) {
+        read();
+    }
+    if (peek() < 0) {
+        delay(_timeout);
+        return 0;
+    }
+    boolean negative = false;
+    long value = 0;
+    if (peek() == '-') {
+        negative = true;
+        read();
+    }
+    while ((peek() >= '0') && (peek() <= '9')) {
+        value = value * 10 + (read() - '0');
+    }
+    return negative ? -value : value;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (_serialOutLength + 1 < HAL_SERIAL_BUFFER) {
+        _serialOut[_serialOutLength++] = c;
+        _serialOut[_serialOutLength] = 0;
+    }
+    if (_serialEcho) {
+        putchar(c);
+    }
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        write(buffer[i]);
+    }
+    return size;
+}
+
+size_t HardwareSerial::write(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t HardwareSerial::print(const __FlashStringHelper* str) {
+    return write((const char*)str);
+}
+
+size_t HardwareSerial::print(const char* str) {
+    return write(str);
+}
+
+size_t HardwareSerial::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t HardwareSerial::print(unsigned char n, int base) {
+    return printNumber(n, base);
+}
+
+size_t HardwareSerial::print(int n, int base) {
+    return print((long)n, base);
+}
+
+size_t HardwareSerial::print(unsigned int n, int base) {
+    return printNumber(n, base);
+}
+
+size_t HardwareSerial::print(long n, int base) {
+    if ((base == 10) && (n < 0)) {
+        return write('-') + printNumber(-n, 10);
+    }
+    return printNumber((unsigned long)n, base);
+}
+
+size_t HardwareSerial::print(unsigned long n, int base) {
+    return printNumber(n, base);
+}
+
+size_t HardwareSerial::print(double n, int digits) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, n);
+    return write(buffer);
+}
+
+size_t HardwareSerial::println() {
+    return write("\r\n");
+}
+
+size_t HardwareSerial::printNumber(unsigned long n, uint8_t base) {
+    char buffer[8 * sizeof(long) + 1];
+    char* p = &buffer[sizeof(buffer) - 1];
+    *p = 0;
+    if (base < 2) {
+        base = 10;
+    }
+    do {
+        unsigned long digit = n % base;
+        n /= base;
+        *--p = (digit < 10) ? ('0' + digit) : ('A' + digit - 10);
+    } while (n);
+    return write(p);
+}
+
+/******************************************************************************
+ * Wire
+ ******************************************************************************/
+
+void TwoWire::begin() {
+    // 100kHz wie die Wire-Library
+    TWBR = ((F_CPU / 100000UL) - 16) / 2;
+    _txLength = 0;
+    _rxIndex = 0;
+    _rxLength = 0;
+    _busOwned = false;
+}
+
+void TwoWire::setClock(uint32_t clock) {
+    TWBR = ((F_CPU / clock) - 16) / 2;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    _address = address;
+    _txLength = 0;
+}
+
+void TwoWire::beginTransmission(int address) {
+    beginTransmission((uint8_t)address);
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (_txLength >= BUFFER_LENGTH) {
+        return 0;
+    }
+    _txBuffer[_txLength++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t quantity) {
+    for (size_t i = 0; i < quantity; i++) {
+        write(data[i]);
+    }
+    return quantity;
+}
+
+/*
+ * 0: ok, 2: Adresse nicht bestaetigt, 3: Daten nicht bestaetigt.
+ */
+uint8_t TwoWire::endTransmission(uint8_t sendStop) {
+    uint64_t bit = halI2cBitCycles();
+    HalI2cDevice* device = halI2cDevice(_address);
+    uint8_t result = 0;
+    halBlock(bit + 9 * bit);
+    halCounters().i2cBytes++;
+    if (!device || !device->i2cStart(false)) {
+        result = 2;
+    } else {
+        for (uint8_t i = 0; i < _txLength; i++) {
+            halBlock(9 * bit);
+            halCounters().i2cBytes++;
+            if (!device->i2cWrite(_txBuffer[i])) {
+                result = 3;
+                break;
+            }
+        }
+    }
+    _txLength = 0;
+    if (sendStop || result) {
+        halBlock(bit);
+        if (device) {
+            device->i2cStop();
+        }
+        _busOwned = false;
+    } else {
+        _busOwned = true;
+    }
+    return result;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+    uint64_t bit = halI2cBitCycles();
+    HalI2cDevice* device = halI2cDevice(address);
+    quantity = min(quantity, (uint8_t)BUFFER_LENGTH);
+    _rxIndex = 0;
+    _rxLength = 0;
+    halBlock(bit + 9 * bit);
+    halCounters().i2cBytes++;
+    if (device && device->i2cStart(true)) {
+        for (uint8_t i = 0; i < quantity; i++) {
+            halBlock(9 * bit);
+            halCounters().i2cBytes++;
+            _rxBuffer[_rxLength++] = device->i2cRead();
+        }
+    }
+    halBlock(bit);
+    if (device) {
+        device->i2cStop();
+    }
+    _busOwned = false;
+    return _rxLength;
+}
+
+uint8_t TwoWire::requestFrom(int address, int quantity) {
+    return requestFrom((uint8_t)address, (uint8_t)quantity);
+}
+
+int TwoWire::available() {
+    return _rxLength - _rxIndex;
+}
+
+int TwoWire::read() {
+    if (_rxIndex >= _rxLength) {
+        return -1;
+    }
+    return _rxBuffer[_rxIndex++];
+}
+
+/******************************************************************************
+ * random(), map()
+ ******************************************************************************/
+
+static unsigned long _random;
+
+void halRandomReset() {
+    _random = 1;
+}
+
+void randomSeed(unsigned long seed) {
+    if (seed) {
+        _random = seed;
+    }
+}
+
+long random(long howbig) {
+    if (howbig == 0) {
+        return 0;
+    }
+    // Park-Miller wie die avr-libc
+    _random = (unsigned long)(((uint64_t)_random * 16807UL) % 2147483647UL);
+    return _random % howbig;
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) {
+        return howsmall;
+    }
+    return random(howbig - howsmall) + howsmall;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    if (in_max == in_min) {
+        // Der AVR rechnet bei Division durch 0 ohne Ausnahme weiter.
+        return out_min;
+    }
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
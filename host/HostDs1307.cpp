@@ -0,0 +1,205 @@
+/**
+ * HostDs1307
+ * Eine DS1307 am I2C-Bus des Host-HAL (siehe HostDs1307.h).
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostDs1307.h"
+
+static const uint8_t daysInMonth[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+static uint8_t monthDays(uint8_t month, uint8_t year) {
+    return daysInMonth[month - 1] + (((month == 2) && ((year & 3) == 0)) ? 1 : 0);
+}
+
+static uint8_t toBcd(uint8_t v) {
+    return ((v / 10) << 4) | (v % 10);
+}
+
+static uint8_t fromBcd(uint8_t v) {
+    return (v >> 4) * 10 + (v & 0x0F);
+}
+
+HostDs1307::HostDs1307(uint8_t sqwPin) {
+    _sqwPin = sqwPin;
+    memset(_registers, 0, sizeof(_registers));
+    _pointer = 0;
+    _pointerSet = false;
+    _timeWritten = false;
+    _time = 0;
+    _secondStart = 0;
+    _secondCycles = F_CPU;
+    _halfSecond = false;
+    _reads = 0;
+    _writes = 0;
+}
+
+void HostDs1307::attach() {
+    halAttachI2c(0x68, this);
+    halAttachDevice(this);
+    _secondStart = halCycles();
+    _halfSecond = false;
+    updateSqw();
+}
+
+void HostDs1307::setTime(uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t date, uint8_t month, uint8_t year) {
+    _registers[0] = toBcd(seconds);
+    _registers[1] = toBcd(minutes);
+    _registers[2] = toBcd(hours);
+    _registers[3] = 1;
+    _registers[4] = toBcd(date);
+    _registers[5] = toBcd(month);
+    _registers[6] = toBcd(year);
+    registersToTime();
+    _secondStart = halCycles();
+    _halfSecond = false;
+    updateSqw();
+}
+
+uint32_t HostDs1307::getTime() {
+    return _time;
+}
+
+void HostDs1307::setDrift(double ppm) {
+    _secondCycles = (uint64_t)(F_CPU * (1.0 + ppm / 1e6) + 0.5);
+}
+
+uint32_t HostDs1307::getReads() {
+    return _reads;
+}
+
+uint32_t HostDs1307::getWrites() {
+    return _writes;
+}
+
+/*
+ * Wie der Chip: beim Start werden die Zeitregister aus dem Zaehler kopiert.
+ */
+bool HostDs1307::i2cStart(bool read) {
+    if (read) {
+        timeToRegisters();
+        _reads++;
+    } else {
+        _pointerSet = false;
+        _writes++;
+    }
+    return true;
+}
+
+bool HostDs1307::i2cWrite(uint8_t data) {
+    if (!_pointerSet) {
+        _pointer = data & 0x3F;
+        _pointerSet = true;
+        return true;
+    }
+    if (_pointer == 0) {
+        // Sekunden schreiben setzt den Teiler zurueck.
+        _secondStart = halCycles();
+        _halfSecond = false;
+    }
+    if (_pointer < 7) {
+        if (!_timeWritten) {
+            timeToRegisters();
+        }
+        _timeWritten = true;
+    }
+    _registers[_pointer] = data;
+    _pointer = (_pointer + 1) & 0x3F;
+    return true;
+}
+
+uint8_t HostDs1307::i2cRead() {
+    uint8_t data = _registers[_pointer];
+    _pointer = (_pointer + 1) & 0x3F;
+    return data;
+}
+
+void HostDs1307::i2cStop() {
+    if (_timeWritten) {
+        registersToTime();
+        _timeWritten = false;
+    }
+    updateSqw();
+}
+
+uint64_t HostDs1307::nextEvent() {
+    return _secondStart + (_halfSecond ? _secondCycles : _secondCycles / 2);
+}
+
+void HostDs1307::event() {
+    if (_halfSecond) {
+        _secondStart += _secondCycles;
+        _halfSecond = false;
+        // Clock-Halt-Bit: die Uhr steht
+        if (!(_registers[0] & 0x80)) {
+            _time++;
+        }
+    } else {
+        _halfSecond = true;
+    }
+    updateSqw();
+}
+
+/*
+ * SQWE (Bit 4) mit RS = 0 gibt 1Hz aus: LOW in der ersten, HIGH in der zweiten
+ * Sekundenhaelfte. Ohne SQWE steht der Pin auf OUT (Bit 7).
+ */
+void HostDs1307::updateSqw() {
+    uint8_t control = _registers[7];
+    uint8_t level;
+    if (control & 0x10) {
+        level = _halfSecond ? HIGH : LOW;
+    } else {
+        level = (control & 0x80) ? HIGH : LOW;
+    }
+    if (halGetPin(_sqwPin) != level) {
+        halSetPin(_sqwPin, level);
+    }
+}
+
+void HostDs1307::timeToRegisters() {
+    uint32_t t = _time;
+    uint8_t seconds = t % 60;
+    t /= 60;
+    uint8_t minutes = t % 60;
+    t /= 60;
+    uint8_t hours = t % 24;
+    uint32_t days = t / 24;
+    uint8_t year = 0;
+    while (days >= (uint32_t)((year & 3) ? 365 : 366)) {
+        days -= (year & 3) ? 365 : 366;
+        year++;
+    }
+    uint8_t month = 1;
+    while (days >= monthDays(month, year)) {
+        days -= monthDays(month, year);
+        month++;
+    }
+    _registers[0] = (_registers[0] & 0x80) | toBcd(seconds);
+    _registers[1] = toBcd(minutes);
+    _registers[2] = toBcd(hours);
+    _registers[4] = toBcd(days + 1);
+    _registers[5] = toBcd(month);
+    _registers[6] = toBcd(year);
+}
+
+void HostDs1307::registersToTime() {
+    uint8_t year = fromBcd(_registers[6]);
+    uint8_t month = constrain(fromBcd(_registers[5] & 0x1F), 1, 12);
+    uint8_t date = constrain(fromBcd(_registers[4] & 0x3F), 1, 31);
+    uint32_t days = 0;
+    for (uint8_t y = 0; y < year; y++) {
+        days += (y & 3) ? 365 : 366;
+    }
+    for (uint8_t m = 1; m < month; m++) {
+        days += monthDays(m, year);
+    }
+    days += date - 1;
+    _time = ((days * 24 + fromBcd(_registers[2] & 0x3F)) * 60 + fromBcd(_registers[1] & 0x7F)) * 60 + fromBcd(_registers[0] & 0x7F);
+}
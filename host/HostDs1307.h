@@ -0,0 +1,60 @@
+/**
+ * HostDs1307
+ * Eine DS1307 am I2C-Bus des Host-HAL: Zeitregister in BCD, RAM, Control-Register
+ * und das SQW-Signal (1Hz, fallende Flanke zum Sekundenwechsel) an einem Pin.
+ * Die Uhr kann um drift ppm falsch gehen.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOSTDS1307_H
+#define HOSTDS1307_H
+
+#include "HostHal.h"
+
+class HostDs1307 : public HalI2cDevice, public HalDevice {
+public:
+    explicit HostDs1307(uint8_t sqwPin);
+
+    // Am Bus (Adresse 0x68) und an der Zeit anmelden.
+    void attach();
+
+    void setTime(uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t date, uint8_t month, uint8_t year);
+    // Sekunden seit 1.1.2000 00:00:00
+    uint32_t getTime();
+    void setDrift(double ppm);
+    uint32_t getReads();
+    uint32_t getWrites();
+
+    bool i2cStart(bool read);
+    bool i2cWrite(uint8_t data);
+    uint8_t i2cRead();
+    void i2cStop();
+
+    uint64_t nextEvent();
+    void event();
+
+private:
+    uint8_t _sqwPin;
+    uint8_t _registers[64];
+    uint8_t _pointer;
+    bool _pointerSet;
+    bool _timeWritten;
+    uint32_t _time;
+    uint64_t _secondStart;
+    uint64_t _secondCycles;
+    bool _halfSecond;
+    uint32_t _reads;
+    uint32_t _writes;
+
+    void timeToRegisters();
+    void registersToTime();
+    void updateSqw();
+};
+
+#endif
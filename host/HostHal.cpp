@@ -0,0 +1,1101 @@
+/**
+ * HostHal
+ * Die Hardware des ATmega328P auf dem Host (siehe HostHal.h): virtuelle Zeit,
+ * Register, Interrupts, Timer1/2, Pins, SPI, USART im SPI-Modus, TWI, EEPROM.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostHal.h"
+#include "HostHalIntern.h"
+#include <avr/eeprom.h>
+#include <util/twi.h>
+
+HalRegister8 halIo[256];
+HalRegister16 halIo16[256];
+
+/*
+ * Die ISRs der Firmware. Fehlt eine, bleibt der Zeiger 0.
+ */
+extern "C" {
+void __vector_1(void) __attribute__((weak));
+void __vector_2(void) __attribute__((weak));
+void __vector_3(void) __attribute__((weak));
+void __vector_4(void) __attribute__((weak));
+void __vector_5(void) __attribute__((weak));
+void __vector_7(void) __attribute__((weak));
+void __vector_8(void) __attribute__((weak));
+void __vector_9(void) __attribute__((weak));
+void __vector_11(void) __attribute__((weak));
+void __vector_12(void) __attribute__((weak));
+void __vector_13(void) __attribute__((weak));
+void __vector_24(void) __attribute__((weak));
+}
+
+// Ein Zugriff auf ein Statusregister in einer Warteschleife (LDS, SBRS, RJMP).
+#define HAL_POLL_CYCLES 4
+// Ein EEPROM-Schreibvorgang dauert 3.4ms.
+#define HAL_EEPROM_WRITE_CYCLES (3400UL * HAL_CYCLES_PER_US)
+// Registerzugriffe in eeprom_read_byte()/eeprom_write_byte() der avr-libc:
+// EECR abfragen, EEARL/EEARH setzen, EECR setzen, EEDR lesen bzw. schreiben.
+#define HAL_EEPROM_ACCESSES 5
+
+static uint64_t _now;
+static HalCounters _counters;
+static boolean _costModel;
+static uint8_t _accessDepth;
+
+void halAdvance(uint64_t cycles);
+
+/*
+ * Rechenzeit nach dem Kostenmodell.
+ */
+static void charge(uint64_t cycles) {
+    if (_costModel) {
+        halAdvance(cycles);
+    }
+}
+
+void halAccessBegin() {
+    _accessDepth++;
+}
+
+/*
+ * Erst nach dem Zugriff kostet er Zeit, ein Interrupt kann also nicht
+ * zwischen Lesen und Schreiben fallen (wie bei SBI/CBI).
+ */
+void halAccessEnd() {
+    if (--_accessDepth == 0) {
+        charge(HAL_ACCESS_CYCLES);
+    }
+}
+
+/******************************************************************************
+ * Pins
+ ******************************************************************************/
+
+static uint8_t _extLevel[NUM_DIGITAL_PINS];
+static boolean _driven[NUM_DIGITAL_PINS];
+static int _analog[NUM_DIGITAL_PINS];
+static unsigned int _tone[NUM_DIGITAL_PINS];
+static void (*_pinHook)(uint8_t pin, uint8_t level);
+static void (*_shiftHook)(uint8_t data, boolean lsbFirst);
+
+/*
+ * Adresse des PINx-Registers und Bit eines Arduino-Pins (DDRx und PORTx folgen).
+ */
+static uint8_t pinBase(uint8_t pin) {
+    return (pin < 8) ? 0x29 : ((pin < 14) ? 0x23 : 0x26);
+}
+
+static uint8_t pinBit(uint8_t pin) {
+    return (pin < 8) ? pin : ((pin < 14) ? pin - 8 : pin - 14);
+}
+
+static uint8_t basePin(uint8_t base, uint8_t bit) {
+    return (base == 0x29) ? bit : ((base == 0x23) ? bit + 8 : bit + 14);
+}
+
+static uint8_t pinCount(uint8_t base) {
+    return (base == 0x29) ? 8 : 6;
+}
+
+/*
+ * Die Eingangsregister eines Ports neu berechnen und auf Flanken reagieren.
+ */
+static void updatePort(uint8_t base) {
+    uint8_t ddr = halIo[base + 1].value;
+    uint8_t port = halIo[base + 2].value;
+    uint8_t levels = 0;
+    for (uint8_t b = 0; b < pinCount(base); b++) {
+        uint8_t pin = basePin(base, b);
+        uint8_t level;
+        if (ddr & _BV(b)) {
+            level = (port >> b) & 1;
+        } else if (_driven[pin]) {
+            level = _extLevel[pin];
+        } else {
+            // offener Eingang: Pull-Up oder LOW
+            level = (port >> b) & 1;
+        }
+        levels |= level << b;
+    }
+    uint8_t changed = halIo[base].value ^ levels;
+    halIo[base].value = levels;
+    if (!changed) {
+        return;
+    }
+
+    // Pin-Change-Interrupts
+    uint8_t pcmsk = (base == 0x23) ? 0x6B : ((base == 0x26) ? 0x6C : 0x6D);
+    uint8_t pcif = (base == 0x23) ? PCIF0 : ((base == 0x26) ? PCIF1 : PCIF2);
+    if (changed & halIo[pcmsk].value) {
+        halIo[0x3B].value |= _BV(pcif);
+    }
+    // INT0 (D2) und INT1 (D3)
+    if (base == 0x29) {
+        for (uint8_t i = 0; i < 2; i++) {
+            uint8_t b = i + 2;
+            if (changed & _BV(b)) {
+                uint8_t sense = (halIo[0x69].value >> (2 * i)) & 3;
+                uint8_t level = (levels >> b) & 1;
+                if ((sense == 1) || ((sense == 2) && !level) || ((sense == 3) && level)) {
+                    halIo[0x3C].value |= _BV(i);
+                }
+            }
+        }
+    }
+    if (_pinHook) {
+        for (uint8_t b = 0; b < pinCount(base); b++) {
+            if (changed & _BV(b)) {
+                _pinHook(basePin(base, b), (levels >> b) & 1);
+            }
+        }
+    }
+}
+
+/******************************************************************************
+ * Timer1 und Timer2
+ ******************************************************************************/
+
+struct HalTimer {
+    uint8_t tccrA;
+    uint8_t tccrB;
+    uint8_t tifr;
+    uint8_t timsk;
+    boolean wide;
+    uint64_t t0;        // Zeitpunkt, zu dem der Zaehler count0 hatte
+    uint32_t count0;
+    uint32_t frozen;    // Zaehlerstand bei gestopptem Timer
+    boolean doneA;      // Compare-Match A in dieser Runde schon gewesen
+    boolean doneB;
+};
+
+static HalTimer _timer1 = { 0x80, 0x81, 0x36, 0x6F, true, 0, 0, 0, false, false };
+static HalTimer _timer2 = { 0xB0, 0xB1, 0x37, 0x70, false, 0, 0, 0, false, false };
+
+static uint32_t prescaler(HalTimer& t) {
+    static const uint16_t p1[8] = { 0, 1, 8, 64, 256, 1024, 0, 0 };
+    static const uint16_t p2[8] = { 0, 1, 8, 32, 64, 128, 256, 1024 };
+    uint8_t cs = halIo[t.tccrB].value & 7;
+    return t.wide ? p1[cs] : p2[cs];
+}
+
+static uint32_t ocrA(HalTimer& t) {
+    return t.wide ? halIo16[0x88].value : halIo[0xB3].value;
+}
+
+static uint32_t ocrB(HalTimer& t) {
+    return t.wide ? halIo16[0x8A].value : halIo[0xB4].value;
+}
+
+static uint32_t timerMax(HalTimer& t) {
+    return t.wide ? 0xFFFF : 0xFF;
+}
+
+static boolean isCtc(HalTimer& t) {
+    if (t.wide) {
+        return (halIo[0x81].value & (_BV(WGM13) | _BV(WGM12))) == _BV(WGM12) && !(halIo[0x80].value & 3);
+    }
+    return ((halIo[0xB0].value & 3) == _BV(WGM21)) && !(halIo[0xB1].value & _BV(WGM22));
+}
+
+/*
+ * Zaehlerstand bis jetzt nachfuehren (ohne Ueberlauf, den erledigen die Ereignisse).
+ */
+static void syncTimer(HalTimer& t) {
+    uint32_t p = prescaler(t);
+    if (!p) {
+        return;
+    }
+    uint64_t ticks = (_now - t.t0) / p;
+    t.count0 += ticks;
+    t.t0 += ticks * p;
+}
+
+static uint32_t timerCount(HalTimer& t) {
+    if (!prescaler(t)) {
+        return t.frozen;
+    }
+    syncTimer(t);
+    return t.count0;
+}
+
+static void setTimerCount(HalTimer& t, uint32_t count) {
+    t.count0 = count;
+    t.frozen = count;
+    t.t0 = _now;
+    t.doneA = false;
+    t.doneB = false;
+}
+
+/*
+ * Naechstes Ereignis des Timers: 0 = Compare A, 1 = Compare B, 2 = Ueberlauf/Neustart.
+ */
+static uint64_t nextTimerEvent(HalTimer& t, uint8_t* which) {
+    uint32_t p = prescaler(t);
+    if (!p) {
+        return UINT64_MAX;
+    }
+    uint64_t best = UINT64_MAX;
+    uint32_t top = timerMax(t);
+    if (isCtc(t) && (t.count0 <= ocrA(t))) {
+        // Im CTC-Modus faellt der Compare-Match A mit dem Neustart zusammen.
+        top = ocrA(t);
+        best = t.t0 + (uint64_t)(top + 1 - t.count0) * p;
+        *which = 0;
+    } else {
+        best = t.t0 + (uint64_t)(top + 1 - t.count0) * p;
+        *which = 2;
+        if (!t.doneA && (ocrA(t) >= t.count0)) {
+            uint64_t a = t.t0 + (uint64_t)(ocrA(t) - t.count0) * p;
+            if (a < best) {
+                best = a;
+                *which = 0;
+            }
+        }
+    }
+    if (!t.doneB && (ocrB(t) >= t.count0) && (ocrB(t) <= top)) {
+        uint64_t b = t.t0 + (uint64_t)(ocrB(t) - t.count0) * p;
+        if (b < best) {
+            best = b;
+            *which = 1;
+        }
+    }
+    return best;
+}
+
+static void timerEvent(HalTimer& t, uint64_t when, uint8_t which) {
+    uint32_t p = prescaler(t);
+    if (which == 1) {
+        halIo[t.tifr].value |= _BV(OCF1B);
+        t.doneB = true;
+        return;
+    }
+    if ((which == 0) && !isCtc(t)) {
+        halIo[t.tifr].value |= _BV(OCF1A);
+        t.doneA = true;
+        return;
+    }
+    // Neustart bei 0
+    if (which == 0) {
+        halIo[t.tifr].value |= _BV(OCF1A);
+    } else {
+        halIo[t.tifr].value |= _BV(TOV1);
+    }
+    t.count0 = 0;
+    t.t0 = when;
+    t.doneA = false;
+    t.doneB = false;
+    (void)p;
+}
+
+/******************************************************************************
+ * SPI, USART (SPI-Modus), EEPROM
+ ******************************************************************************/
+
+static uint64_t _spiDoneAt;
+static boolean _spiActive;
+
+static uint64_t _usartDoneAt;
+static uint64_t _usartBufferFreeAt;
+static uint64_t _usartTxcClearedAt;
+
+static uint8_t _eeprom[HAL_EEPROM_SIZE];
+static uint32_t _eepromWear[HAL_EEPROM_SIZE];
+static uint64_t _eepromReadyAt;
+static long _eepromCellsLeft = -1;
+static boolean _eepromPowerLost;
+
+/******************************************************************************
+ * TWI
+ ******************************************************************************/
+
+#define TWI_IDLE 0
+#define TWI_ADDRESS 1
+#define TWI_WRITE 2
+#define TWI_READ 3
+
+static HalI2cDevice* _i2c[128];
+static uint8_t _twiState;
+static boolean _twiOwner;
+static HalI2cDevice* _twiDevice;
+static boolean _twint;
+static uint64_t _twiDoneAt = UINT64_MAX;
+static uint8_t _twiStatus;
+static uint8_t _twiData;
+static boolean _twiDataValid;
+static uint64_t _twiStopUntil;
+
+static HalDevice* _devices[8];
+static uint8_t _deviceCount;
+
+/******************************************************************************
+ * Interrupts
+ ******************************************************************************/
+
+static void (*_attached[2])();
+
+struct HalVector {
+    void (*isr)(void);
+    uint8_t number;
+    uint8_t flagRegister;
+    uint8_t flagBit;
+    uint8_t maskRegister;
+    uint8_t maskBit;
+};
+
+static void callInt0() {
+    if (_attached[0]) {
+        _attached[0]();
+    } else if (__vector_1) {
+        __vector_1();
+    }
+}
+
+static void callInt1() {
+    if (_attached[1]) {
+        _attached[1]();
+    } else if (__vector_2) {
+        __vector_2();
+    }
+}
+
+static void runIsr(void (*isr)(void), uint8_t number) {
+    uint64_t start = _now;
+    halIo[0x5F].value &= ~_BV(SREG_I);
+    _counters.interrupts++;
+    charge(HAL_ISR_CYCLES);
+    if (isr) {
+        isr();
+    }
+    _counters.isrCycles[number] += _now - start;
+    halIo[0x5F].value |= _BV(SREG_I);
+}
+
+static boolean dispatchOne() {
+    const HalVector vectors[] = {
+        { callInt0, 1, 0x3C, INTF0, 0x3D, INT0 },
+        { callInt1, 2, 0x3C, INTF1, 0x3D, INT1 },
+        { __vector_3, 3, 0x3B, PCIF0, 0x68, PCIE0 },
+        { __vector_4, 4, 0x3B, PCIF1, 0x68, PCIE1 },
+        { __vector_5, 5, 0x3B, PCIF2, 0x68, PCIE2 },
+        { __vector_7, 7, 0x37, OCF2A, 0x70, OCIE2A },
+        { __vector_8, 8, 0x37, OCF2B, 0x70, OCIE2B },
+        { __vector_9, 9, 0x37, TOV2, 0x70, TOIE2 },
+        { __vector_11, 11, 0x36, OCF1A, 0x6F, OCIE1A },
+        { __vector_12, 12, 0x36, OCF1B, 0x6F, OCIE1B },
+        { __vector_13, 13, 0x36, TOV1, 0x6F, TOIE1 },
+    };
+    for (uint8_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        const HalVector& v = vectors[i];
+        if ((halIo[v.flagRegister].value & _BV(v.flagBit)) && (halIo[v.maskRegister].value & _BV(v.maskBit))) {
+            // Das Flag loescht die Hardware beim Sprung in die ISR.
+            halIo[v.flagRegister].value &= ~_BV(v.flagBit);
+            runIsr(v.isr, v.number);
+            return true;
+        }
+    }
+    // TWI: Das Flag bleibt stehen, bis die ISR es loescht.
+    if (_twint && (halIo[0xBC].value & _BV(TWIE)) && (halIo[0xBC].value & _BV(TWEN))) {
+        runIsr(__vector_24, 24);
+        return true;
+    }
+    return false;
+}
+
+static void dispatch() {
+    // Auf dem Chip wird nach einem RETI erst ein Befehl des Hauptprogramms ausgefuehrt,
+    // hier laufen anstehende Interrupts direkt hintereinander.
+    uint16_t guard = 0;
+    while ((halIo[0x5F].value & _BV(SREG_I)) && dispatchOne()) {
+        if (++guard > 10000) {
+            fprintf(stderr, "HostHal: Interrupt-Sturm, ein Flag wird nicht geloescht\n");
+            abort();
+        }
+    }
+}
+
+void halSei() {
+    halIo[0x5F].value |= _BV(SREG_I);
+    dispatch();
+}
+
+void halCli() {
+    halIo[0x5F].value &= ~_BV(SREG_I);
+}
+
+/******************************************************************************
+ * Zeit
+ ******************************************************************************/
+
+static uint64_t nextEvent() {
+    uint8_t which;
+    uint64_t t = nextTimerEvent(_timer1, &which);
+    t = min(t, nextTimerEvent(_timer2, &which));
+    t = min(t, _twiDoneAt);
+    for (uint8_t i = 0; i < _deviceCount; i++) {
+        t = min(t, _devices[i]->nextEvent());
+    }
+    return t;
+}
+
+static void twiComplete();
+
+static void runEvents() {
+    boolean again = true;
+    while (again) {
+        again = false;
+        uint8_t which;
+        uint64_t t = nextTimerEvent(_timer1, &which);
+        if (t <= _now) {
+            timerEvent(_timer1, t, which);
+            again = true;
+        }
+        t = nextTimerEvent(_timer2, &which);
+        if (t <= _now) {
+            timerEvent(_timer2, t, which);
+            again = true;
+        }
+        if (_twiDoneAt <= _now) {
+            twiComplete();
+            again = true;
+        }
+        for (uint8_t i = 0; i < _deviceCount; i++) {
+            if (_devices[i]->nextEvent() <= _now) {
+                _devices[i]->event();
+                again = true;
+            }
+        }
+    }
+}
+
+void halAdvance(uint64_t cycles) {
+    uint64_t end = _now + cycles;
+    for (;;) {
+        uint64_t t = nextEvent();
+        if (t > end) {
+            break;
+        }
+        if (t > _now) {
+            _now = t;
+        }
+        runEvents();
+        dispatch();
+    }
+    if (end > _now) {
+        _now = end;
+    }
+    dispatch();
+}
+
+void halAdvanceMicros(uint64_t us) {
+    halAdvance(us * HAL_CYCLES_PER_US);
+}
+
+uint64_t halCycles() {
+    return _now;
+}
+
+uint64_t halMicros() {
+    return _now / HAL_CYCLES_PER_US;
+}
+
+void halBlock(uint64_t cycles) {
+    _counters.blockedCycles += cycles;
+    halAdvance(cycles);
+}
+
+/******************************************************************************
+ * TWI-Hardware
+ ******************************************************************************/
+
+static uint64_t twiBitCycles() {
+    static const uint8_t prescale[4] = { 1, 4, 16, 64 };
+    return 16 + 2UL * halIo[0xB8].value * prescale[halIo[0xB9].value & 3];
+}
+
+uint64_t halI2cBitCycles() {
+    return twiBitCycles();
+}
+
+HalI2cDevice* halI2cDevice(uint8_t address) {
+    return _i2c[address & 0x7F];
+}
+
+static void twiComplete() {
+    _twiDoneAt = UINT64_MAX;
+    if (_twiDataValid) {
+        halIo[0xBB].value = _twiData;
+        _twiDataValid = false;
+    }
+    halIo[0xB9].value = (halIo[0xB9].value & 3) | _twiStatus;
+    _twint = true;
+}
+
+static void twiControl(uint8_t v) {
+    halIo[0xBC].value = v & ~(_BV(TWINT) | _BV(TWSTO));
+    if (!(v & _BV(TWEN))) {
+        _twiState = TWI_IDLE;
+        _twiOwner = false;
+        _twint = false;
+        _twiDoneAt = UINT64_MAX;
+        return;
+    }
+    if (!(v & _BV(TWINT))) {
+        return;
+    }
+    _twint = false;
+    if (v & _BV(TWSTA)) {
+        _twiStatus = _twiOwner ? TW_REP_START : TW_START;
+        _twiOwner = true;
+        _twiState = TWI_ADDRESS;
+        _twiDoneAt = _now + twiBitCycles();
+    } else if (v & _BV(TWSTO)) {
+        if (_twiDevice) {
+            _twiDevice->i2cStop();
+        }
+        _twiDevice = 0;
+        _twiOwner = false;
+        _twiState = TWI_IDLE;
+        _twiStopUntil = _now + twiBitCycles();
+    } else if (_twiState == TWI_ADDRESS) {
+        uint8_t sla = halIo[0xBB].value;
+        boolean read = sla & TW_READ;
+        _twiDevice = _i2c[sla >> 1];
+        boolean ack = _twiDevice && _twiDevice->i2cStart(read);
+        if (!ack) {
+            _twiDevice = 0;
+        }
+        _twiStatus = read ? (ack ? TW_MR_SLA_ACK : TW_MR_SLA_NACK) : (ack ? TW_MT_SLA_ACK : TW_MT_SLA_NACK);
+        _twiState = read ? TWI_READ : TWI_WRITE;
+        _counters.i2cBytes++;
+        _twiDoneAt = _now + 9 * twiBitCycles();
+    } else if (_twiState == TWI_WRITE) {
+        boolean ack = _twiDevice && _twiDevice->i2cWrite(halIo[0xBB].value);
+        _twiStatus = ack ? TW_MT_DATA_ACK : TW_MT_DATA_NACK;
+        _counters.i2cBytes++;
+        _twiDoneAt = _now + 9 * twiBitCycles();
+    } else if (_twiState == TWI_READ) {
+        _twiData = _twiDevice ? _twiDevice->i2cRead() : 0xFF;
+        _twiDataValid = true;
+        _twiStatus = (v & _BV(TWEA)) ? TW_MR_DATA_ACK : TW_MR_DATA_NACK;
+        _counters.i2cBytes++;
+        _twiDoneAt = _now + 9 * twiBitCycles();
+    }
+}
+
+/******************************************************************************
+ * Register
+ ******************************************************************************/
+
+static uint8_t readRegister(uint8_t address) {
+    switch (address) {
+    case 0x4D: // SPSR
+        halBlock(HAL_POLL_CYCLES);
+        if (_spiActive && (_now >= _spiDoneAt)) {
+            halIo[address].value |= _BV(SPIF);
+        }
+        break;
+    case 0xC0: // UCSR0A
+        halBlock(HAL_POLL_CYCLES);
+        halIo[address].value &= ~(_BV(UDRE0) | _BV(TXC0));
+        if (_now >= _usartBufferFreeAt) {
+            halIo[address].value |= _BV(UDRE0);
+        }
+        if ((_now >= _usartDoneAt) && (_usartDoneAt > _usartTxcClearedAt)) {
+            halIo[address].value |= _BV(TXC0);
+        }
+        break;
+    case 0xBC: // TWCR
+        halBlock(HAL_POLL_CYCLES);
+        return (halIo[address].value & ~(_BV(TWINT) | _BV(TWSTO)))
+            | (_twint ? _BV(TWINT) : 0)
+            | ((_now < _twiStopUntil) ? _BV(TWSTO) : 0);
+    case 0x3F: // EECR
+        halBlock(HAL_POLL_CYCLES);
+        if (_now < _eepromReadyAt) {
+            halIo[address].value |= _BV(EEPE);
+        } else {
+            halIo[address].value &= ~_BV(EEPE);
+        }
+        break;
+    case 0xB2: // TCNT2
+        return timerCount(_timer2);
+    default:
+        break;
+    }
+    return halIo[address].value;
+}
+
+static void writeRegister(uint8_t address, uint8_t value) {
+    switch (address) {
+    case 0x23: // PINx: Schreiben toggelt PORTx
+    case 0x26:
+    case 0x29:
+        _counters.portWrites++;
+        halIo[address + 2].value ^= value;
+        updatePort(address);
+        return;
+    case 0x24: // DDRx
+    case 0x27:
+    case 0x2A:
+        halIo[address].value = value;
+        updatePort(address - 1);
+        return;
+    case 0x25: // PORTx
+    case 0x28:
+    case 0x2B:
+        _counters.portWrites++;
+        halIo[address].value = value;
+        updatePort(address - 2);
+        return;
+    case 0x36: // TIFRx, PCIFR, EIFR: eine 1 loescht das Flag
+    case 0x37:
+    case 0x3B:
+    case 0x3C:
+        halIo[address].value &= ~value;
+        return;
+    case 0x5F: // SREG
+        halIo[address].value = value;
+        dispatch();
+        return;
+    case 0x4E: // SPDR
+        halIo[address].value = value;
+        if (halIo[0x4C].value & _BV(SPE)) {
+            // fosc/4, mit SPI2X fosc/2
+            uint64_t byteCycles = (halIo[0x4D].value & _BV(SPI2X)) ? 16 : 32;
+            halIo[0x4D].value &= ~_BV(SPIF);
+            _spiDoneAt = max(_now, _spiDoneAt) + byteCycles;
+            _spiActive = true;
+            _counters.spiBytes++;
+            if (_shiftHook) {
+                _shiftHook(value, halIo[0x4C].value & _BV(DORD));
+            }
+        }
+        return;
+    case 0xC6: // UDR0
+        halIo[address].value = value;
+        if (halIo[0xC1].value & _BV(TXEN0)) {
+            uint64_t byteCycles = 16UL * (halIo16[0xC4].value + 1);
+            if (_now >= _usartDoneAt) {
+                _usartDoneAt = _now + byteCycles;
+                _usartBufferFreeAt = _now;
+            } else {
+                _usartBufferFreeAt = _usartDoneAt;
+                _usartDoneAt += byteCycles;
+            }
+            _counters.usartBytes++;
+            if (_shiftHook) {
+                _shiftHook(value, halIo[0xC2].value & _BV(UDORD0));
+            }
+        }
+        return;
+    case 0xC0: // UCSR0A: TXC0 wird mit einer 1 geloescht
+        if (value & _BV(TXC0)) {
+            _usartTxcClearedAt = _now;
+        }
+        halIo[address].value = value & ~_BV(TXC0);
+        return;
+    case 0xBC: // TWCR
+        twiControl(value);
+        dispatch();
+        return;
+    case 0x81: // TCCR1B
+    case 0xB1: // TCCR2B
+        {
+            HalTimer& t = (address == 0x81) ? _timer1 : _timer2;
+            uint32_t count = timerCount(t);
+            halIo[address].value = value;
+            t.count0 = count;
+            t.frozen = count;
+            t.t0 = _now;
+        }
+        return;
+    case 0xB2: // TCNT2
+        halIo[address].value = value;
+        setTimerCount(_timer2, value);
+        return;
+    case 0x68: // PCICR
+    case 0x6F: // TIMSKx
+    case 0x70:
+    case 0x3D: // EIMSK
+        halIo[address].value = value;
+        dispatch();
+        return;
+    default:
+        halIo[address].value = value;
+        return;
+    }
+}
+
+static uint16_t readRegister16(uint8_t address) {
+    if (address == 0x84) {
+        return timerCount(_timer1);
+    }
+    return halIo16[address].value;
+}
+
+static void writeRegister16(uint8_t address, uint16_t value) {
+    if (address == 0x84) {
+        halIo16[address].value = value;
+        setTimerCount(_timer1, value);
+        return;
+    }
+    if ((address == 0x88) || (address == 0x8A)) {
+        // Ein neuer Vergleichswert gilt sofort, auch in der laufenden Runde.
+        syncTimer(_timer1);
+        halIo16[address].value = value;
+        if (address == 0x88) {
+            _timer1.doneA = false;
+        } else {
+            _timer1.doneB = false;
+        }
+        return;
+    }
+    halIo16[address].value = value;
+}
+
+uint8_t halReadRegister(uint8_t address) {
+    halAccessBegin();
+    uint8_t value = readRegister(address);
+    halAccessEnd();
+    return value;
+}
+
+void halWriteRegister(uint8_t address, uint8_t value) {
+    halAccessBegin();
+    writeRegister(address, value);
+    halAccessEnd();
+}
+
+uint16_t halReadRegister16(uint8_t address) {
+    halAccessBegin();
+    uint16_t value = readRegister16(address);
+    halAccessEnd();
+    return value;
+}
+
+void halWriteRegister16(uint8_t address, uint16_t value) {
+    halAccessBegin();
+    writeRegister16(address, value);
+    halAccessEnd();
+}
+
+/******************************************************************************
+ * EEPROM
+ ******************************************************************************/
+
+uint8_t eeprom_read_byte(const uint8_t* address) {
+    if (_now < _eepromReadyAt) {
+        halBlock(_eepromReadyAt - _now);
+    }
+    charge(HAL_EEPROM_ACCESSES * HAL_ACCESS_CYCLES);
+    return _eeprom[(uintptr_t)address % HAL_EEPROM_SIZE];
+}
+
+void eeprom_write_byte(uint8_t* address, uint8_t value) {
+    if (_now < _eepromReadyAt) {
+        halBlock(_eepromReadyAt - _now);
+    }
+    charge(HAL_EEPROM_ACCESSES * HAL_ACCESS_CYCLES);
+    if (_eepromCellsLeft == 0) {
+        _eepromPowerLost = true;
+        return;
+    }
+    if (_eepromCellsLeft > 0) {
+        _eepromCellsLeft--;
+    }
+    uintptr_t a = (uintptr_t)address % HAL_EEPROM_SIZE;
+    _eeprom[a] = value;
+    _eepromWear[a]++;
+    _counters.eepromWrites++;
+    _eepromReadyAt = _now + HAL_EEPROM_WRITE_CYCLES;
+}
+
+void eeprom_update_byte(uint8_t* address, uint8_t value) {
+    if (eeprom_read_byte(address) != value) {
+        eeprom_write_byte(address, value);
+    }
+}
+
+uint8_t* halEeprom() {
+    return _eeprom;
+}
+
+void halEepromErase() {
+    memset(_eeprom, 0xFF, sizeof(_eeprom));
+    memset(_eepromWear, 0, sizeof(_eepromWear));
+    _eepromCellsLeft = -1;
+    _eepromPowerLost = false;
+}
+
+uint32_t halEepromWear(int address) {
+    return _eepromWear[address % HAL_EEPROM_SIZE];
+}
+
+void halEepromPowerCut(long cellsLeft) {
+    _eepromCellsLeft = cellsLeft;
+    _eepromPowerLost = false;
+}
+
+boolean halEepromPowerLost() {
+    return _eepromPowerLost;
+}
+
+/******************************************************************************
+ * Pins (Arduino)
+ ******************************************************************************/
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= NUM_DIGITAL_PINS) {
+        return;
+    }
+    uint8_t base = pinBase(pin);
+    uint8_t mask = _BV(pinBit(pin));
+    if (mode == OUTPUT) {
+        halIo[base + 1].value |= mask;
+    } else {
+        halIo[base + 1].value &= ~mask;
+        if (mode == INPUT_PULLUP) {
+            halIo[base + 2].value |= mask;
+        } else {
+            halIo[base + 2].value &= ~mask;
+        }
+    }
+    updatePort(base);
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin >= NUM_DIGITAL_PINS) {
+        return;
+    }
+    uint8_t base = pinBase(pin);
+    uint8_t mask = _BV(pinBit(pin));
+    if (value) {
+        halIo[base + 2].value |= mask;
+    } else {
+        halIo[base + 2].value &= ~mask;
+    }
+    _counters.portWrites++;
+    updatePort(base);
+    charge(HAL_DIGITAL_CYCLES);
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin >= NUM_DIGITAL_PINS) {
+        return LOW;
+    }
+    charge(HAL_DIGITAL_CYCLES);
+    return (halIo[pinBase(pin)].value >> pinBit(pin)) & 1;
+}
+
+int analogRead(uint8_t pin) {
+    // 13 ADC-Takte bei 125kHz
+    halBlock(104 * HAL_CYCLES_PER_US);
+    if (pin < 14) {
+        pin += 14;
+    }
+    return (pin < NUM_DIGITAL_PINS) ? _analog[pin] : 0;
+}
+
+void analogWrite(uint8_t pin, int value) {
+    pinMode(pin, OUTPUT);
+    digitalWrite(pin, value >= 128 ? HIGH : LOW);
+}
+
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(), int mode) {
+    if (interruptNum > 1) {
+        return;
+    }
+    _attached[interruptNum] = userFunc;
+    uint8_t sense = (mode == CHANGE) ? 1 : ((mode == FALLING) ? 2 : ((mode == RISING) ? 3 : 0));
+    halIo[0x69].value = (halIo[0x69].value & ~(3 << (2 * interruptNum))) | (sense << (2 * interruptNum));
+    halIo[0x3C].value &= ~_BV(interruptNum);
+    halIo[0x3D].value |= _BV(interruptNum);
+}
+
+void detachInterrupt(uint8_t interruptNum) {
+    if (interruptNum > 1) {
+        return;
+    }
+    halIo[0x3D].value &= ~_BV(interruptNum);
+    _attached[interruptNum] = 0;
+}
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long) {
+    if (pin < NUM_DIGITAL_PINS) {
+        _tone[pin] = frequency;
+    }
+}
+
+void noTone(uint8_t pin) {
+    if (pin < NUM_DIGITAL_PINS) {
+        _tone[pin] = 0;
+    }
+}
+
+void halSetPin(uint8_t pin, uint8_t level) {
+    _driven[pin] = true;
+    _extLevel[pin] = level ? HIGH : LOW;
+    updatePort(pinBase(pin));
+    dispatch();
+}
+
+void halReleasePin(uint8_t pin) {
+    _driven[pin] = false;
+    updatePort(pinBase(pin));
+    dispatch();
+}
+
+uint8_t halGetPin(uint8_t pin) {
+    return (halIo[pinBase(pin)].value >> pinBit(pin)) & 1;
+}
+
+boolean halIsOutput(uint8_t pin) {
+    return (halIo[pinBase(pin) + 1].value >> pinBit(pin)) & 1;
+}
+
+void halSetAnalog(uint8_t pin, int value) {
+    if (pin < 14) {
+        pin += 14;
+    }
+    _analog[pin] = value;
+}
+
+unsigned int halGetTone(uint8_t pin) {
+    return _tone[pin];
+}
+
+void halOnPinChange(void (*hook)(uint8_t pin, uint8_t level)) {
+    _pinHook = hook;
+}
+
+void halOnShiftByte(void (*hook)(uint8_t data, boolean lsbFirst)) {
+    _shiftHook = hook;
+}
+
+/******************************************************************************
+ * Zeit (Arduino)
+ ******************************************************************************/
+
+// Ein Aufruf von millis() oder micros() (Interrupts sperren, Zaehler lesen).
+#define HAL_TIME_READ_CYCLES 40
+
+unsigned long millis() {
+    halAdvance(HAL_TIME_READ_CYCLES);
+    return (unsigned long)(_now / (1000UL * HAL_CYCLES_PER_US));
+}
+
+unsigned long micros() {
+    halAdvance(HAL_TIME_READ_CYCLES);
+    return (unsigned long)(_now / HAL_CYCLES_PER_US);
+}
+
+void delay(unsigned long ms) {
+    halAdvance((uint64_t)ms * 1000UL * HAL_CYCLES_PER_US);
+}
+
+void delayMicroseconds(unsigned int us) {
+    halAdvance((uint64_t)us * HAL_CYCLES_PER_US);
+}
+
+/******************************************************************************
+ * Geraete
+ ******************************************************************************/
+
+void halAttachI2c(uint8_t address, HalI2cDevice* device) {
+    _i2c[address & 0x7F] = device;
+}
+
+void halAttachDevice(HalDevice* device) {
+    if (_deviceCount < sizeof(_devices) / sizeof(_devices[0])) {
+        _devices[_deviceCount++] = device;
+    }
+}
+
+/*
+ * Einschalten: vor den Konstruktoren der Firmware, die schon Pins setzen.
+ */
+struct HalPowerOn {
+    HalPowerOn() {
+        halReset();
+    }
+};
+static HalPowerOn _powerOn __attribute__((init_priority(101)));
+
+/*
+ * init() aus dem Arduino-Kern (wiring.c) fuer den ATmega328P. Auf dem Arduino
+ * laeuft es nach den Konstruktoren und vor setup() und ueberschreibt, was ein
+ * Konstruktor an Timer1/2, ADC und USART eingestellt hat.
+ */
+void halInit() {
+    halWriteRegister(0x80, _BV(WGM10));            // TCCR1A: 8-Bit-PWM
+    halWriteRegister(0x81, _BV(CS11) | _BV(CS10)); // TCCR1B: Prescaler 64
+    halWriteRegister(0xB0, _BV(WGM20));            // TCCR2A: 8-Bit-PWM
+    halWriteRegister(0xB1, _BV(CS22));             // TCCR2B: Prescaler 64
+    halWriteRegister(0x7A, _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0) | _BV(ADEN)); // ADCSRA
+    halWriteRegister(0xC1, 0);                     // UCSR0B: Pins 0 und 1 von der USART trennen
+}
+
+HalCounters& halCounters() {
+    return _counters;
+}
+
+void halCostModel(boolean on) {
+    _costModel = on;
+}
+
+void halReset() {
+    for (int i = 0; i < 256; i++) {
+        halIo[i].value = 0;
+        halIo[i].address = i;
+        halIo16[i].value = 0;
+        halIo16[i].address = i;
+    }
+    // Nach dem Reset sind die Interrupts erst mit sei() in init() an, das
+    // Arduino-Hauptprogramm ruft setup() schon mit gesetztem I-Bit.
+    halIo[0x5F].value = _BV(SREG_I);
+    _now = 0;
+    memset(&_counters, 0, sizeof(_counters));
+    _costModel = false;
+    _accessDepth = 0;
+    memset(_extLevel, 0, sizeof(_extLevel));
+    memset(_driven, 0, sizeof(_driven));
+    memset(_analog, 0, sizeof(_analog));
+    memset(_tone, 0, sizeof(_tone));
+    _pinHook = 0;
+    _shiftHook = 0;
+    _attached[0] = 0;
+    _attached[1] = 0;
+    setTimerCount(_timer1, 0);
+    setTimerCount(_timer2, 0);
+    _spiDoneAt = 0;
+    _spiActive = false;
+    _usartDoneAt = 0;
+    _usartBufferFreeAt = 0;
+    _usartTxcClearedAt = 0;
+    _eepromReadyAt = 0;
+    static boolean eepromNew = true;
+    if (eepromNew) {
+        // Ein neuer Chip kommt geloescht.
+        halEepromErase();
+        eepromNew = false;
+    }
+    memset(_i2c, 0, sizeof(_i2c));
+    _twiState = TWI_IDLE;
+    _twiOwner = false;
+    _twiDevice = 0;
+    _twint = false;
+    _twiDoneAt = UINT64_MAX;
+    _twiDataValid = false;
+    _twiStopUntil = 0;
+    _deviceCount = 0;
+    halSerialReset();
+    halRandomReset();
+}
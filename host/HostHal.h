@@ -0,0 +1,139 @@
+/**
+ * HostHal
+ * Die Hardware des ATmega328P auf dem Host, fuer Regressions- und Laufzeittests
+ * des echten Codes ohne Hardware (siehe tests/).
+ *
+ * Die Zeit ist virtuell und zaehlt CPU-Takte bei 16MHz. Sie laeuft nur, wenn
+ * die Firmware wartet (delay(), delayMicroseconds(), analogRead(), Wire, Warten
+ * auf SPI/USART/TWI/EEPROM) oder ein Test halAdvance() aufruft. Ein Test
+ * modelliert Rechenzeit also selbst. Waehrend die Zeit laeuft, zaehlen Timer1
+ * und Timer2 (Normal- und CTC-Modus) und die Geraete (RTC, Signalgeber) und
+ * loesen ihre Interrupts aus, sofern das I-Bit in SREG gesetzt ist. Die ISR
+ * selbst kostet keine Zeit.
+ *
+ * Von aussen werden Pins mit halSetPin() getrieben (loest INT0/INT1 und
+ * Pin-Change-Interrupts aus), analoge Werte mit halSetAnalog() gesetzt, und
+ * I2C-Geraete mit halAttachI2c() an den Bus gehaengt.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOSTHAL_H
+#define HOSTHAL_H
+
+#include "Arduino.h"
+
+#define HAL_CYCLES_PER_US (F_CPU / 1000000UL)
+#define HAL_EEPROM_SIZE 1024
+
+/**
+ * Ein Geraet mit eigenem Takt (RTC, DCF77-Sender, ...). event() wird
+ * aufgerufen, sobald die virtuelle Zeit nextEvent() erreicht.
+ */
+class HalDevice {
+public:
+    virtual ~HalDevice() {}
+    virtual uint64_t nextEvent() = 0;
+    virtual void event() = 0;
+};
+
+/**
+ * Ein Geraet am I2C-Bus.
+ */
+class HalI2cDevice {
+public:
+    virtual ~HalI2cDevice() {}
+    // Start plus Adresse. false, wenn das Geraet nicht antwortet (NACK).
+    virtual bool i2cStart(bool read) = 0;
+    // Ein Byte vom Master. false fuer NACK.
+    virtual bool i2cWrite(uint8_t data) = 0;
+    // Ein Byte zum Master.
+    virtual uint8_t i2cRead() = 0;
+    virtual void i2cStop() {}
+};
+
+/**
+ * Zaehler fuer Laufzeitmessungen.
+ */
+struct HalCounters {
+    uint32_t portWrites;      // Schreibzugriffe auf PORTx/PINx
+    uint32_t spiBytes;        // ueber SPDR
+    uint32_t usartBytes;      // ueber UDR0
+    uint32_t i2cBytes;        // Adress- und Datenbytes auf dem Bus
+    uint32_t eepromWrites;    // geschriebene EEPROM-Zellen
+    uint32_t interrupts;      // ausgefuehrte ISRs
+    uint64_t blockedCycles;   // Takte in Wire, analogRead(), EEPROM- und Peripherie-Warteschleifen
+    uint64_t isrCycles[26];   // Takte in den ISRs pro Vektornummer (nur mit halCostModel())
+};
+
+/*
+ * Alles auf Anfang: Zeit 0, Register, Pins, Serial, Geraete abgehaengt.
+ * Das EEPROM bleibt (wie beim Neustart), halEepromErase() loescht es.
+ * Laeuft beim Start des Programms vor den Konstruktoren der Firmware. Ein
+ * spaeterer Aufruf loescht auch, was die Konstruktoren eingestellt haben.
+ */
+void halReset();
+
+/*
+ * Was init() im Arduino-Kern einstellt (Timer1/2, ADC, USART aus). Laeuft
+ * wie auf dem Arduino nach den Konstruktoren und vor setup().
+ */
+void halInit();
+
+// Zeit
+uint64_t halCycles();
+uint64_t halMicros();
+void halAdvance(uint64_t cycles);
+void halAdvanceMicros(uint64_t us);
+
+// Pins
+void halSetPin(uint8_t pin, uint8_t level);
+void halReleasePin(uint8_t pin);
+uint8_t halGetPin(uint8_t pin);
+boolean halIsOutput(uint8_t pin);
+void halSetAnalog(uint8_t pin, int value);
+unsigned int halGetTone(uint8_t pin);
+// Wird bei jeder Pegelaenderung eines Pins gerufen (Ausgang oder Eingang).
+void halOnPinChange(void (*hook)(uint8_t pin, uint8_t level));
+// Wird fuer jedes Byte gerufen, das SPI oder USART (SPI-Modus) ausgibt.
+void halOnShiftByte(void (*hook)(uint8_t data, boolean lsbFirst));
+
+// Serial
+void halSerialInput(const char* text);
+const char* halSerialOutput();
+void halSerialClear();
+void halSerialEcho(boolean echo);
+
+// EEPROM
+uint8_t* halEeprom();
+void halEepromErase();
+// Schreibzugriffe pro Zelle seit halEepromErase().
+uint32_t halEepromWear(int address);
+// Nach so vielen Zellen bricht die Versorgung weg, weitere Schreibzugriffe gehen verloren (-1 = nie).
+void halEepromPowerCut(long cellsLeft);
+boolean halEepromPowerLost();
+
+// Geraete
+void halAttachI2c(uint8_t address, HalI2cDevice* device);
+void halAttachDevice(HalDevice* device);
+
+HalCounters& halCounters();
+
+/*
+ * Kostenmodell fuer Laufzeitmessungen: jeder Zugriff auf ein I/O-Register
+ * kostet HAL_ACCESS_CYCLES (auch die in eeprom_read_byte() und
+ * eeprom_write_byte()), digitalWrite()/digitalRead() HAL_DIGITAL_CYCLES,
+ * Sprung in eine ISR und zurueck HAL_ISR_CYCLES. Der C-Code dazwischen kostet
+ * weiterhin nichts, die Zahlen sind also eine untere Grenze fuer den AVR.
+ */
+#define HAL_ACCESS_CYCLES 2
+#define HAL_DIGITAL_CYCLES 50
+#define HAL_ISR_CYCLES 40
+void halCostModel(boolean on);
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ * HostHalIntern
+ * Was sich die Teile des Host-HAL untereinander teilen.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOSTHALINTERN_H
+#define HOSTHALINTERN_H
+
+#include "HostHal.h"
+
+// Die CPU wartet (Wire, analogRead(), Warteschleifen auf die Peripherie).
+void halBlock(uint64_t cycles);
+
+HalI2cDevice* halI2cDevice(uint8_t address);
+uint64_t halI2cBitCycles();
+
+void halSerialReset();
+void halRandomReset();
+
+#endif
@@ -0,0 +1,115 @@
+/**
+ * HostMatrix
+ * Die LED-Matrix hinter LedDriverDefault/LedDriverBAM (siehe HostMatrix.h).
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostMatrix.h"
+
+static HostMatrix* _attached;
+
+static void onPinChange(uint8_t pin, uint8_t level) {
+    _attached->pinChanged(pin, level);
+}
+
+static void onShiftByte(uint8_t data, boolean lsbFirst) {
+    _attached->shiftByte(data, lsbFirst);
+}
+
+HostMatrix::HostMatrix(uint8_t dataPin, uint8_t clockPin, uint8_t latchPin, uint8_t outputEnablePin) {
+    _dataPin = dataPin;
+    _clockPin = clockPin;
+    _latchPin = latchPin;
+    _outputEnablePin = outputEnablePin;
+    _shift = 0;
+    _latched = 0;
+    _outputOn = false;
+    reset();
+}
+
+void HostMatrix::attach() {
+    _attached = this;
+    halOnPinChange(onPinChange);
+    halOnShiftByte(onShiftByte);
+    _outputOn = !halGetPin(_outputEnablePin);
+    _since = halCycles();
+}
+
+/*
+ * Die Bits gehen mit dem niederwertigsten zuerst raus, erst das Spalten-,
+ * dann das Zeilen-Wort. Nach 32 Bits steht das zuerst geschobene Bit ganz
+ * unten.
+ */
+void HostMatrix::pinChanged(uint8_t pin, uint8_t level) {
+    if ((pin == _clockPin) && level) {
+        _shift = (_shift >> 1) | ((uint32_t)halGetPin(_dataPin) << 31);
+    } else if ((pin == _latchPin) && level) {
+        account();
+        _latched = _shift;
+        _latches++;
+    } else if (pin == _outputEnablePin) {
+        account();
+        _outputOn = !level;
+    }
+}
+
+void HostMatrix::shiftByte(uint8_t data, boolean lsbFirst) {
+    for (uint8_t b = 0; b < 8; b++) {
+        uint8_t bit = lsbFirst ? ((data >> b) & 1) : ((data >> (7 - b)) & 1);
+        _shift = (_shift >> 1) | ((uint32_t)bit << 31);
+    }
+}
+
+void HostMatrix::reset() {
+    memset(_on, 0, sizeof(_on));
+    _latches = 0;
+    _since = halCycles();
+}
+
+uint64_t HostMatrix::onCycles(uint8_t row, uint8_t bit) {
+    account();
+    return _on[row][bit];
+}
+
+void HostMatrix::toMatrix(word matrix[16], uint64_t threshold) {
+    account();
+    for (uint8_t row = 0; row < 16; row++) {
+        matrix[row] = 0;
+        for (uint8_t bit = 0; bit < 16; bit++) {
+            if (_on[row][bit] > threshold) {
+                matrix[row] |= 1 << bit;
+            }
+        }
+    }
+}
+
+uint32_t HostMatrix::getLatches() {
+    return _latches;
+}
+
+/*
+ * Die Zeit seit dem letzten Aufruf den LEDs gutschreiben, die gerade leuchten.
+ */
+void HostMatrix::account() {
+    uint64_t now = halCycles();
+    if (_outputOn) {
+        word columns = ~(word)(_latched & 0xFFFF);
+        word rows = (word)(_latched >> 16);
+        for (uint8_t row = 0; row < 16; row++) {
+            if (rows & (1 << row)) {
+                for (uint8_t bit = 0; bit < 16; bit++) {
+                    if (columns & (1 << bit)) {
+                        _on[row][bit] += now - _since;
+                    }
+                }
+            }
+        }
+    }
+    _since = now;
+}
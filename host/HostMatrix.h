@@ -0,0 +1,58 @@
+/**
+ * HostMatrix
+ * Die LED-Matrix hinter LedDriverDefault/LedDriverBAM: zwei 74HC595 fuer die
+ * Spalten (LOW = an), zwei fuer die Zeilen (HIGH = an, UDN2981A) und
+ * OutputEnable (LOW = an). Die Bits kommen ueber Data/Clock oder als Bytes
+ * von SPI/USART (halOnShiftByte()), Latch uebernimmt sie.
+ *
+ * Gemessen wird pro LED die Zeit, die sie leuchtet. Zeile und Bit entsprechen
+ * dem word-Bildspeicher der Firmware (Bit 15 = linke Spalte).
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOSTMATRIX_H
+#define HOSTMATRIX_H
+
+#include "HostHal.h"
+
+class HostMatrix {
+public:
+    HostMatrix(uint8_t dataPin, uint8_t clockPin, uint8_t latchPin, uint8_t outputEnablePin);
+
+    // Als einziger Beobachter an die Pins und SPI/USART haengen. Wer selbst
+    // einen Pin-Hook braucht, ruft pinChanged() daraus auf.
+    void attach();
+    void pinChanged(uint8_t pin, uint8_t level);
+    void shiftByte(uint8_t data, boolean lsbFirst);
+
+    // Messung neu beginnen.
+    void reset();
+    // Leuchtzeit in Takten seit reset().
+    uint64_t onCycles(uint8_t row, uint8_t bit);
+    // Alle Zeilen mit mehr als threshold Takten Leuchtzeit als Bildspeicher.
+    void toMatrix(word matrix[16], uint64_t threshold);
+    // Zahl der Latch-Vorgaenge seit reset().
+    uint32_t getLatches();
+
+private:
+    uint8_t _dataPin;
+    uint8_t _clockPin;
+    uint8_t _latchPin;
+    uint8_t _outputEnablePin;
+    uint32_t _shift;
+    uint32_t _latched;
+    boolean _outputOn;
+    uint64_t _since;
+    uint64_t _on[16][16];
+    uint32_t _latches;
+
+    void account();
+};
+
+#endif
@@ -0,0 +1,46 @@
+/**
+ * Wire (Host)
+ * Die Wire-Library, blockierend wie das Original. Die Zeit laeuft fuer jedes Bit auf dem Bus.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+#define BUFFER_LENGTH 32
+
+class TwoWire {
+public:
+    void begin();
+    void setClock(uint32_t clock);
+    void beginTransmission(uint8_t address);
+    void beginTransmission(int address);
+    uint8_t endTransmission(uint8_t sendStop = true);
+    size_t write(uint8_t data);
+    size_t write(const uint8_t* data, size_t quantity);
+    uint8_t requestFrom(uint8_t address, uint8_t quantity);
+    uint8_t requestFrom(int address, int quantity);
+    int available();
+    int read();
+
+private:
+    uint8_t _address;
+    uint8_t _txBuffer[BUFFER_LENGTH];
+    uint8_t _txLength;
+    uint8_t _rxBuffer[BUFFER_LENGTH];
+    uint8_t _rxIndex;
+    uint8_t _rxLength;
+    boolean _busOwned;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * avr/eeprom.h (Host)
+ * Das EEPROM aus HostHal.cpp, EEPE in EECR zeigt einen laufenden Schreibvorgang.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_AVR_EEPROM_H
+#define HOST_AVR_EEPROM_H
+
+#include <stdint.h>
+#include <avr/io.h>
+
+#define E2END 0x3FF
+
+#define eeprom_is_ready() (!(EECR & _BV(EEPE)))
+#define eeprom_busy_wait() do {} while (!eeprom_is_ready())
+
+uint8_t eeprom_read_byte(const uint8_t* address);
+void eeprom_write_byte(uint8_t* address, uint8_t value);
+void eeprom_update_byte(uint8_t* address, uint8_t value);
+
+#endif
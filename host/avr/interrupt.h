@@ -0,0 +1,26 @@
+/**
+ * avr/interrupt.h (Host)
+ * sei(), cli() und ISR() fuer die Interrupts aus HostHal.cpp.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#include <avr/io.h>
+
+void halSei();
+void halCli();
+
+#define sei() halSei()
+#define cli() halCli()
+
+#define ISR(vector, ...) extern "C" void vector(void); extern "C" void vector(void)
+
+#endif
@@ -0,0 +1,291 @@
+/**
+ * avr/io.h (Host)
+ * Die Register des ATmega328P als Objekte. Lesen und Schreiben geht ueber die
+ * Hooks in HostHal.cpp, damit Timer, SPI, USART, TWI, EEPROM und die Pins so
+ * reagieren wie auf dem Chip. Die Adressen sind die Speicheradressen aus dem
+ * Datenblatt, _SFR_MEM8() funktioniert also auch mit berechneten Adressen (DPIN).
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#define __AVR_ATmega328P__
+
+uint8_t halReadRegister(uint8_t address);
+void halWriteRegister(uint8_t address, uint8_t value);
+uint16_t halReadRegister16(uint8_t address);
+void halWriteRegister16(uint8_t address, uint16_t value);
+// Klammer um Lesen-Aendern-Schreiben, damit das Kostenmodell es als einen Befehl zaehlt.
+void halAccessBegin();
+void halAccessEnd();
+
+/**
+ * Ein 8-Bit-Register. value ist der gespeicherte Inhalt, gelesen und
+ * geschrieben wird ueber die Hooks.
+ */
+class HalRegister8 {
+public:
+    volatile uint8_t value;
+    uint8_t address;
+
+    HalRegister8() = default;
+    HalRegister8(const HalRegister8&) = default;
+
+    operator uint8_t() {
+        return halReadRegister(address);
+    }
+    HalRegister8& operator=(uint8_t v) {
+        halWriteRegister(address, v);
+        return *this;
+    }
+    HalRegister8& operator=(HalRegister8& other) {
+        halWriteRegister(address, (uint8_t)other);
+        return *this;
+    }
+    HalRegister8& operator|=(uint8_t v) {
+        halAccessBegin();
+        halWriteRegister(address, (uint8_t)(halReadRegister(address) | v));
+        halAccessEnd();
+        return *this;
+    }
+    HalRegister8& operator&=(uint8_t v) {
+        halAccessBegin();
+        halWriteRegister(address, (uint8_t)(halReadRegister(address) & v));
+        halAccessEnd();
+        return *this;
+    }
+    HalRegister8& operator^=(uint8_t v) {
+        halAccessBegin();
+        halWriteRegister(address, (uint8_t)(halReadRegister(address) ^ v));
+        halAccessEnd();
+        return *this;
+    }
+};
+
+/**
+ * Ein 16-Bit-Register (Timer1, UBRR0).
+ */
+class HalRegister16 {
+public:
+    uint16_t value;
+    uint8_t address;
+
+    operator uint16_t() {
+        return halReadRegister16(address);
+    }
+    HalRegister16& operator=(uint16_t v) {
+        halWriteRegister16(address, v);
+        return *this;
+    }
+    HalRegister16& operator|=(uint16_t v) {
+        halAccessBegin();
+        halWriteRegister16(address, (uint16_t)(halReadRegister16(address) | v));
+        halAccessEnd();
+        return *this;
+    }
+    HalRegister16& operator&=(uint16_t v) {
+        halAccessBegin();
+        halWriteRegister16(address, (uint16_t)(halReadRegister16(address) & v));
+        halAccessEnd();
+        return *this;
+    }
+};
+
+extern HalRegister8 halIo[256];
+extern HalRegister16 halIo16[256];
+
+#define _SFR_MEM8(address) (halIo[(uint8_t)(address)])
+#define _SFR_MEM16(address) (halIo16[(uint8_t)(address)])
+#define _BV(bit) (1 << (bit))
+
+#define PINB   _SFR_MEM8(0x23)
+#define DDRB   _SFR_MEM8(0x24)
+#define PORTB  _SFR_MEM8(0x25)
+#define PINC   _SFR_MEM8(0x26)
+#define DDRC   _SFR_MEM8(0x27)
+#define PORTC  _SFR_MEM8(0x28)
+#define PIND   _SFR_MEM8(0x29)
+#define DDRD   _SFR_MEM8(0x2A)
+#define PORTD  _SFR_MEM8(0x2B)
+#define TIFR0  _SFR_MEM8(0x35)
+#define TIFR1  _SFR_MEM8(0x36)
+#define TIFR2  _SFR_MEM8(0x37)
+#define PCIFR  _SFR_MEM8(0x3B)
+#define EIFR   _SFR_MEM8(0x3C)
+#define EIMSK  _SFR_MEM8(0x3D)
+#define EECR   _SFR_MEM8(0x3F)
+#define EEDR   _SFR_MEM8(0x40)
+#define GTCCR  _SFR_MEM8(0x43)
+#define SPCR   _SFR_MEM8(0x4C)
+#define SPSR   _SFR_MEM8(0x4D)
+#define SPDR   _SFR_MEM8(0x4E)
+#define ACSR   _SFR_MEM8(0x50)
+#define MCUSR  _SFR_MEM8(0x54)
+#define SREG   _SFR_MEM8(0x5F)
+#define WDTCSR _SFR_MEM8(0x60)
+#define PCICR  _SFR_MEM8(0x68)
+#define EICRA  _SFR_MEM8(0x69)
+#define PCMSK0 _SFR_MEM8(0x6B)
+#define PCMSK1 _SFR_MEM8(0x6C)
+#define PCMSK2 _SFR_MEM8(0x6D)
+#define TIMSK0 _SFR_MEM8(0x6E)
+#define TIMSK1 _SFR_MEM8(0x6F)
+#define TIMSK2 _SFR_MEM8(0x70)
+#define ADCSRA _SFR_MEM8(0x7A)
+#define ADMUX  _SFR_MEM8(0x7C)
+#define TCCR1A _SFR_MEM8(0x80)
+#define TCCR1B _SFR_MEM8(0x81)
+#define TCCR1C _SFR_MEM8(0x82)
+#define TCNT1  _SFR_MEM16(0x84)
+#define ICR1   _SFR_MEM16(0x86)
+#define OCR1A  _SFR_MEM16(0x88)
+#define OCR1B  _SFR_MEM16(0x8A)
+#define TCCR2A _SFR_MEM8(0xB0)
+#define TCCR2B _SFR_MEM8(0xB1)
+#define TCNT2  _SFR_MEM8(0xB2)
+#define OCR2A  _SFR_MEM8(0xB3)
+#define OCR2B  _SFR_MEM8(0xB4)
+#define TWBR   _SFR_MEM8(0xB8)
+#define TWSR   _SFR_MEM8(0xB9)
+#define TWAR   _SFR_MEM8(0xBA)
+#define TWDR   _SFR_MEM8(0xBB)
+#define TWCR   _SFR_MEM8(0xBC)
+#define UCSR0A _SFR_MEM8(0xC0)
+#define UCSR0B _SFR_MEM8(0xC1)
+#define UCSR0C _SFR_MEM8(0xC2)
+#define UBRR0  _SFR_MEM16(0xC4)
+#define UDR0   _SFR_MEM8(0xC6)
+
+// Bits
+#define SREG_I 7
+
+#define DDB2 2
+
+#define OCF1B 2
+#define OCF1A 1
+#define TOV1 0
+#define OCF2B 2
+#define OCF2A 1
+#define TOV2 0
+
+#define INT1 1
+#define INT0 0
+#define INTF1 1
+#define INTF0 0
+#define ISC11 3
+#define ISC10 2
+#define ISC01 1
+#define ISC00 0
+
+#define PCIE2 2
+#define PCIE1 1
+#define PCIE0 0
+#define PCIF2 2
+#define PCIF1 1
+#define PCIF0 0
+
+#define EEPE 1
+#define EEMPE 2
+#define EERE 0
+
+#define SPIE 7
+#define SPE 6
+#define DORD 5
+#define MSTR 4
+#define CPOL 3
+#define CPHA 2
+#define SPIF 7
+#define SPI2X 0
+
+#define ICIE1 5
+#define OCIE1B 2
+#define OCIE1A 1
+#define TOIE1 0
+#define OCIE2B 2
+#define OCIE2A 1
+#define TOIE2 0
+
+#define COM1A1 7
+#define COM1A0 6
+#define COM1B1 5
+#define COM1B0 4
+#define WGM11 1
+#define WGM10 0
+#define ICNC1 7
+#define ICES1 6
+#define WGM13 4
+#define WGM12 3
+#define CS12 2
+#define CS11 1
+#define CS10 0
+
+#define COM2A1 7
+#define COM2A0 6
+#define COM2B1 5
+#define COM2B0 4
+#define WGM21 1
+#define WGM20 0
+#define WGM22 3
+#define CS22 2
+#define CS21 1
+#define CS20 0
+
+#define TWINT 7
+#define TWEA 6
+#define TWSTA 5
+#define TWSTO 4
+#define TWWC 3
+#define TWEN 2
+#define TWIE 0
+#define TWPS1 1
+#define TWPS0 0
+
+#define RXC0 7
+#define TXC0 6
+#define UDRE0 5
+#define RXEN0 4
+#define TXEN0 3
+#define UMSEL01 7
+#define UMSEL00 6
+#define UDORD0 2
+#define UCPHA0 1
+#define UCPOL0 0
+
+#define ADEN 7
+#define ADSC 6
+#define ADPS2 2
+#define ADPS1 1
+#define ADPS0 0
+
+/*
+ * Die Interrupt-Vektoren, Nummern wie beim ATmega328P (kleiner = hoehere Prioritaet).
+ */
+#define INT0_vect         __vector_1
+#define INT1_vect         __vector_2
+#define PCINT0_vect       __vector_3
+#define PCINT1_vect       __vector_4
+#define PCINT2_vect       __vector_5
+#define TIMER2_COMPA_vect __vector_7
+#define TIMER2_COMPB_vect __vector_8
+#define TIMER2_OVF_vect   __vector_9
+#define TIMER1_CAPT_vect  __vector_10
+#define TIMER1_COMPA_vect __vector_11
+#define TIMER1_COMPB_vect __vector_12
+#define TIMER1_OVF_vect   __vector_13
+#define SPI_STC_vect      __vector_17
+#define TWI_vect          __vector_24
+
+#endif
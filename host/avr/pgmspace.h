@@ -0,0 +1,56 @@
+/**
+ * avr/pgmspace.h (Host)
+ * Auf dem Host liegt alles im RAM, PROGMEM ist leer und pgm_read_*() liest direkt.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+
+static inline uint8_t halPgmReadByte(const void* p) {
+    return *(const uint8_t*)p;
+}
+static inline uint16_t halPgmReadWord(const void* p) {
+    uint16_t w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+static inline uint32_t halPgmReadDword(const void* p) {
+    uint32_t d;
+    memcpy(&d, p, sizeof(d));
+    return d;
+}
+static inline const void* halPgmReadPtr(const void* p) {
+    const void* q;
+    memcpy(&q, p, sizeof(q));
+    return q;
+}
+
+#define pgm_read_byte(p) halPgmReadByte((const void*)(p))
+#define pgm_read_byte_near(p) halPgmReadByte((const void*)(p))
+#define pgm_read_word(p) halPgmReadWord((const void*)(p))
+#define pgm_read_word_near(p) halPgmReadWord((const void*)(p))
+#define pgm_read_dword(p) halPgmReadDword((const void*)(p))
+#define pgm_read_dword_near(p) halPgmReadDword((const void*)(p))
+#define pgm_read_ptr(p) halPgmReadPtr((const void*)(p))
+#define pgm_read_ptr_near(p) halPgmReadPtr((const void*)(p))
+
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strcmp_P strcmp
+
+#endif
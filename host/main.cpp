@@ -0,0 +1,50 @@
+/**
+ * main (Host)
+ * Laesst die Firmware auf dem Host laufen: setup(), dann loop() fuer die
+ * angegebene Zeit in virtuellen Sekunden, mit einer DS1307 am I2C-Bus.
+ * Die serielle Ausgabe geht nach stdout.
+ *
+ * Aufruf: qlockthree_host [Sekunden] [hh:mm:ss]
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostHal.h"
+#include "HostDs1307.h"
+
+// Rechenzeit eines loop()-Durchlaufs ausserhalb der Warteschleifen.
+#define HOST_LOOP_CYCLES 200
+
+int main(int argc, char** argv) {
+    unsigned long seconds = (argc > 1) ? strtoul(argv[1], 0, 10) : 10;
+    unsigned int hours = 12;
+    unsigned int minutes = 0;
+    unsigned int secs = 0;
+    if (argc > 2) {
+        sscanf(argv[2], "%u:%u:%u", &hours, &minutes, &secs);
+    }
+
+    halSerialEcho(true);
+    HostDs1307 rtc(2);
+    rtc.setTime(hours, minutes, secs, 17, 10, 26);
+    rtc.attach();
+
+    halInit();
+    setup();
+    uint64_t end = halCycles() + (uint64_t)seconds * F_CPU;
+    while (halCycles() < end) {
+        loop();
+        halAdvance(HOST_LOOP_CYCLES);
+    }
+    fflush(stdout);
+
+    HalCounters& c = halCounters();
+    fprintf(stderr, "HOST,%lu,%u,%u,%u,%u,%u,%llu\n", seconds, c.portWrites, c.spiBytes, c.usartBytes,
+        c.i2cBytes, c.interrupts, (unsigned long long)c.blockedCycles);
+    return 0;
+}
@@ -0,0 +1,44 @@
+/**
+ * util/atomic.h (Host)
+ * ATOMIC_BLOCK() sichert SREG, sperrt die Interrupts und stellt SREG am Ende wieder her.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_UTIL_ATOMIC_H
+#define HOST_UTIL_ATOMIC_H
+
+#include <avr/interrupt.h>
+
+#define ATOMIC_RESTORESTATE 0
+#define ATOMIC_FORCEON 1
+
+class HalAtomicGuard {
+public:
+    explicit HalAtomicGuard(uint8_t type) : _type(type), _sreg(SREG), once(true) {
+        cli();
+    }
+    ~HalAtomicGuard() {
+        if (_type == ATOMIC_FORCEON) {
+            sei();
+        } else {
+            SREG = _sreg;
+        }
+    }
+
+private:
+    uint8_t _type;
+    uint8_t _sreg;
+
+public:
+    bool once;
+};
+
+#define ATOMIC_BLOCK(type) for (HalAtomicGuard _halAtomicGuard(type); _halAtomicGuard.once; _halAtomicGuard.once = false)
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * Dcf77Signal
+ * DCF77-Telegramme und Flankenfolgen fuer die Tests des Empfaengers.
+ *
+ * Ein Telegramm ist ein 64-Bit-Wort, Bit n ist die Sekunde n der Minute (wie
+ * MyDCF77::_telegram). Eine Flankenfolge ist eine Liste von Pegelwechseln mit
+ * Zeitstempel in Millisekunden, so wie sie der Pin-Change-Interrupt
+ * aufzeichnet (active = Absenkung des Traegers, also Puls).
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef DCF77SIGNAL_H
+#define DCF77SIGNAL_H
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+struct Dcf77Edge {
+    unsigned long time;
+    bool active;
+};
+
+typedef std::vector<Dcf77Edge> Dcf77Trace;
+
+static uint64_t dcf77Bcd(uint64_t telegram, int first, int length, int value) {
+    int bcd = ((value / 10) << 4) | (value % 10);
+    for (int i = 0; i < length; i++) {
+        if (bcd & (1 << i)) {
+            telegram |= 1ULL << (first + i);
+        }
+    }
+    return telegram;
+}
+
+static uint64_t dcf77Parity(uint64_t telegram, int first, int last) {
+    int p = 0;
+    for (int i = first; i < last; i++) {
+        p ^= (telegram >> i) & 1;
+    }
+    return telegram | ((uint64_t)p << last);
+}
+
+/*
+ * Ein gueltiges Telegramm (mit S-Bit und Paritaeten P1-P3).
+ */
+static uint64_t dcf77Telegram(int minutes, int hours, int date, int dayOfWeek, int month, int year,
+                              bool summerTime = true, bool leapSecond = false) {
+    uint64_t t = 0;
+    t |= (uint64_t)summerTime << 17;
+    t |= (uint64_t)!summerTime << 18;
+    t |= (uint64_t)leapSecond << 19;
+    t |= 1ULL << 20;
+    t = dcf77Bcd(t, 21, 7, minutes);
+    t = dcf77Parity(t, 21, 28);
+    t = dcf77Bcd(t, 29, 6, hours);
+    t = dcf77Parity(t, 29, 35);
+    t = dcf77Bcd(t, 36, 6, date);
+    t = dcf77Bcd(t, 42, 3, dayOfWeek);
+    t = dcf77Bcd(t, 45, 5, month);
+    t = dcf77Bcd(t, 50, 8, year);
+    t = dcf77Parity(t, 36, 58);
+    return t;
+}
+
+/*
+ * Ein Feld roh (auch ungueltiges BCD) ab first eintragen und die
+ * Paritaeten P1-P3 neu berechnen, damit nur das Feld falsch ist.
+ */
+static uint64_t dcf77Field(uint64_t telegram, int first, int length, int raw) {
+    for (int i = 0; i < length; i++) {
+        telegram &= ~(1ULL << (first + i));
+        telegram |= (uint64_t)((raw >> i) & 1) << (first + i);
+    }
+    telegram &= ~((1ULL << 28) | (1ULL << 35) | (1ULL << 58));
+    telegram = dcf77Parity(telegram, 21, 28);
+    telegram = dcf77Parity(telegram, 29, 35);
+    return dcf77Parity(telegram, 36, 58);
+}
+
+/*
+ * Die Pulse einer Minute ab start (Sekunde 0) anhaengen, 100ms fuer 0 und
+ * 200ms fuer 1. In der 59. Sekunde fehlt der Puls. jitter verschiebt jede
+ * Flanke zufaellig um bis zu +-jitter Millisekunden.
+ */
+static void dcf77AddMinute(Dcf77Trace& trace, uint64_t telegram, unsigned long start, int jitter = 0) {
+    for (int second = 0; second < 59; second++) {
+        unsigned long begin = start + second * 1000UL;
+        unsigned long width = ((telegram >> second) & 1) ? 200 : 100;
+        long shiftBegin = jitter ? (rand() % (2 * jitter + 1)) - jitter : 0;
+        long shiftEnd = jitter ? (rand() % (2 * jitter + 1)) - jitter : 0;
+        trace.push_back({ begin + shiftBegin, true });
+        trace.push_back({ begin + width + shiftEnd, false });
+    }
+}
+
+/*
+ * Einen Puls (active) bzw. einen Aussetzer im Puls (!active) von length
+ * Millisekunden bei time einfuegen.
+ */
+static void dcf77AddGlitch(Dcf77Trace& trace, unsigned long time, unsigned long length, bool active) {
+    trace.push_back({ time, active });
+    trace.push_back({ time + length, !active });
+}
+
+static void dcf77Sort(Dcf77Trace& trace) {
+    std::stable_sort(trace.begin(), trace.end(), [](const Dcf77Edge& a, const Dcf77Edge& b) {
+        return a.time < b.time;
+    });
+}
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * HostTest
+ * Hilfen fuer die Tests auf dem Host: CHECK-Makros und das Starten und
+ * Laufenlassen der Firmware mit einer DS1307 (siehe host/HostHal.h).
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOSTTEST_H
+#define HOSTTEST_H
+
+#include "HostHal.h"
+#include "HostDs1307.h"
+
+// Rechenzeit eines loop()-Durchlaufs ausserhalb der Warteschleifen.
+#define HOST_LOOP_CYCLES 200
+
+static int hostTestFailures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK(%s) fehlgeschlagen\n", __FILE__, __LINE__, #cond); \
+            hostTestFailures++; \
+        } \
+    } while (0)
+
+#define CHECK_EQUAL(a, b) \
+    do { \
+        long long _a = (long long)(a); \
+        long long _b = (long long)(b); \
+        if (_a != _b) { \
+            fprintf(stderr, "%s:%d: CHECK_EQUAL(%s, %s) fehlgeschlagen: %lld != %lld\n", \
+                __FILE__, __LINE__, #a, #b, _a, _b); \
+            hostTestFailures++; \
+        } \
+    } while (0)
+
+static int hostTestResult() {
+    if (hostTestFailures) {
+        fprintf(stderr, "%d Fehler\n", hostTestFailures);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * DS1307 an SQW-Pin 2 auf die Zeit stellen, init() des Arduino-Kerns und dann
+ * setup() aufrufen. Der Reset der Hardware ist schon vor den Konstruktoren der
+ * Firmware gelaufen (HostHal.cpp).
+ */
+static void hostBoot(HostDs1307& rtc, uint8_t hours, uint8_t minutes, uint8_t seconds) {
+    rtc.setTime(hours, minutes, seconds, 17, 10, 26);
+    rtc.attach();
+    halInit();
+    setup();
+}
+
+/*
+ * loop() fuer cycles Takte laufen lassen.
+ */
+static void hostRun(uint64_t cycles) {
+    uint64_t end = halCycles() + cycles;
+    while (halCycles() < end) {
+        loop();
+        halAdvance(HOST_LOOP_CYCLES);
+    }
+}
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * bench_boot
+ * Wie lange der Start dauert und was das Laden der Einstellungen (mit Weckzeit,
+ * Nachtzeiten und Farbe im zweiten Datensatz) davon ausmacht.
+ *
+ * Gemessen wird im Host-HAL mit dem Kostenmodell (halCostModel()): das Laden
+ * (Durchsuchen des EepromLog plus Auspacken) einmal mit geloeschtem EEPROM und
+ * einmal mit gespeicherten Einstellungen, danach setup() bis zur ersten
+ * Anzeige. In setup() stecken vor allem die Wartezeiten (delay()).
+ *
+ * Ausgabe: RESTORE,<EEPROM>,<Takte>,<Mikrosekunden>
+ *          BOOT,<Millisekunden>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Settings.h"
+#include "EepromLog.h"
+
+/*
+ * Die Einstellungen wie nach einem Neustart laden: das EepromLog weiss
+ * noch nichts und muss das EEPROM durchsuchen.
+ */
+static uint64_t restore(const char* name) {
+    eepromLog = EepromLog();
+    halCostModel(true);
+    uint64_t start = halCycles();
+    Settings restored;
+    uint64_t cycles = halCycles() - start;
+    halCostModel(false);
+    printf("RESTORE,%s,%lu,%lu\n", name, (unsigned long)cycles, (unsigned long)(cycles / HAL_CYCLES_PER_US));
+    return cycles;
+}
+
+int main() {
+    halEepromErase();
+    restore("empty");
+
+    Settings saved;
+    saved.setAlarmTime(6 * 60 + 45);
+    saved.setNightOff(23 * 60);
+    saved.setNightOn(6 * 60);
+    saved.setColor(10, 20, 30);
+    saved.setBrightness(70);
+    // Ein Datensatz pro Aufruf: erst die Einstellungen, dann der zweite Satz.
+    saved.saveToEEPROM();
+    eepromLog.flush();
+    saved.saveToEEPROM();
+    eepromLog.flush();
+    // Das letzte Byte ist beim Neustart laengst geschrieben.
+    halAdvanceMicros(10000);
+
+    uint64_t cycles = restore("saved");
+    Settings check;
+    CHECK_EQUAL(check.getAlarmTime(), 6 * 60 + 45);
+    CHECK_EQUAL(check.getNightOff(), 23 * 60);
+    CHECK_EQUAL(check.getNightOn(), 6 * 60);
+    CHECK_EQUAL(check.getBlue(), 30);
+
+    HostDs1307 rtc(2);
+    halCostModel(true);
+    uint64_t start = halCycles();
+    hostBoot(rtc, 10, 21, 0);
+    uint64_t boot = halCycles() - start;
+    halCostModel(false);
+    printf("BOOT,%lu\n", (unsigned long)(boot / HAL_CYCLES_PER_US / 1000));
+
+    // Das Laden darf den Start nicht merklich verlaengern.
+    CHECK(cycles * 100 < boot);
+    return hostTestResult();
+}
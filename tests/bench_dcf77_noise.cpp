@@ -0,0 +1,101 @@
+/**
+ * bench_dcf77_noise
+ * Zeit bis zur ersten richtigen Uhrzeit vom DCF77-Empfaenger bei
+ * verrauschtem Signal, fuer den Flanken-Dekoder (MYDCF77_EDGE_INTERRUPT)
+ * und den Soft-Dekoder (MYDCF77_SOFT_DECODER), je nach Firmware-Variante.
+ *
+ * Das Signal ist die ideale Absenkung (0 oder 1) plus weisses Rauschen
+ * (Normalverteilung, Standardabweichung sigma), alle 5ms mit 0.5 als
+ * Schwelle auf den Pin gegeben. Der Signal-Rausch-Abstand ist
+ * 20 * log10(0.5 / sigma) dB. Jeder Pegelwechsel geht wie im
+ * Pin-Change-Interrupt an edgeInterrupt(), poll() laeuft nach jedem Schritt.
+ * Gezaehlt wird auch, wie oft eine falsche Uhrzeit herauskommt.
+ *
+ * Ausgabe: SYNC,<Dekoder>,<SNR dB>,<Sekunden bis zur Uhrzeit, -1 = nie>,<falsche Uhrzeiten>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include <random>
+#include "HostTest.h"
+#include "Dcf77Signal.h"
+#include "MyDCF77.h"
+
+#ifdef MYDCF77_SOFT_DECODER
+#define DECODER "soft"
+#else
+#define DECODER "edge"
+#endif
+
+#define PIN_SIGNAL 9
+#define STEP_MS 5
+#define MINUTES 30
+
+struct Result {
+    long seconds;
+    int wrong;
+};
+
+static Result measure(double snr) {
+    MyDCF77 receiver(PIN_SIGNAL, 8);
+    std::mt19937 generator(42);
+    std::normal_distribution<double> noise(0.0, 0.5 / pow(10.0, snr / 20.0));
+
+    // Ab 10:00, die Minute k ist 10:00 + k. Das Signal haengt an der
+    // Uhr des Hosts, nicht an der Zahl der Schritte: edgeInterrupt() und
+    // poll() kosten selbst Takte, sonst liefe das Signal gegen millis() weg.
+    uint64_t start = halMicros();
+    boolean level = false;
+    halSetPin(PIN_SIGNAL, LOW);
+    Result result = { -1, 0 };
+    for (unsigned long t = 0; t < MINUTES * 60000UL; t += STEP_MS) {
+        unsigned long minute = t / 60000;
+        unsigned long second = (t / 1000) % 60;
+        unsigned long ms = t % 1000;
+        uint64_t telegram = dcf77Telegram(minute % 60, 10 + minute / 60, 17, 6, 10, 26);
+        boolean pulse = (second < 59) && (ms < (((telegram >> second) & 1) ? 200UL : 100UL));
+        boolean sample = (pulse ? 1.0 : 0.0) + noise(generator) > 0.5;
+        if (sample != level) {
+            level = sample;
+            halSetPin(PIN_SIGNAL, level ? HIGH : LOW);
+            receiver.edgeInterrupt();
+        }
+        uint64_t next = start + (uint64_t)(t + STEP_MS) * 1000;
+        if (halMicros() < next) {
+            halAdvanceMicros(next - halMicros());
+        }
+        receiver.poll(false);
+        if (receiver.newSecond()) {
+            // Ausgewertet wird die Minute, die gerade zu Ende ist.
+            int expected = 10 * 60 + (int)minute - 1;
+            if (receiver.getHours() * 60 + receiver.getMinutes() == expected) {
+                if (result.seconds < 0) {
+                    result.seconds = (t + STEP_MS) / 1000;
+                }
+            } else {
+                result.wrong++;
+            }
+        }
+    }
+    printf("SYNC,%s,%.0f,%ld,%d\n", DECODER, snr, result.seconds, result.wrong);
+    return result;
+}
+
+int main() {
+    static const double snrs[] = { 20, 12, 9, 6, 3, 0 };
+    for (byte i = 0; i < sizeof(snrs) / sizeof(snrs[0]); i++) {
+        Result result = measure(snrs[i]);
+        if (snrs[i] >= 20) {
+            // Ein sauberes Signal muss in ein paar Minuten zur Uhrzeit fuehren.
+            CHECK(result.seconds > 0);
+            CHECK(result.seconds < 10 * 60);
+            CHECK_EQUAL(result.wrong, 0);
+        }
+    }
+    return hostTestResult();
+}
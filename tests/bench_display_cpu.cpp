@@ -0,0 +1,96 @@
+/**
+ * bench_display_cpu
+ * CPU-Anteil der Anzeige fuer LedDriverDefault (loop()-Betrieb und
+ * MULTIPLEX_IN_ISR) und LedDriverBAM bei 5% und 100% Helligkeit.
+ *
+ * Gemessen wird im Host-HAL mit dem Kostenmodell (halCostModel()): Register-
+ * zugriffe, Wartezeiten und Sprung in die ISR kosten Takte, der C-Code
+ * dazwischen nicht. Die Werte sind also eine untere Grenze, die Verhaeltnisse
+ * zwischen den Treibern stimmen aber, weil die Wartezeiten ueberwiegen.
+ * Im loop()-Betrieb gehoert die ganze Zeit eines Frames der Anzeige.
+ *
+ * Ausgabe: CPU,<Treiber>,<Helligkeit>,<Takte pro Frame>,<Frames pro Sekunde>,<Prozent>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Configuration.h"
+#include "LedDriverDefault.h"
+#include "LedDriverBAM.h"
+
+#ifdef LED_DRIVER_BAM
+extern LedDriverBAM <
+  DPIN(37, 35, 36, 2),
+  DPIN(37, 35, 36, 4),
+  DPIN(37, 35, 36, 3),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+#define DRIVER "BAM"
+#define FRAME_CYCLES (10UL * 255 * BAM_UNIT * HAL_CYCLES_PER_US)
+#else
+extern LedDriverDefault <
+  DPIN(37, 35, 36, 2),
+  DPIN(37, 35, 36, 4),
+  DPIN(37, 35, 36, 3),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+#ifdef MULTIPLEX_IN_ISR
+#define DRIVER "Default-ISR"
+#define FRAME_CYCLES (10UL * MULTIPLEX_ROW_DURATION * HAL_CYCLES_PER_US)
+#else
+#define DRIVER "Default"
+#endif
+#endif
+
+static double measure(byte brightness) {
+    ledDriver.setBrightness(brightness);
+#if defined(LED_DRIVER_BAM) || defined(MULTIPLEX_IN_ISR)
+    // Die ISR frischt auf, loop() laeuft nicht.
+    halAdvance(FRAME_CYCLES);
+    uint64_t isr = halCounters().isrCycles[11] + halCounters().isrCycles[12];
+    uint64_t start = halCycles();
+    halAdvance(F_CPU);
+    uint64_t elapsed = halCycles() - start;
+    isr = halCounters().isrCycles[11] + halCounters().isrCycles[12] - isr;
+    double frames = (double)elapsed / FRAME_CYCLES;
+    double cpu = 100.0 * isr / elapsed;
+    printf("CPU,%s,%u,%.0f,%.1f,%.2f\n", DRIVER, brightness, isr / frames, frames, cpu);
+    return cpu;
+#else
+    // Refresh-Aufrufe wie aus loop(), jeder ist ein ganzer Frame.
+    word matrix[16];
+    memset(matrix, 0xFF, sizeof(matrix));
+    ledDriver.writeScreenBufferToMatrix(matrix, true);
+    uint64_t start = halCycles();
+    for (int i = 0; i < 100; i++) {
+        ledDriver.writeScreenBufferToMatrix(matrix, false);
+    }
+    double frame = (double)(halCycles() - start) / 100;
+    printf("CPU,%s,%u,%.0f,%.1f,%.2f\n", DRIVER, brightness, frame, F_CPU / frame, 100.0);
+    return 100.0;
+#endif
+}
+
+int main() {
+    HostDs1307 rtc(2);
+    hostBoot(rtc, 10, 21, 0);
+    // Die Uhrzeit steht erst nach dem ersten Durchlauf von loop() in der Anzeige.
+    hostRun(2 * F_CPU);
+    halCostModel(true);
+
+    double low = measure(5);
+    double high = measure(100);
+#if defined(LED_DRIVER_BAM) || defined(MULTIPLEX_IN_ISR)
+    // Die ISR-Treiber lassen den groessten Teil der CPU fuer loop() uebrig.
+    CHECK(low < 25);
+    CHECK(high < 25);
+#else
+    CHECK(low == 100);
+    CHECK(high == 100);
+#endif
+    return hostTestResult();
+}
@@ -0,0 +1,40 @@
+# bench_language_size
+# Groesse von Renderer.cpp (Code plus Worttabellen) je nach den Sprachen aus
+# Configuration.h (ENABLE_LANGUAGE_XX), gegen alle Sprachen zusammen.
+#
+# Mit avr-g++, avr-size und dem Arduino-Core (ARDUINO_AVR) wird fuer den
+# ATmega328P uebersetzt und gemessen (Ziel 'avr'). Sonst misst 'size' die
+# Objektdateien des Hosts (Ziel 'host-proxy'): die Tabellen sind Bytes und
+# damit auf dem AVR genauso gross, der Code ist dort kleiner. Die Ersparnis
+# pro Sprache ist dann eine Schaetzung, kein Wert fuer den Flash.
+#
+# Aufruf (aus tests/CMakeLists.txt):
+#   cmake -DSIZE=<size> -DTARGET=avr|host-proxy -DLANGUAGES=<name,...> -DOBJECT_<name>=<datei.o> ... -P bench_language_size.cmake
+# Die erste Sprache in LANGUAGES ist die Referenz (alle Sprachen).
+#
+# Ausgabe: SIZE,<Sprachen>,<text>,<data>,<Ersparnis in Bytes>,<Ziel>
+
+string(REPLACE "," ";" LANGUAGES "${LANGUAGES}")
+
+set(reference)
+foreach(language ${LANGUAGES})
+  execute_process(COMMAND ${SIZE} ${OBJECT_${language}}
+    OUTPUT_VARIABLE output
+    RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${SIZE} ${OBJECT_${language}} fehlgeschlagen")
+  endif()
+  # Zweite Zeile: text data bss dec hex filename
+  string(REGEX MATCH "\n[ \t]*([0-9]+)[ \t]+([0-9]+)" match "${output}")
+  set(text ${CMAKE_MATCH_1})
+  set(data ${CMAKE_MATCH_2})
+  math(EXPR total "${text} + ${data}")
+  if(NOT reference)
+    set(reference ${total})
+  endif()
+  math(EXPR saved "${reference} - ${total}")
+  message("SIZE,${language},${text},${data},${saved},${TARGET}")
+  if(NOT language STREQUAL "all" AND NOT saved GREATER 0)
+    message(FATAL_ERROR "${language}: keine Ersparnis gegen alle Sprachen")
+  endif()
+endforeach()
@@ -0,0 +1,265 @@
+/**
+ * bench_profile
+ * Laufzeiten der heissen Stellen mit dem Kostenmodell des Host-HAL
+ * (halCostModel()): Takte pro Aufruf von LedDriverDefault::writeScreenBufferToMatrix(),
+ * Renderer::setMinutes(), MyDCF77::edge()/newSecond() und IRrecv::decode(),
+ * dazu die Refresh-Rate und der laengste Durchlauf von loop().
+ *
+ * Das Kostenmodell zaehlt Registerzugriffe, Wartezeiten und ISRs, der C-Code
+ * dazwischen kostet nichts. Fuer reinen C-Code (setMinutes(), der DCF77-
+ * Decoder, decode()) steht deshalb zusaetzlich die Zeit auf dem Host da, die
+ * nur zum Vergleich vor und nach Aenderungen taugt.
+ *
+ * loop() laeuft dabei ueber einen Minutenwechsel (Lesen der RTC), waehrend
+ * Minuten+ gedrueckt wird und ein Befehl ueber Serial kommt.
+ *
+ * Ausgabe (auch in die Datei bench_profile.csv im Arbeitsverzeichnis):
+ *   CALL,<funktion>,<aufrufe>,<mittel takte>,<max takte>,<ns pro aufruf auf dem host>
+ *   REFRESH,<refreshs pro sekunde>
+ *   LOOP,<durchlaeufe>,<laengster durchlauf in us>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include <chrono>
+#include <stdarg.h>
+#include "HostTest.h"
+#include "Dcf77Signal.h"
+#include "Configuration.h"
+#include "LedDriverDefault.h"
+#include "Renderer.h"
+#include "Settings.h"
+#include "MyDCF77.h"
+#include "MyIRremote.h"
+
+// wie in Qlockthree.ino
+#define PIN_M_PLUS 5
+#define PIN_IR_RECEIVER A1
+
+extern LedDriverDefault <
+  DPIN(37, 35, 36, 2),
+  DPIN(37, 35, 36, 4),
+  DPIN(37, 35, 36, 3),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+extern Renderer renderer;
+extern Settings settings;
+extern IRrecv irrecv;
+
+static FILE* results;
+
+/*
+ * Eine Zeile auf stdout und in die Ergebnisdatei.
+ */
+static void report(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    va_start(args, format);
+    vfprintf(results, format, args);
+    va_end(args);
+}
+
+struct Profile {
+    const char* name;
+    unsigned long calls;
+    uint64_t cycles;
+    uint64_t maxCycles;
+    std::chrono::steady_clock::time_point started;
+    std::chrono::nanoseconds elapsed;
+
+    explicit Profile(const char* n) : name(n), calls(0), cycles(0), maxCycles(0), elapsed(0) {
+    }
+
+    uint64_t start() {
+        started = std::chrono::steady_clock::now();
+        return halCycles();
+    }
+
+    void stop(uint64_t startCycles) {
+        uint64_t duration = halCycles() - startCycles;
+        elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started);
+        calls++;
+        cycles += duration;
+        if (duration > maxCycles) {
+            maxCycles = duration;
+        }
+    }
+
+    void print() {
+        CHECK(calls > 0);
+        report("CALL,%s,%lu,%llu,%llu,%.0f\n", name, calls, (unsigned long long)(cycles / calls),
+               (unsigned long long)maxCycles, (double)elapsed.count() / calls);
+    }
+};
+
+static void profileRefresh() {
+    Profile profile("writeScreenBufferToMatrix");
+    word matrix[16];
+    renderer.clearScreenBuffer(matrix);
+    renderer.setMinutes(10, 21, settings.getLanguage(), matrix);
+    for (int i = 0; i < 100; i++) {
+        uint64_t start = profile.start();
+        ledDriver.writeScreenBufferToMatrix(matrix, false);
+        profile.stop(start);
+    }
+    CHECK(profile.cycles > 0);
+    profile.print();
+}
+
+static void profileSetMinutes() {
+    Profile profile("setMinutes");
+    word matrix[16];
+    for (int hours = 0; hours < 24; hours++) {
+        for (int minutes = 0; minutes < 60; minutes++) {
+            renderer.clearScreenBuffer(matrix);
+            uint64_t start = profile.start();
+            renderer.setMinutes(hours, minutes, settings.getLanguage(), matrix);
+            profile.stop(start);
+        }
+    }
+    profile.print();
+}
+
+/*
+ * Zwei Minuten DCF77 wie vom Pin-Change-Interrupt, newSecond() jede Sekunde
+ * kurz nach dem Puls wie in taskUpdate().
+ */
+static void profileDcf77() {
+    static MyDCF77 receiver(9, 8);
+    Profile edge("MyDCF77::edge");
+    Profile newSecond("MyDCF77::newSecond");
+    Dcf77Trace trace;
+    dcf77AddMinute(trace, dcf77Telegram(21, 10, 17, 6, 10, 26), 5000);
+    dcf77AddMinute(trace, dcf77Telegram(22, 10, 17, 6, 10, 26), 65000);
+    dcf77AddMinute(trace, dcf77Telegram(23, 10, 17, 6, 10, 26), 125000);
+
+    int decoded = 0;
+    size_t next = 0;
+    for (unsigned long second = 5; second < 185; second++) {
+        unsigned long now = second * 1000 + 500;
+        while ((next < trace.size()) && (trace[next].time < now)) {
+            uint64_t start = edge.start();
+            receiver.edge(trace[next].active, (word)trace[next].time);
+            edge.stop(start);
+            next++;
+        }
+        uint64_t start = newSecond.start();
+        boolean captured = receiver.newSecond();
+        newSecond.stop(start);
+        if (captured) {
+            decoded++;
+            CHECK_EQUAL(receiver.getHours(), 10);
+        }
+    }
+    // Die Minuten 21 und 22 (23 kommt erst mit dem Puls danach).
+    CHECK_EQUAL(decoded, 2);
+    edge.print();
+    newSecond.print();
+}
+
+/*
+ * Ein NEC-Code am Empfaenger (aktiv LOW), den Timer2-Interrupt laufen lassen.
+ * Davor muss der Empfaenger eine Pause lang HIGH sein.
+ */
+static void sendNec(unsigned long code) {
+    halSetPin(PIN_IR_RECEIVER, HIGH);
+    halAdvanceMicros(20000);
+    halSetPin(PIN_IR_RECEIVER, LOW);
+    halAdvanceMicros(9000);
+    halSetPin(PIN_IR_RECEIVER, HIGH);
+    halAdvanceMicros(4500);
+    for (int bit = 31; bit >= 0; bit--) {
+        halSetPin(PIN_IR_RECEIVER, LOW);
+        halAdvanceMicros(560);
+        halSetPin(PIN_IR_RECEIVER, HIGH);
+        halAdvanceMicros(((code >> bit) & 1) ? 1690 : 560);
+    }
+    halSetPin(PIN_IR_RECEIVER, LOW);
+    halAdvanceMicros(560);
+    halSetPin(PIN_IR_RECEIVER, HIGH);
+    // Die Pause danach beendet den Code.
+    halAdvanceMicros(20000);
+}
+
+static void profileIr() {
+    Profile profile("IRrecv::decode");
+    decode_results decoded;
+    irrecv.resume();
+    sendNec(0x00FF18E7UL);
+    for (int i = 0; i < 100; i++) {
+        uint64_t start = profile.start();
+        int result = irrecv.decode(&decoded);
+        profile.stop(start);
+        CHECK(result);
+    }
+    CHECK_EQUAL(decoded.decode_type, NEC);
+    CHECK_EQUAL(decoded.value, 0x00FF18E7UL);
+    irrecv.resume();
+    profile.print();
+}
+
+/*
+ * loop() wie in hostRun(), dabei jeden Durchlauf messen. Jeder Durchlauf
+ * frischt die Anzeige einmal auf. Minuten+ ist die erste Viertelsekunde
+ * gedrueckt.
+ */
+static void profileLoop(uint64_t cycles) {
+    uint64_t startCycles = halCycles();
+    uint64_t end = startCycles + cycles;
+    unsigned long passes = 0;
+    uint64_t maxCycles = 0;
+    halSetPin(PIN_M_PLUS, HIGH);
+    while (halCycles() < end) {
+        if (halCycles() - startCycles >= F_CPU / 4) {
+            halSetPin(PIN_M_PLUS, LOW);
+        }
+        uint64_t start = halCycles();
+        loop();
+        uint64_t duration = halCycles() - start;
+        if (duration > maxCycles) {
+            maxCycles = duration;
+        }
+        passes++;
+        halAdvance(HOST_LOOP_CYCLES);
+    }
+    double refreshHz = (double)passes * F_CPU / (halCycles() - startCycles);
+    CHECK(passes > 0);
+    // unter 50 Hz flimmert es
+    CHECK(refreshHz >= 50);
+    report("REFRESH,%.1f\n", refreshHz);
+    report("LOOP,%lu,%lu\n", passes, (unsigned long)(maxCycles / HAL_CYCLES_PER_US));
+}
+
+int main() {
+    results = fopen("bench_profile.csv", "w");
+    if (!results) {
+        fprintf(stderr, "bench_profile.csv laesst sich nicht schreiben\n");
+        return 1;
+    }
+
+    HostDs1307 rtc(2);
+    hostBoot(rtc, 10, 20, 58);
+    hostRun(F_CPU / 2);
+
+    halCostModel(true);
+    uint32_t reads = rtc.getReads();
+    halSerialInput("D");
+    profileLoop(3 * F_CPU);
+    // Ueber den Minutenwechsel wurde die RTC gelesen.
+    CHECK(rtc.getReads() > reads);
+
+    profileRefresh();
+    profileSetMinutes();
+    profileDcf77();
+    profileIr();
+    halCostModel(false);
+
+    fclose(results);
+    return hostTestResult();
+}
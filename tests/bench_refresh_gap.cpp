@@ -0,0 +1,194 @@
+/**
+ * bench_refresh_gap
+ * Die groesste Luecke zwischen zwei Refreshs mit dem Scheduler (nach dem
+ * Refresh hoechstens eine Aufgabe) gegen die alte, sequentielle loop() (nach
+ * dem Refresh alle faelligen Aufgaben), die hier im Test nachgebaut ist.
+ *
+ * Gemessen wird mit dem Kostenmodell (halCostModel()) ueber einen Minutenwechsel
+ * (Lesen der RTC), waehrend der LDR eine andere Helligkeit will, Minuten+
+ * gedrueckt wird und ein Befehl ueber Serial kommt. Einmal am Latch der
+ * Shift-Register (wie bench_refresh_stall) und einmal zwischen den Aufrufen
+ * des Refreshs (beim Scheduler dessen Messung, 'L' ueber Serial).
+ *
+ * Mit dem Scheduler darf zwischen zwei Refreshs hoechstens eine Aufgabe liegen:
+ * die Luecke am Latch ist hoechstens eine Zeile plus die laengste Aufgabe,
+ * das Lesen der RTC mit Wire (gut 1 ms, 11 Bytes bei 100 kHz), die zwischen
+ * den Refreshs ein Bild (zehn Zeilen und das Rausschieben) plus diese Aufgabe.
+ * Eine Aufgabe darf also nicht selbst ein ganzes Bild ausgeben.
+ *
+ * Ausgabe: GAP,<loop>,<groesster Abstand der Latch-Impulse in us>,<groesster Abstand der Refreshs in us>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Configuration.h"
+#include "Scheduler.h"
+
+// wie in Qlockthree.ino
+#define PIN_LATCH 11
+#define PIN_M_PLUS 5
+#define PIN_LDR A3
+#define ROW_DURATION (100 * PWM_DURATION)
+#define MAX_TASK_DURATION 1200
+#define MAX_GAP (ROW_DURATION + MAX_TASK_DURATION)
+#define MAX_REFRESH_GAP (11 * ROW_DURATION + MAX_TASK_DURATION)
+
+void taskRefresh();
+void taskSerial();
+void taskStorage();
+void taskLdr();
+void taskUpdate();
+#ifdef ENABLE_TRANSITIONS
+void taskTransition();
+#endif
+void taskButtons();
+#ifndef REMOTE_NO_REMOTE
+void taskIr();
+#endif
+void taskEvents();
+void taskClock();
+void taskStatusLeds();
+
+static uint64_t lastLatch = 0;
+static uint64_t maxGap = 0;
+
+static void pinChanged(uint8_t pin, uint8_t level) {
+    if ((pin != PIN_LATCH) || !level) {
+        return;
+    }
+    uint64_t now = halMicros();
+    if (lastLatch && (now - lastLatch > maxGap)) {
+        maxGap = now - lastLatch;
+    }
+    lastLatch = now;
+}
+
+/*
+ * Die alte loop() zum Vergleich: nach dem Refresh alle faelligen Aufgaben
+ * nacheinander, mit den Takten aus setup().
+ */
+struct SequentialTask {
+    SchedulerTask task;
+    word period;
+    word lastRun;
+};
+
+static SequentialTask sequentialTasks[] = {
+    {taskUpdate, 0, 0},
+    {taskEvents, 0, 0},
+#ifdef ENABLE_TRANSITIONS
+    {taskTransition, 0, 0},
+#endif
+    {taskButtons, 10, 0},
+#ifndef REMOTE_NO_REMOTE
+    {taskIr, 10, 0},
+#endif
+    {taskLdr, LDR_CHECK_RATE, 0},
+    {taskSerial, 10, 0},
+    {taskStorage, 4, 0},
+    {taskClock, 100, 0},
+    {taskStatusLeds, 20, 0}
+};
+
+static unsigned long lastRefresh = 0;
+static unsigned long sequentialGap = 0;
+
+static void sequentialLoop() {
+    unsigned long now = micros();
+    if (lastRefresh && (now - lastRefresh > sequentialGap)) {
+        sequentialGap = now - lastRefresh;
+    }
+    lastRefresh = now;
+    taskRefresh();
+    word ms = millis();
+    for (unsigned int i = 0; i < sizeof(sequentialTasks) / sizeof(sequentialTasks[0]); i++) {
+        if ((word)(ms - sequentialTasks[i].lastRun) >= sequentialTasks[i].period) {
+            sequentialTasks[i].lastRun = ms;
+            sequentialTasks[i].task();
+        }
+    }
+}
+
+/*
+ * Die groesste Luecke aus 'SCHED,<durchlaeufe>,<aufgaben>,<max luecke us>'.
+ */
+static unsigned long schedulerGap() {
+    halSerialClear();
+    halSerialInput("L");
+    hostRun(F_CPU / 10);
+    const char* line = strstr(halSerialOutput(), "SCHED,");
+    CHECK(line != NULL);
+    unsigned long passes, runs, gap = 0;
+    if (line) {
+        sscanf(line, "SCHED,%lu,%lu,%lu", &passes, &runs, &gap);
+    }
+    return gap;
+}
+
+static void run(void (*step)(), uint64_t cycles) {
+    uint64_t end = halCycles() + cycles;
+    while (halCycles() < end) {
+        step();
+        halAdvance(HOST_LOOP_CYCLES);
+    }
+}
+
+/*
+ * Bis kurz vor den naechsten Minutenwechsel laufen, dann den LDR aendern,
+ * Minuten+ druecken und die Nachtzeiten schicken.
+ */
+static void scenario(HostDs1307& rtc, void (*step)(), int ldr) {
+    while (rtc.getTime() % 60 != 57) {
+        run(step, F_CPU / 10);
+    }
+    uint32_t reads = rtc.getReads();
+    maxGap = 0;
+    lastLatch = 0;
+    halCostModel(true);
+    halOnPinChange(pinChanged);
+    halSetAnalog(PIN_LDR, ldr);
+    halSerialInput("N 2300 0600\n");
+    run(step, F_CPU / 2);
+    halSetPin(PIN_M_PLUS, HIGH);
+    run(step, F_CPU / 4);
+    halSetPin(PIN_M_PLUS, LOW);
+    run(step, 3 * F_CPU);
+    halOnPinChange(NULL);
+    halCostModel(false);
+    // Ueber den Minutenwechsel wurde die RTC gelesen.
+    CHECK(rtc.getReads() > reads);
+    CHECK(maxGap >= ROW_DURATION);
+}
+
+int main() {
+    HostDs1307 rtc(2);
+    hostBoot(rtc, 10, 20, 50);
+    halSetAnalog(PIN_LDR, 512);
+    hostRun(F_CPU);
+
+    // die Messung des Schedulers beginnt hier
+    schedulerGap();
+    scenario(rtc, loop, 100);
+    unsigned long gap = schedulerGap();
+    CHECK(gap > 0);
+    if (maxGap > MAX_GAP) {
+        fprintf(stderr, "Luecke am Latch %lu us, erlaubt %d us\n", (unsigned long)maxGap, MAX_GAP);
+    }
+    CHECK(maxGap <= MAX_GAP);
+    if (gap > MAX_REFRESH_GAP) {
+        fprintf(stderr, "Luecke zwischen den Refreshs %lu us, erlaubt %d us\n", gap, MAX_REFRESH_GAP);
+    }
+    CHECK(gap <= MAX_REFRESH_GAP);
+    printf("GAP,scheduler,%lu,%lu\n", (unsigned long)maxGap, gap);
+
+    scenario(rtc, sequentialLoop, 512);
+    CHECK(sequentialGap > 0);
+    printf("GAP,sequential,%lu,%lu\n", (unsigned long)maxGap, sequentialGap);
+    return hostTestResult();
+}
@@ -0,0 +1,69 @@
+/**
+ * bench_refresh_stall
+ * Wie lange das Multiplexen in loop() beim Lesen der RTC stockt: mit Wire
+ * wartet loop() auf den Bus, mit ENABLE_ASYNC_TWI laeuft das Lesen im
+ * Hintergrund, je nach Firmware-Variante.
+ *
+ * Gemessen wird der groesste Abstand zweier Latch-Impulse der
+ * Shift-Register ueber einen Minutenwechsel (dann wird die RTC gelesen).
+ * Regulaer liegt zwischen zwei Zeilen eine Zeilendauer (100 * PWM_DURATION
+ * Mikrosekunden), was darueber hinausgeht, ist die Stockung.
+ *
+ * Ausgabe: STALL,<TWI>,<groesster Abstand in us>,<Stockung in us>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Configuration.h"
+
+#ifdef ENABLE_ASYNC_TWI
+#define TWI "async"
+#else
+#define TWI "Wire"
+#endif
+
+// Latch der Shift-Register wie in Qlockthree.ino (Bit-Banging, PB3)
+#define PIN_LATCH 11
+#define ROW_DURATION (100 * PWM_DURATION)
+
+static uint64_t lastLatch = 0;
+static uint64_t maxGap = 0;
+
+static void pinChanged(uint8_t pin, uint8_t level) {
+    if ((pin != PIN_LATCH) || !level) {
+        return;
+    }
+    uint64_t now = halMicros();
+    if (lastLatch && (now - lastLatch > maxGap)) {
+        maxGap = now - lastLatch;
+    }
+    lastLatch = now;
+}
+
+int main() {
+    HostDs1307 rtc(2);
+    hostBoot(rtc, 10, 20, 57);
+    hostRun(F_CPU);
+
+    uint32_t reads = rtc.getReads();
+    halOnPinChange(pinChanged);
+    hostRun(4 * F_CPU);
+    halOnPinChange(NULL);
+
+    // Ueber den Minutenwechsel wurde die RTC gelesen.
+    CHECK(rtc.getReads() > reads);
+    long stall = (long)maxGap - ROW_DURATION;
+    printf("STALL,%s,%lu,%ld\n", TWI, (unsigned long)maxGap, stall);
+    CHECK(maxGap >= ROW_DURATION);
+#ifdef ENABLE_ASYNC_TWI
+    // Im Hintergrund darf das Lesen die Anzeige nicht laenger als eine Zeile aufhalten.
+    CHECK(stall < ROW_DURATION);
+#endif
+    return hostTestResult();
+}
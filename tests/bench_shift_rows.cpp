@@ -0,0 +1,84 @@
+/**
+ * bench_shift_rows
+ * Zeilen pro Sekunde beim Schieben in die 74HC595 per Bit-Banging,
+ * Hardware-SPI (SHIFTREGISTER_SPI) und USART-SPI (SHIFTREGISTER_USART_SPI),
+ * jeweils uebersetzt gegen die passende Firmware-Variante.
+ *
+ * Gemessen wird im Host-HAL mit dem Kostenmodell (halCostModel()): jede
+ * Zeile sind zwei shiftOut() plus Latch wie in LedDriverDefault. Beim
+ * Bit-Banging zaehlen die Portzugriffe, bei SPI/USART die Takte auf dem Bus
+ * und das Warten darauf. Ohne den C-Code dazwischen ist das eine obere
+ * Grenze fuer die Zeilenrate. Mit MULTIPLEX_IN_ISR wird zusaetzlich gezeigt,
+ * wie viele Takte die ISR pro Zeile braucht: mit SPI laeuft das Schieben
+ * der naechsten Zeile, waehrend die aktuelle leuchtet.
+ * (Ein taktgenauer AVR-Simulator wie simavr steht hier nicht zur Verfuegung.)
+ *
+ * Ausgabe: ROWS,<Ausgabe>,<Takte pro Zeile>,<Zeilen pro Sekunde>
+ *          ISR,<Ausgabe>,<Takte pro Zeile>,<Prozent CPU>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Configuration.h"
+#include "ShiftRegister.h"
+#include "LedDriverDefault.h"
+
+// Die Pins wie in Qlockthree.ino
+#if defined(SHIFTREGISTER_SPI)
+#define SHIFT "SPI"
+typedef ShiftRegister<DPIN(37, 35, 36, 3), DPIN(37, 35, 36, 5), DPIN(37, 35, 36, 2)> Shift;
+#elif defined(SHIFTREGISTER_USART_SPI)
+#define SHIFT "USART-SPI"
+typedef ShiftRegister<DPIN(43, 41, 42, 1), DPIN(43, 41, 42, 4), DPIN(37, 35, 36, 3)> Shift;
+#else
+#define SHIFT "Bit-Banging"
+typedef ShiftRegister<DPIN(37, 35, 36, 2), DPIN(37, 35, 36, 4), DPIN(37, 35, 36, 3)> Shift;
+#endif
+
+#define ROWS 1000
+
+int main() {
+    HostDs1307 rtc(2);
+    hostBoot(rtc, 10, 21, 0);
+    hostRun(2 * F_CPU);
+#ifdef SHIFTREGISTER_USART_SPI
+    // Die USART gehoert den Shift-Registern, Serial geht ins Leere.
+    CHECK_EQUAL(strlen(halSerialOutput()), (size_t)0);
+#endif
+    halCostModel(true);
+
+    // Zeilen wie im loop()-Betrieb: schieben und uebernehmen.
+    uint64_t start = halCycles();
+    for (int i = 0; i < ROWS; i++) {
+        Shift::prepareShiftregisterWrite();
+        Shift::shiftOut(0xA5A5 ^ i);
+        Shift::shiftOut(1 << (i % 10));
+        Shift::finishShiftregisterWrite();
+    }
+    double row = (double)(halCycles() - start) / ROWS;
+    printf("ROWS,%s,%.0f,%.0f\n", SHIFT, row, F_CPU / row);
+    CHECK(row > 0);
+#ifdef SHIFTREGISTER_HARDWARE
+    // 32 Bit bei F_CPU/2 dauern 64 Takte, mehr als das Doppelte darf es nicht sein.
+    CHECK(row < 2 * 64);
+#endif
+
+#ifdef MULTIPLEX_IN_ISR
+    // Die ISR frischt auf, loop() laeuft nicht.
+    uint64_t isr = halCounters().isrCycles[11] + halCounters().isrCycles[12];
+    start = halCycles();
+    halAdvance(F_CPU);
+    uint64_t elapsed = halCycles() - start;
+    isr = halCounters().isrCycles[11] + halCounters().isrCycles[12] - isr;
+    double rows = (double)elapsed / MULTIPLEX_ROW_DURATION / HAL_CYCLES_PER_US;
+    printf("ISR,%s,%.0f,%.2f\n", SHIFT, isr / rows, 100.0 * isr / elapsed);
+    CHECK(isr > 0);
+#endif
+    return hostTestResult();
+}
@@ -0,0 +1,86 @@
+/**
+ * bench_transition
+ * Laufzeit eines Uebergangsschritts (Transition::nextStep() plus
+ * LedDriverBAM::writeFrameBufferToMatrix()) pro Uebergangsart, also der Teil
+ * von taskTransition(), der alle TRANSITION_STEP_DURATION Millisekunden laeuft.
+ *
+ * Der Schritt ist reiner C-Code ohne Registerzugriffe, das Kostenmodell des
+ * Host-HAL zaehlt ihn also nicht. Gemessen wird deshalb die Zeit auf dem Host,
+ * die Zahlen taugen nur zum Vergleich der Uebergaenge untereinander und vor und
+ * nach Aenderungen.
+ * Nebenbei wird geprueft, dass jeder Uebergang beim Ziel ankommt.
+ *
+ * Ausgabe: STEP,<Uebergang>,<Schritte>,<ns pro Schritt auf dem Host>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include <chrono>
+#include "HostTest.h"
+#include "Configuration.h"
+#include "LedDriverBAM.h"
+#include "Transition.h"
+
+#define RUNS 2000
+
+extern LedDriverBAM <
+  DPIN(37, 35, 36, 2),
+  DPIN(37, 35, 36, 4),
+  DPIN(37, 35, 36, 3),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+
+static const char* const names[] = { "none", "crossfade", "wipe", "letters", "rain" };
+
+static void measure(byte type) {
+    static FrameBuffer frameBuffer;
+    static Transition transition;
+    word from[16];
+    word to[16];
+    memset(from, 0, sizeof(from));
+    memset(to, 0, sizeof(to));
+    for (byte y = 0; y < FRAMEBUFFER_ROWS; y++) {
+        from[y] = (0xAAAA ^ (y * 0x1111)) & 0xFFE0;
+        to[y] = (0x5555 + y * 0x0F0F) & 0xFFE0;
+    }
+    to[0] |= 0x001F;
+
+    unsigned long steps = 0;
+    boolean arrived = true;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < RUNS; i++) {
+        word* target = (i & 1) ? from : to;
+        transition.start(type, target);
+        while (transition.isRunning()) {
+            transition.nextStep(&frameBuffer);
+            ledDriver.writeFrameBufferToMatrix(&frameBuffer);
+            steps++;
+        }
+        word shown[16];
+        frameBuffer.toMatrix(shown, FRAMEBUFFER_MAX);
+        for (byte y = 0; y < FRAMEBUFFER_ROWS; y++) {
+            arrived = arrived && (shown[y] == target[y]);
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    CHECK(arrived);
+    CHECK(steps > 0);
+    printf("STEP,%s,%lu,%.0f\n", names[type], steps / RUNS, (double)elapsed.count() / steps);
+}
+
+int main() {
+    HostDs1307 rtc(2);
+    hostBoot(rtc, 10, 21, 0);
+
+    measure(TRANSITION_NONE);
+    measure(TRANSITION_CROSSFADE);
+    measure(TRANSITION_WIPE);
+    measure(TRANSITION_LETTERS);
+    measure(TRANSITION_RAIN);
+    return hostTestResult();
+}
@@ -0,0 +1,91 @@
+/**
+ * test_crossfade
+ * Ueberblenden zum Minutenwechsel mit LedDriverBAM: LEDs, die vorher und
+ * nachher leuchten, bleiben waehrend des Uebergangs voll hell, nur die
+ * wechselnden LEDs werden dunkler bzw. heller. Gemessen wird an der Matrix
+ * (HostMatrix), also am Ausgang des Treibers. Von 10:21 auf 10:22 bleibt
+ * 'ZWANZIG NACH ZEHN' stehen, eine Eck-LED kommt dazu.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "HostMatrix.h"
+#include "Configuration.h"
+
+// Messfenster (kuerzer als der Uebergang: 16 Schritte zu TRANSITION_STEP_DURATION)
+#define WINDOW (F_CPU / 1000 * 10 * TRANSITION_STEP_DURATION)
+
+static void measure(HostMatrix& matrix, uint64_t on[16][16]) {
+    matrix.reset();
+    hostRun(WINDOW);
+    for (uint8_t row = 0; row < 16; row++) {
+        for (uint8_t bit = 0; bit < 16; bit++) {
+            on[row][bit] = matrix.onCycles(row, bit);
+        }
+    }
+}
+
+int main() {
+    static uint64_t before[16][16], fade[16][16], after[16][16];
+    HostDs1307 rtc(2);
+    HostMatrix matrix(10, 12, 11, 3);
+    // Der LDR skaliert selbst: erst halb, dann ganz hell gibt 100%, damit die
+    // Zwischenstufen nach der Gamma-Korrektur unterscheidbar sind.
+    halSetAnalog(A3, 512);
+    hostBoot(rtc, 10, 21, 55);
+    hostRun(F_CPU / 10);
+    halSetAnalog(A3, 0);
+    matrix.attach();
+
+    while (rtc.getTime() % 60 != 58) {
+        hostRun(F_CPU / 100);
+    }
+    measure(matrix, before);
+    while (rtc.getTime() % 60 != 0) {
+        hostRun(F_CPU / 1000);
+    }
+    measure(matrix, fade);
+    hostRun(2 * F_CPU);
+    measure(matrix, after);
+
+    uint64_t full = 0;
+    for (uint8_t row = 0; row < 16; row++) {
+        for (uint8_t bit = 0; bit < 16; bit++) {
+            full = max(full, before[row][bit]);
+        }
+    }
+    CHECK(full > 0);
+
+    int shared = 0;
+    int fadingOut = 0;
+    int fadingIn = 0;
+    for (uint8_t row = 0; row < 16; row++) {
+        for (uint8_t bit = 0; bit < 16; bit++) {
+            boolean wasOn = before[row][bit] > full / 2;
+            boolean isOn = after[row][bit] > full / 2;
+            if (wasOn && isOn) {
+                // Gemeinsame LEDs: volle Helligkeit auch im Uebergang
+                CHECK(fade[row][bit] * 10 >= before[row][bit] * 9);
+                shared++;
+            } else if (wasOn) {
+                CHECK(fade[row][bit] * 10 < before[row][bit] * 8);
+                fadingOut++;
+            } else if (isOn) {
+                CHECK(fade[row][bit] * 10 < after[row][bit] * 8);
+                fadingIn++;
+            } else {
+                CHECK_EQUAL(fade[row][bit], 0);
+            }
+        }
+    }
+    CHECK(shared > 0);
+    CHECK(fadingOut + fadingIn > 0);
+    printf("CROSSFADE,%d,%d,%d\n", shared, fadingOut, fadingIn);
+    return hostTestResult();
+}
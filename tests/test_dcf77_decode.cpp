@@ -0,0 +1,153 @@
+/**
+ * test_dcf77_decode
+ * MyDCF77::decode() (Felder und Paritaeten aus Tabellen) erschoepfend:
+ * alle Uhrzeiten eines Tages, alle Tage von 2000 bis 2099 mit Wochentag,
+ * Sommerzeit und Schaltsekunde, jedes einzeln gekippte Bit und Felder
+ * ausserhalb ihres Bereichs (bei stimmender Paritaet).
+ *
+ * Die Telegramme laufen als Pulse ueber MyDCF77::edge(), Minute fuer Minute
+ * ohne Luecke. Eine Minute wird mit dem ersten Puls der naechsten
+ * ausgewertet.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Dcf77Signal.h"
+#include "MyDCF77.h"
+
+static MyDCF77 receiver(9, 8);
+static unsigned long minuteStart = 5000;
+
+/*
+ * Die Sekunden 1 bis 58 des Telegramms und die Sekunde 0 der naechsten
+ * Minute einspielen (Bit 0 ist immer 0, die Sekunde 0 des Telegramms kam
+ * schon mit dem Aufruf davor). Zurueck kommt, ob das Telegramm dekodiert
+ * wurde.
+ */
+static boolean decodeTelegram(uint64_t telegram) {
+    Dcf77Trace trace;
+    dcf77AddMinute(trace, telegram, minuteStart);
+    minuteStart += 60000;
+    for (size_t i = 2; i < trace.size(); i++) {
+        receiver.edge(trace[i].active, (word)trace[i].time);
+    }
+    receiver.edge(true, (word)minuteStart);
+    boolean decoded = receiver.newSecond();
+    receiver.edge(false, (word)(minuteStart + 100));
+    return decoded;
+}
+
+static void testAllTimes() {
+    for (int hours = 0; hours < 24; hours++) {
+        for (int minutes = 0; minutes < 60; minutes++) {
+            CHECK(decodeTelegram(dcf77Telegram(minutes, hours, 17, 6, 10, 26)));
+            CHECK_EQUAL(receiver.getDecodeErrors(), 0);
+            CHECK_EQUAL(receiver.getMinutes(), minutes);
+            CHECK_EQUAL(receiver.getHours(), hours);
+        }
+    }
+}
+
+static void testAllDates() {
+    static const byte daysInMonth[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    // Der 1.1.2000 war ein Samstag (DCF77: 1 = Montag, 7 = Sonntag).
+    unsigned long days = 0;
+    for (int year = 0; year < 100; year++) {
+        for (int month = 1; month <= 12; month++) {
+            int length = daysInMonth[month - 1] + ((month == 2) && (year % 4 == 0));
+            for (int date = 1; date <= length; date++, days++) {
+                int dayOfWeek = (5 + days) % 7 + 1;
+                boolean summerTime = (month >= 4) && (month <= 10);
+                boolean leapSecond = (date == 1);
+                CHECK(decodeTelegram(dcf77Telegram(34, 12, date, dayOfWeek, month, year, summerTime, leapSecond)));
+                CHECK_EQUAL(receiver.getDate(), date);
+                CHECK_EQUAL(receiver.getDayOfWeek(), dayOfWeek);
+                CHECK_EQUAL(receiver.getMonth(), month);
+                CHECK_EQUAL(receiver.getYear(), year);
+                CHECK_EQUAL(receiver.isSummerTime(), summerTime);
+                CHECK_EQUAL(receiver.isLeapSecondAnnounced(), leapSecond);
+            }
+        }
+    }
+    CHECK_EQUAL(days, 36525);
+}
+
+/*
+ * Jedes Bit einzeln kippen: die Bits 1 bis 16 (Wetter, Rufbit, A1) sind
+ * egal, A2 kommt als Schaltsekunde durch, alles andere muss an der
+ * passenden Pruefung scheitern (ein gekipptes Datenbit darf zusaetzlich
+ * den Bereich verletzen).
+ */
+static void testSingleBitErrors() {
+    static const uint64_t telegrams[] = {
+        dcf77Telegram(0, 0, 1, 1, 1, 0, false),
+        dcf77Telegram(59, 23, 31, 7, 12, 99),
+        dcf77Telegram(22, 10, 17, 6, 10, 26)
+    };
+    for (byte t = 0; t < sizeof(telegrams) / sizeof(telegrams[0]); t++) {
+        for (byte bit = 1; bit < MYDCF77_TELEGRAMMLAENGE; bit++) {
+            boolean decoded = decodeTelegram(telegrams[t] ^ (1ULL << bit));
+            byte errors = receiver.getDecodeErrors();
+            if (bit <= 16) {
+                CHECK(decoded);
+                CHECK_EQUAL(errors, 0);
+            } else if (bit == 19) {
+                CHECK(decoded);
+                CHECK(receiver.isLeapSecondAnnounced());
+            } else {
+                byte expected = (bit <= 18) ? MYDCF77_ERROR_Z :
+                                (bit == 20) ? MYDCF77_ERROR_S :
+                                (bit <= 28) ? MYDCF77_ERROR_P1 :
+                                (bit <= 35) ? MYDCF77_ERROR_P2 : MYDCF77_ERROR_P3;
+                CHECK(!decoded);
+                CHECK_EQUAL(errors & ~MYDCF77_ERROR_RANGE, expected);
+            }
+        }
+    }
+}
+
+/*
+ * Felder ausserhalb ihres Bereichs oder mit BCD-Ziffern ueber 9, bei
+ * stimmender Paritaet: nur die Bereichspruefung schlaegt an.
+ */
+static void testRange() {
+    struct Case {
+        byte first;
+        byte length;
+        byte raw;
+        boolean valid;
+    };
+    static const Case cases[] = {
+        {21, 7, 0x59, true}, {21, 7, 0x60, false}, {21, 7, 0x0A, false}, {21, 7, 0x7F, false},
+        {29, 6, 0x23, true}, {29, 6, 0x24, false}, {29, 6, 0x1A, false}, {29, 6, 0x3F, false},
+        {36, 6, 0x01, true}, {36, 6, 0x31, true},  {36, 6, 0x00, false}, {36, 6, 0x32, false}, {36, 6, 0x0F, false},
+        {42, 3, 0x01, true}, {42, 3, 0x07, true},  {42, 3, 0x00, false},
+        {45, 5, 0x12, true}, {45, 5, 0x00, false}, {45, 5, 0x13, false}, {45, 5, 0x0A, false},
+        {50, 8, 0x00, true}, {50, 8, 0x99, true},  {50, 8, 0x9A, false}, {50, 8, 0xA0, false}
+    };
+    const uint64_t telegram = dcf77Telegram(22, 10, 17, 6, 10, 26);
+    for (byte i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        boolean decoded = decodeTelegram(dcf77Field(telegram, cases[i].first, cases[i].length, cases[i].raw));
+        CHECK_EQUAL(decoded, cases[i].valid);
+        CHECK_EQUAL(receiver.getDecodeErrors(), cases[i].valid ? 0 : MYDCF77_ERROR_RANGE);
+    }
+}
+
+int main() {
+    // Die erste Minute dient nur zum Einrasten auf den Minutenanfang.
+    receiver.edge(true, (word)minuteStart);
+    receiver.edge(false, (word)(minuteStart + 100));
+    decodeTelegram(dcf77Telegram(21, 10, 17, 6, 10, 26));
+
+    testAllTimes();
+    testAllDates();
+    testSingleBitErrors();
+    testRange();
+    return hostTestResult();
+}
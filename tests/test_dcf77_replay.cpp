@@ -0,0 +1,188 @@
+/**
+ * test_dcf77_replay
+ * Flankenfolgen in MyDCF77::edge() einspielen (MYDCF77_EDGE_INTERRUPT), so
+ * wie sie der Pin-Change-Interrupt mit Zeitstempel aufzeichnet: saubere
+ * Minuten, Zittern der Flanken, Aussetzer im Puls, Stoerpulse zwischen den
+ * Pulsen, Ueberlauf des 16-Bit-Zeitstempels, ein fehlender Puls, ein
+ * falsches Bit und Aus- und Einschalten. Die Auswertung haengt nur an den
+ * Zeitstempeln, nicht daran, wie oft loop() laeuft.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Dcf77Signal.h"
+#include "MyDCF77.h"
+
+#define MINUTE 60000UL
+
+// 17.10.2026 ist ein Samstag
+static const uint64_t minute21 = dcf77Telegram(21, 10, 17, 6, 10, 26);
+static const uint64_t minute22 = dcf77Telegram(22, 10, 17, 6, 10, 26);
+static const uint64_t minute23 = dcf77Telegram(23, 10, 17, 6, 10, 26);
+
+/*
+ * Drei Minuten ab start plus der erste Puls der vierten, damit die letzte
+ * Minute ausgewertet wird.
+ */
+static Dcf77Trace threeMinutes(unsigned long start, int jitter) {
+    Dcf77Trace trace;
+    dcf77AddMinute(trace, minute21, start, jitter);
+    dcf77AddMinute(trace, minute22, start + MINUTE, jitter);
+    dcf77AddMinute(trace, minute23, start + 2 * MINUTE, jitter);
+    trace.push_back({ start + 3 * MINUTE, true });
+    trace.push_back({ start + 3 * MINUTE + 100, false });
+    return trace;
+}
+
+/*
+ * Die Flanken bis einschliesslich until einspielen. Zurueck kommen die
+ * dekodierten Uhrzeiten als hhmm.
+ */
+static std::vector<int> replay(MyDCF77& receiver, const Dcf77Trace& trace, size_t& next, unsigned long until) {
+    std::vector<int> decoded;
+    while ((next < trace.size()) && (trace[next].time <= until)) {
+        receiver.edge(trace[next].active, (word)trace[next].time);
+        next++;
+        if (receiver.newSecond()) {
+            decoded.push_back(receiver.getHours() * 100 + receiver.getMinutes());
+        }
+    }
+    return decoded;
+}
+
+static void checkDate(MyDCF77& receiver) {
+    CHECK_EQUAL(receiver.getDate(), 17);
+    CHECK_EQUAL(receiver.getDayOfWeek(), 6);
+    CHECK_EQUAL(receiver.getMonth(), 10);
+    CHECK_EQUAL(receiver.getYear(), 26);
+    CHECK(receiver.isSummerTime());
+    CHECK(!receiver.isLeapSecondAnnounced());
+}
+
+/*
+ * Die erste Minute faengt irgendwo an, die beiden folgenden muessen kommen.
+ */
+static void checkLastTwo(const std::vector<int>& decoded) {
+    CHECK(decoded.size() >= 2);
+    if (decoded.size() >= 2) {
+        CHECK_EQUAL(decoded[decoded.size() - 2], 1022);
+        CHECK_EQUAL(decoded[decoded.size() - 1], 1023);
+    }
+}
+
+static void testClean() {
+    MyDCF77 receiver(9, 8);
+    Dcf77Trace trace = threeMinutes(5000, 0);
+    size_t next = 0;
+    std::vector<int> decoded = replay(receiver, trace, next, ~0UL);
+    checkLastTwo(decoded);
+    checkDate(receiver);
+    CHECK_EQUAL(receiver.getDecodeErrors(), 0);
+}
+
+static void testNoisy() {
+    MyDCF77 receiver(9, 8);
+    srand(1);
+    Dcf77Trace trace = threeMinutes(5000, 15);
+    for (unsigned long second = 5; second < 3 * 60; second++) {
+        unsigned long start = 5000 + second * 1000;
+        if (second % 5 == 0) {
+            // Aussetzer mitten im Puls
+            dcf77AddGlitch(trace, start + 50, 20, false);
+        }
+        if ((second % 7 == 0) && (second % 60 != 59)) {
+            // Stoerpuls zwischen zwei Pulsen (in der Luecke der 59. Sekunde
+            // sieht er aus wie ein Puls, die Minute waere verloren)
+            dcf77AddGlitch(trace, start + 500, 30, true);
+        }
+    }
+    dcf77Sort(trace);
+    size_t next = 0;
+    checkLastTwo(replay(receiver, trace, next, ~0UL));
+    checkDate(receiver);
+}
+
+static void testWrap() {
+    MyDCF77 receiver(9, 8);
+    // Der 16-Bit-Zeitstempel laeuft mitten in der zweiten Minute ueber.
+    Dcf77Trace trace = threeMinutes(3 * 65536UL - MINUTE - 30000, 0);
+    size_t next = 0;
+    checkLastTwo(replay(receiver, trace, next, ~0UL));
+}
+
+static void testMissingPulse() {
+    MyDCF77 receiver(9, 8);
+    Dcf77Trace trace = threeMinutes(5000, 0);
+    // Sekunde 30 der Minute 10:22 fehlt.
+    unsigned long lost = 5000 + MINUTE + 30 * 1000;
+    trace.erase(std::remove_if(trace.begin(), trace.end(), [lost](const Dcf77Edge& e) {
+        return (e.time >= lost) && (e.time < lost + 500);
+    }), trace.end());
+    size_t next = 0;
+    std::vector<int> decoded = replay(receiver, trace, next, 5000 + 2 * MINUTE);
+    CHECK(std::find(decoded.begin(), decoded.end(), 1022) == decoded.end());
+    CHECK_EQUAL(receiver.getDecodeErrors(), MYDCF77_ERROR_SIGNAL);
+    decoded = replay(receiver, trace, next, ~0UL);
+    CHECK_EQUAL(decoded.size(), 1);
+    CHECK_EQUAL(decoded[0], 1023);
+}
+
+static void testWrongBit() {
+    MyDCF77 receiver(9, 8);
+    Dcf77Trace trace;
+    dcf77AddMinute(trace, minute21, 5000);
+    // Minute 10:22 mit falschem Minutenbit (P1 stimmt nicht mehr)
+    dcf77AddMinute(trace, minute22 ^ (1ULL << 21), 5000 + MINUTE);
+    trace.push_back({ 5000 + 2 * MINUTE, true });
+    trace.push_back({ 5000 + 2 * MINUTE + 100, false });
+    size_t next = 0;
+    std::vector<int> decoded = replay(receiver, trace, next, ~0UL);
+    CHECK(std::find(decoded.begin(), decoded.end(), 1022) == decoded.end());
+    CHECK_EQUAL(receiver.getDecodeErrors(), MYDCF77_ERROR_P1);
+}
+
+/*
+ * Empfaenger aus und wieder an (enable()): aus ist der Pin-Change-Interrupt
+ * aus, beim Einschalten sind Flanken und angefangene Minute von vorher
+ * vergessen, danach wird wieder normal dekodiert.
+ */
+static void testPowerCycle() {
+    MyDCF77 receiver(9, 8);
+    auto pcmsk = digitalPinToPCMSK(9);
+    byte bit = _BV(digitalPinToPCMSKbit(9));
+    CHECK(*pcmsk & bit);
+
+    Dcf77Trace trace = threeMinutes(5000, 0);
+    size_t next = 0;
+    replay(receiver, trace, next, 5000 + MINUTE + 30 * 1000);
+    CHECK(receiver.getBitPointer() > 0);
+    receiver.edgeInterrupt();
+    receiver.enable(false);
+    CHECK(!(*pcmsk & bit));
+    receiver.enable(true);
+    CHECK(*pcmsk & bit);
+    CHECK_EQUAL(receiver.getBitPointer(), 0);
+
+    // Die angefangene Minute 10:22 ist verloren, 10:23 kommt.
+    receiver.poll(false);
+    CHECK(!receiver.newSecond());
+    std::vector<int> decoded = replay(receiver, trace, next, ~0UL);
+    CHECK_EQUAL(decoded.size(), 1);
+    CHECK_EQUAL(decoded[0], 1023);
+}
+
+int main() {
+    testClean();
+    testNoisy();
+    testWrap();
+    testMissingPulse();
+    testWrongBit();
+    testPowerCycle();
+    return hostTestResult();
+}
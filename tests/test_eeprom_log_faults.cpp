@@ -0,0 +1,139 @@
+/**
+ * test_eeprom_log_faults
+ * 100000 Speichervorgaenge im EepromLog, dazwischen immer wieder Stromausfall
+ * mitten im Schreiben (halEepromPowerCut()) und Neustart. Nach jedem Neustart
+ * muss der vorige Stand da sein (die Laufnummer wird zuletzt geschrieben),
+ * nie etwas dazwischen, und der zweite Datensatz (Korrektur der RTC) darf
+ * nicht verloren gehen.
+ *
+ * Am Ende stehen die Schreibzugriffe pro Zelle (halEepromWear()) und wie
+ * lange das Durchsuchen beim Start dauert (Kostenmodell, halCostModel()).
+ *
+ * Ausgabe: CUTS,<Stromausfaelle>
+ *          WEAR,<Speichervorgaenge>,<meiste Schreibzugriffe einer Zelle>,<Mittel>
+ *          LOAD,<Takte>,<Mikrosekunden>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "EepromLog.h"
+
+#define SAVES 100000UL
+// Jeder so vielte Speichervorgang wird vom Stromausfall unterbrochen.
+#define CUT_EVERY 97
+#define RECORD_LENGTH 8
+// Ein Byte ins EEPROM schreiben dauert 3.3ms (ATmega328P).
+#define WRITE_US 3400
+
+/*
+ * Ein Datensatz wie die Einstellungen: pro Speichern aendern sich ein oder
+ * zwei Werte.
+ */
+static void record(unsigned long i, byte data[RECORD_LENGTH]) {
+    for (byte j = 0; j < RECORD_LENGTH; j++) {
+        data[j] = j;
+    }
+    data[i % RECORD_LENGTH] = i;
+    data[(i / 7) % RECORD_LENGTH] ^= i >> 8;
+}
+
+/*
+ * Wie loop(): poll() aufrufen, bis die Seite geschrieben ist, und
+ * dazwischen die Zeit laufen lassen (flush() wuerde das EEPROM in einer
+ * Schleife abfragen, das ist auf dem Host zu langsam).
+ */
+static void finish(EepromLog& log) {
+    while (log.poll()) {
+        halAdvanceMicros(WRITE_US);
+    }
+}
+
+static boolean readRecord(EepromLog& log, byte type, byte data[RECORD_LENGTH]) {
+    return log.read(type, data, RECORD_LENGTH) == RECORD_LENGTH;
+}
+
+int main() {
+    halEepromErase();
+    srand(21);
+
+    EepromLog log;
+    byte committed[RECORD_LENGTH];
+    record(0, committed);
+    log.write(EEPROMLOG_TYPE_SETTINGS, committed, RECORD_LENGTH);
+    finish(log);
+    byte drift[RECORD_LENGTH] = { 0x12, 0x34 };
+    log.write(EEPROMLOG_TYPE_RTCDRIFT, drift, RECORD_LENGTH);
+    finish(log);
+
+    unsigned long cuts = 0;
+    for (unsigned long i = 1; i <= SAVES; i++) {
+        byte data[RECORD_LENGTH];
+        record(i, data);
+        if (i % CUT_EVERY) {
+            log.write(EEPROMLOG_TYPE_SETTINGS, data, RECORD_LENGTH);
+            finish(log);
+            memcpy(committed, data, RECORD_LENGTH);
+            continue;
+        }
+
+        // Der Strom reicht noch fuer 0 bis 16 Zellen.
+        halEepromPowerCut(rand() % (EEPROMLOG_PAGE_SIZE + 1));
+        log.write(EEPROMLOG_TYPE_SETTINGS, data, RECORD_LENGTH);
+        finish(log);
+        if (!halEepromPowerLost()) {
+            halEepromPowerCut(-1);
+            memcpy(committed, data, RECORD_LENGTH);
+            continue;
+        }
+
+        // Neustart: alles Wissen im RAM ist weg.
+        cuts++;
+        halEepromPowerCut(-1);
+        log = EepromLog();
+        byte loaded[RECORD_LENGTH];
+        CHECK(readRecord(log, EEPROMLOG_TYPE_SETTINGS, loaded));
+        CHECK(memcmp(loaded, committed, RECORD_LENGTH) == 0);
+        byte loadedDrift[RECORD_LENGTH];
+        CHECK(readRecord(log, EEPROMLOG_TYPE_RTCDRIFT, loadedDrift));
+        CHECK(memcmp(loadedDrift, drift, RECORD_LENGTH) == 0);
+    }
+    printf("CUTS,%lu\n", cuts);
+    CHECK(cuts > 0);
+
+    // Der letzte Stand kommt auch nach einem normalen Neustart.
+    log = EepromLog();
+    byte loaded[RECORD_LENGTH];
+    CHECK(readRecord(log, EEPROMLOG_TYPE_SETTINGS, loaded));
+    CHECK(memcmp(loaded, committed, RECORD_LENGTH) == 0);
+
+    unsigned long maxWear = 0;
+    unsigned long totalWear = 0;
+    const int cells = EEPROMLOG_PAGES * EEPROMLOG_PAGE_SIZE;
+    for (int a = EEPROMLOG_START; a < EEPROMLOG_START + cells; a++) {
+        maxWear = max(maxWear, (unsigned long)halEepromWear(a));
+        totalWear += halEepromWear(a);
+    }
+    for (int a = 0; a < EEPROMLOG_START; a++) {
+        CHECK_EQUAL(halEepromWear(a), 0);
+    }
+    printf("WEAR,%lu,%lu,%lu\n", SAVES, maxWear, totalWear / cells);
+    // Verteilt auf alle Seiten bis auf die beiden festgehaltenen, mit Reserve.
+    CHECK(maxWear < 2 * SAVES / (EEPROMLOG_PAGES - 2));
+
+    // Beim Start wird einmal das ganze Log durchsucht.
+    log = EepromLog();
+    halCostModel(true);
+    uint64_t start = halCycles();
+    readRecord(log, EEPROMLOG_TYPE_SETTINGS, loaded);
+    uint64_t cycles = halCycles() - start;
+    halCostModel(false);
+    printf("LOAD,%lu,%lu\n", (unsigned long)cycles, (unsigned long)(cycles / HAL_CYCLES_PER_US));
+    CHECK(cycles > 0);
+    return hostTestResult();
+}
@@ -0,0 +1,72 @@
+/**
+ * test_host_boot
+ * Die Firmware startet auf dem Host, liest die Zeit aus der DS1307, meldet
+ * sich ueber Serial, frischt die Matrix auf und nimmt Befehle ueber Serial an.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Settings.h"
+
+extern Settings settings;
+
+int main() {
+    HostDs1307 rtc(2);
+    hostBoot(rtc, 10, 25, 0);
+    CHECK(strlen(halSerialOutput()) > 0);
+
+    uint32_t portWrites = halCounters().portWrites;
+    uint32_t time = rtc.getTime();
+    hostRun(3 * F_CPU);
+    CHECK(halCounters().portWrites > portWrites + 1000);
+    CHECK(rtc.getReads() > 0);
+    CHECK(time % 86400 >= 10 * 3600 + 25 * 60);
+    CHECK_EQUAL(rtc.getTime(), time + 3);
+
+    // Nachtzeiten ueber Serial stellen
+    halSerialClear();
+    halSerialInput("N 2300 0600\n");
+    hostRun(F_CPU / 10);
+    CHECK(strstr(halSerialOutput(), "NIGHT,1380,360") != NULL);
+    CHECK_EQUAL(settings.getNightOff(), 23 * 60);
+    CHECK_EQUAL(settings.getNightOn(), 6 * 60);
+
+    // Eine halbe Zeile haelt loop() nicht auf, die Anzeige laeuft weiter.
+    halSerialClear();
+    halSerialInput("N 2230");
+    portWrites = halCounters().portWrites;
+    hostRun(F_CPU / 10);
+    CHECK(halCounters().portWrites > portWrites + 100);
+    CHECK(strstr(halSerialOutput(), "NIGHT,") == NULL);
+    halSerialInput(" 0700\n");
+    hostRun(F_CPU / 10);
+    CHECK(strstr(halSerialOutput(), "NIGHT,1350,420") != NULL);
+
+    // 'N' allein gibt nur aus, auch ohne Zeilenende (nach einer Sekunde).
+    halSerialClear();
+    halSerialInput("N");
+    hostRun(2 * F_CPU);
+    CHECK(strstr(halSerialOutput(), "NIGHT,1350,420") != NULL);
+
+    // Fehlende, falsche oder ueberzaehlige Felder aendern nichts.
+    const char* invalid[] = {"N 2300\n", "N 2400 0600\n", "N 2360 0600\n", "N 2300 x\n", "N 23000 0600\n",
+                             "N 2300 0600 1\n", "N -100 0600\n", "N 2300 0600                  \n"};
+    for (unsigned int i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        halSerialClear();
+        halSerialInput(invalid[i]);
+        hostRun(F_CPU / 10);
+        if (!strstr(halSerialOutput(), "NIGHT,ERROR")) {
+            fprintf(stderr, "nicht abgelehnt: %s", invalid[i]);
+        }
+        CHECK(strstr(halSerialOutput(), "NIGHT,ERROR") != NULL);
+        CHECK_EQUAL(settings.getNightOff(), 22 * 60 + 30);
+        CHECK_EQUAL(settings.getNightOn(), 7 * 60);
+    }
+    return hostTestResult();
+}
@@ -0,0 +1,269 @@
+/**
+ * test_mode_transitions
+ * Alle erreichbaren Uebergaenge der Modi (Modes.h) aufzaehlen, fuer Alarm
+ * an/aus und LDR an/aus (die Regeln zum Ueberspringen). Ausgehend vom Start
+ * (STD_MODE_NORMAL) wird jede Eingabe der Firmware in jedem erreichten
+ * Zustand ausgeloest: Mode-Taste, H+ und M+ zusammen im Modus 'Blank', der
+ * Timeout der Einstell-Modi, Nacht aus/an (wie taskClock()), Display
+ * aus/an/umschalten (Fernbedienung) und das Abstellen des Weckers.
+ *
+ * Ein Zustand ist der Modus und, bei ausgeschalteter Anzeige, der Modus, zu
+ * dem resume() zurueckkehrt.
+ * Die Firmware muss in jedem Uebergang das tun, was die Regeln in Modes.h
+ * sagen (hier unabhaengig von der Tabelle nachgebaut), die Anzeige ist genau
+ * in 'Blank' und 'Nacht' aus, und jeder Modus ist erreichbar, ausser 'Alarm'
+ * ohne Alarm und 'Helligkeit' mit LDR.
+ *
+ * Ausgabe: TRANSITIONS,<alarm>,<ldr>,<zustaende>,<uebergaenge zwischen modi>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include <set>
+#include <vector>
+#include "HostTest.h"
+#include "Modes.h"
+#include "Settings.h"
+#include "Alarm.h"
+
+extern ModeMachine modes;
+extern Settings settings;
+extern Alarm alarm;
+
+void modePressed();
+void doubleExtModePressed();
+void setDisplayToBlank();
+void setDisplayToResume();
+void setDisplayToToggle();
+
+enum Input {
+    INPUT_MODE,
+    INPUT_EXT,
+    INPUT_TIMEOUT,
+    INPUT_NIGHT_OFF,
+    INPUT_NIGHT_ON,
+    INPUT_BLANK,
+    INPUT_RESUME,
+    INPUT_TOGGLE,
+    INPUT_ALARM_STOP,
+    INPUT_COUNT
+};
+
+struct State {
+    byte mode;
+    byte resume;
+
+    bool operator<(const State& other) const {
+        return (mode < other.mode) || ((mode == other.mode) && (resume < other.resume));
+    }
+};
+
+static boolean isOff(byte mode) {
+    return (mode == STD_MODE_BLANK) || (mode == STD_MODE_NIGHT);
+}
+
+/*
+ * Die Regeln aus Modes.h, ohne die Tabelle: der Folgemodus der Mode-Taste.
+ */
+static byte expectedNext(byte mode, boolean alarmOn, boolean ldrOn) {
+    switch (mode) {
+        case STD_MODE_NORMAL:
+            return alarmOn ? STD_MODE_ALARM : STD_MODE_SECONDS;
+        case STD_MODE_ALARM:
+            return STD_MODE_SECONDS;
+        case STD_MODE_SECONDS:
+            return ldrOn ? STD_MODE_BLANK : STD_MODE_BRIGHTNESS;
+        case STD_MODE_BRIGHTNESS:
+            return STD_MODE_BLANK;
+        case STD_MODE_BLANK:
+        case STD_MODE_NIGHT:
+            return STD_MODE_NORMAL;
+    }
+    return (mode + 1 < MODE_COUNT) ? mode + 1 : STD_MODE_NORMAL;
+}
+
+/*
+ * Der erwartete Zustand nach einer Eingabe. Modi mit ausgeschalteter Anzeige
+ * merken sich den Modus davor fuer resume().
+ */
+static State expected(State state, byte input, boolean alarmOn, boolean ldrOn) {
+    byte mode = state.mode;
+    switch (input) {
+        case INPUT_MODE:
+            mode = expectedNext(mode, alarmOn, ldrOn);
+            break;
+        case INPUT_EXT:
+            mode = EXT_MODE_START;
+            break;
+        case INPUT_TIMEOUT:
+            if ((mode >= EXT_MODE_LDR_MODE) && (mode <= EXT_MODE_TIME_SHIFT)) {
+                mode = STD_MODE_NORMAL;
+            }
+            break;
+        case INPUT_NIGHT_OFF:
+            mode = STD_MODE_NIGHT;
+            break;
+        case INPUT_NIGHT_ON:
+        case INPUT_RESUME:
+            mode = state.resume;
+            break;
+        case INPUT_BLANK:
+            mode = STD_MODE_BLANK;
+            break;
+        case INPUT_TOGGLE:
+            mode = (mode == STD_MODE_BLANK) ? state.resume : STD_MODE_BLANK;
+            break;
+        case INPUT_ALARM_STOP:
+            mode = STD_MODE_NORMAL;
+            break;
+    }
+    State result = { mode, state.resume };
+    if (!isOff(state.mode) && isOff(mode)) {
+        result.resume = state.mode;
+    }
+    // Bei eingeschalteter Anzeige zaehlt der gemerkte Modus nicht, er wird
+    // beim Abschalten ueberschrieben.
+    if (!isOff(mode)) {
+        result.resume = STD_MODE_NORMAL;
+    }
+    return result;
+}
+
+/*
+ * Gibt es die Eingabe im Zustand? (Die Firmware prueft das vor dem Aufruf.)
+ */
+static boolean applies(State state, byte input) {
+    switch (input) {
+        case INPUT_EXT:
+        case INPUT_RESUME:
+            return state.mode == STD_MODE_BLANK;
+        case INPUT_NIGHT_OFF:
+            return state.mode != STD_MODE_NIGHT;
+        case INPUT_NIGHT_ON:
+            return state.mode == STD_MODE_NIGHT;
+        case INPUT_ALARM_STOP:
+            // der Wecker klingelt nur im Modus 'Alarm'
+            return state.mode == STD_MODE_ALARM;
+        case INPUT_TIMEOUT:
+            // haengt nur am Modus, einmal pro Modus reicht (die Minute ist teuer)
+            return state.resume == STD_MODE_NORMAL;
+    }
+    return true;
+}
+
+/*
+ * Die Firmware in den Zustand bringen: resume() merkt sich den letzten Modus
+ * mit eingeschalteter Anzeige.
+ */
+static void enter(State state) {
+    alarm.deactivate();
+    modes.setMode(STD_MODE_NORMAL);
+    modes.setMode(state.resume);
+    if (isOff(state.mode)) {
+        modes.setMode(state.mode);
+    } else {
+        modes.setMode(STD_MODE_BLANK);
+        modes.setMode(state.mode);
+    }
+}
+
+/*
+ * Die Eingabe so ausloesen, wie es die Firmware tut.
+ */
+static void trigger(byte input) {
+    switch (input) {
+        case INPUT_MODE:
+            modePressed();
+            break;
+        case INPUT_EXT:
+            doubleExtModePressed();
+            break;
+        case INPUT_TIMEOUT:
+            halAdvanceMicros(EXT_MODE_TIMEOUT * 1000000ULL);
+            modes.poll();
+            break;
+        case INPUT_NIGHT_OFF:
+            modes.setMode(STD_MODE_NIGHT);
+            break;
+        case INPUT_NIGHT_ON:
+            modes.resume();
+            break;
+        case INPUT_BLANK:
+            setDisplayToBlank();
+            break;
+        case INPUT_RESUME:
+            setDisplayToResume();
+            break;
+        case INPUT_TOGGLE:
+            setDisplayToToggle();
+            break;
+        case INPUT_ALARM_STOP:
+            alarm.activate();
+            modePressed();
+            break;
+    }
+}
+
+static void enumerate(boolean alarmOn, boolean ldrOn) {
+    settings.setEnableAlarm(alarmOn);
+    settings.setUseLdr(ldrOn);
+
+    std::set<State> seen;
+    std::vector<State> todo;
+    std::set<std::pair<byte, byte> > transitions;
+    boolean reached[MODE_COUNT] = {};
+    State start = { STD_MODE_NORMAL, STD_MODE_NORMAL };
+    seen.insert(start);
+    todo.push_back(start);
+    while (!todo.empty()) {
+        State state = todo.back();
+        todo.pop_back();
+        reached[state.mode] = true;
+        for (byte input = 0; input < INPUT_COUNT; input++) {
+            if (!applies(state, input)) {
+                continue;
+            }
+            enter(state);
+            CHECK_EQUAL(modes.getMode(), state.mode);
+            trigger(input);
+            State next = expected(state, input, alarmOn, ldrOn);
+            if (modes.getMode() != next.mode) {
+                fprintf(stderr, "Modus %d, Eingabe %d: %d statt %d\n", state.mode, input, modes.getMode(), next.mode);
+            }
+            CHECK_EQUAL(modes.getMode(), next.mode);
+            CHECK_EQUAL(modes.isDisplayOff(), isOff(next.mode));
+            if (next.mode != state.mode) {
+                transitions.insert(std::make_pair(state.mode, next.mode));
+            }
+            if (seen.insert(next).second) {
+                todo.push_back(next);
+            }
+        }
+    }
+
+    for (byte mode = 0; mode < MODE_COUNT; mode++) {
+        boolean unreachable = ((mode == STD_MODE_ALARM) && !alarmOn) || ((mode == STD_MODE_BRIGHTNESS) && ldrOn);
+        if (reached[mode] == unreachable) {
+            fprintf(stderr, "Modus %d: erreichbar %d\n", mode, reached[mode]);
+        }
+        CHECK_EQUAL(reached[mode], !unreachable);
+    }
+    printf("TRANSITIONS,%d,%d,%lu,%lu\n", alarmOn, ldrOn, (unsigned long)seen.size(), (unsigned long)transitions.size());
+}
+
+int main() {
+    HostDs1307 rtc(2);
+    hostBoot(rtc, 10, 21, 0);
+    hostRun(F_CPU / 10);
+
+    enumerate(false, false);
+    enumerate(true, false);
+    enumerate(false, true);
+    enumerate(true, true);
+    return hostTestResult();
+}
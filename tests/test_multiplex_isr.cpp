@@ -0,0 +1,113 @@
+/**
+ * test_multiplex_isr
+ * LedDriverDefault mit MULTIPLEX_IN_ISR: Zeilentakt und Tastgrad kommen aus
+ * Timer1 und bleiben stabil, auch wenn loop() unter Last steht und kurze
+ * Abschnitte mit gesperrten Interrupts hat.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Configuration.h"
+#include "LedDriverDefault.h"
+
+extern LedDriverDefault <
+  DPIN(37, 35, 36, 2),
+  DPIN(37, 35, 36, 4),
+  DPIN(37, 35, 36, 3),
+  DPIN(43, 41, 42, 3), 10 > ledDriver;
+
+#define PIN_LATCH 11
+#define PIN_OE 3
+// Laengster Abschnitt mit gesperrten Interrupts in der Last (Mikrosekunden)
+#define LOAD_MAX_CLI 20
+
+static uint64_t lastLatch;
+static uint64_t oeLowAt;
+static uint64_t minRow = UINT64_MAX;
+static uint64_t maxRow;
+static uint64_t minOn = UINT64_MAX;
+static uint64_t maxOn;
+static uint64_t onCycles;
+static uint32_t rows;
+static boolean measuring;
+
+static void onPin(uint8_t pin, uint8_t level) {
+    if (!measuring) {
+        return;
+    }
+    uint64_t now = halCycles();
+    if ((pin == PIN_LATCH) && level) {
+        if (lastLatch) {
+            uint64_t row = now - lastLatch;
+            minRow = min(minRow, row);
+            maxRow = max(maxRow, row);
+            rows++;
+        }
+        lastLatch = now;
+    } else if (pin == PIN_OE) {
+        if (!level) {
+            oeLowAt = now;
+        } else if (oeLowAt) {
+            uint64_t on = now - oeLowAt;
+            minOn = min(minOn, on);
+            maxOn = max(maxOn, on);
+            onCycles += on;
+            oeLowAt = 0;
+        }
+    }
+}
+
+int main() {
+    HostDs1307 rtc(2);
+    halSetAnalog(A3, 512);
+    hostBoot(rtc, 10, 25, 5);
+    hostRun(F_CPU / 2);
+
+    byte brightness = ledDriver.getBrightness();
+    halOnPinChange(onPin);
+    measuring = true;
+    uint64_t start = halCycles();
+
+    // Synthetische Last: Rechenbloecke von bis zu 2ms zwischen den Durchlaeufen
+    // von loop(), ab und zu mit gesperrten Interrupts (wie ein Zugriff auf den Bus).
+    srand(1);
+    while (halCycles() < start + 10 * F_CPU) {
+        loop();
+        halAdvance(HOST_LOOP_CYCLES + rand() % (2000 * HAL_CYCLES_PER_US));
+        if (rand() % 4 == 0) {
+            cli();
+            halAdvance(1 + rand() % (LOAD_MAX_CLI * HAL_CYCLES_PER_US));
+            sei();
+        }
+    }
+    measuring = false;
+    uint64_t elapsed = halCycles() - start;
+
+    uint64_t rowCycles = (uint64_t)MULTIPLEX_ROW_DURATION * HAL_CYCLES_PER_US;
+    uint64_t onTime = (uint64_t)brightness * PWM_DURATION * HAL_CYCLES_PER_US;
+    uint64_t jitter = LOAD_MAX_CLI * HAL_CYCLES_PER_US;
+
+    CHECK_EQUAL(ledDriver.getBrightness(), brightness);
+    CHECK(brightness > 0);
+    // Eine Zeile pro MULTIPLEX_ROW_DURATION, verschoben hoechstens um die Sperrzeit
+    CHECK(rows > 0);
+    CHECK(llabs((long long)(elapsed / rowCycles) - rows) <= 1);
+    CHECK(minRow + jitter >= rowCycles);
+    CHECK(maxRow <= rowCycles + jitter);
+    // Anzeit pro Zeile ueber Compare-Match B
+    CHECK(minOn + jitter >= onTime);
+    CHECK(maxOn <= onTime + jitter);
+    // Tastgrad = Helligkeit, auf ein Prozent
+    double duty = (double)onCycles / elapsed;
+    CHECK(fabs(duty - brightness / 100.0) < 0.01);
+    printf("ROWS,%u,%.1f,%.1f,%.1f,%.1f,%.4f,%u\n", rows,
+        (double)minRow / HAL_CYCLES_PER_US, (double)maxRow / HAL_CYCLES_PER_US,
+        (double)minOn / HAL_CYCLES_PER_US, (double)maxOn / HAL_CYCLES_PER_US, duty, brightness);
+    return hostTestResult();
+}
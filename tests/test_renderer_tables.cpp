@@ -0,0 +1,82 @@
+/**
+ * test_renderer_tables
+ * Renderer::setMinutes() mit den PROGMEM-Tabellen gegen die alte Fassung mit
+ * den verschachtelten switch-Bloecken (V 3.4.9): alle Sprachen, Stunden
+ * -13 bis 36 (Uhrzeit plus Zeitverschiebung) und Minuten.
+ *
+ * Verglichen wird ueber eine FNV-1a-Pruefsumme aller Bildschirm-Puffer pro
+ * Sprache. Die Sollwerte hat dieselbe Schleife mit Renderer.cpp und
+ * Woerter_*.h aus V 3.4.9 berechnet.
+ *
+ * Ausgenommen sind die Stunden 24 und 36 (Mitternacht mit Zeitverschiebung):
+ * die alte Fassung kannte dort die folgende Stunde 25 nicht und liess ab
+ * 'fuenf vor halb' das Stundenwort weg. Dafuer wird geprueft, dass sie
+ * genauso aussehen wie Stunde 0.
+ *
+ * Ausgabe: RENDER,<Sprache>,<Pruefsumme>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Renderer.h"
+
+static const uint32_t expected[LANGUAGE_COUNT + 1] = {
+    0x909908C8, // LANGUAGE_DE_DE
+    0xF3A36845, // LANGUAGE_DE_SW
+    0x0EBDA668, // LANGUAGE_DE_BA
+    0x6EB8B8E8, // LANGUAGE_DE_SA
+    0xC9B52BCA, // LANGUAGE_CH
+    0x4A4C5AA0, // LANGUAGE_EN
+    0x8D09D66B, // LANGUAGE_FR
+    0xC44A162E, // LANGUAGE_IT
+    0x8776DFA5, // LANGUAGE_NL
+    0xD693A89D  // LANGUAGE_ES
+};
+
+static Renderer testRenderer;
+
+static void render(char hours, byte minutes, byte language, word matrix[16]) {
+    testRenderer.clearScreenBuffer(matrix);
+    testRenderer.setMinutes(hours, minutes, language, matrix);
+}
+
+int main() {
+    for (byte language = 0; language <= LANGUAGE_COUNT; language++) {
+        if (!Renderer::isLanguageEnabled(language)) {
+            continue;
+        }
+        uint32_t hash = 2166136261UL;
+        for (int hours = -13; hours <= 36; hours++) {
+            if ((hours == 24) || (hours == 36)) {
+                continue;
+            }
+            for (byte minutes = 0; minutes < 60; minutes++) {
+                word matrix[16];
+                render(hours, minutes, language, matrix);
+                for (byte i = 0; i < 16; i++) {
+                    hash = (hash ^ lowByte(matrix[i])) * 16777619UL;
+                    hash = (hash ^ highByte(matrix[i])) * 16777619UL;
+                }
+            }
+        }
+        printf("RENDER,%u,0x%08X\n", language, (unsigned int)hash);
+        CHECK_EQUAL(hash, expected[language]);
+
+        for (byte minutes = 0; minutes < 60; minutes++) {
+            word midnight[16];
+            word shifted[16];
+            render(0, minutes, language, midnight);
+            render(24, minutes, language, shifted);
+            CHECK(memcmp(midnight, shifted, sizeof(midnight)) == 0);
+            render(36, minutes, language, shifted);
+            CHECK(memcmp(midnight, shifted, sizeof(midnight)) == 0);
+        }
+    }
+    return hostTestResult();
+}
@@ -0,0 +1,58 @@
+/**
+ * test_rtc_drift
+ * Die Software-Korrektur der DS1307 (RtcDrift::tick(), ENABLE_RTC_DRIFT):
+ * Mit der groessten Korrektur (50 ppm, RTC zu schnell) wird die RTC nach
+ * 20000 Sekunden genau einmal um eine Sekunde zurueckgestellt, ausserhalb des
+ * Minutenwechsels. tick() laeuft jede Sekunde nach rtc.refresh() wie in
+ * taskUpdate() und darf die RTC dabei nie lesen, nur das eine Mal schreiben.
+ *
+ * Ausgabe: DRIFT,<korrektur in 0.1 ppm>,<sekunden>,<korrekturen>
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "MyRTC.h"
+#include "RtcDrift.h"
+
+extern MyRTC rtc;
+extern RtcDrift rtcDrift;
+
+int main() {
+    HostDs1307 chip(2);
+    hostBoot(chip, 10, 20, 30);
+    hostRun(F_CPU / 10);
+
+    // 25 Sekunden in einem Tag: mehr als RTCDRIFT_MAX_CORRECTION.
+    rtcDrift.synced(rtc, 0, 0);
+    rtcDrift.synced(rtc, RTCDRIFT_MIN_SPAN, 25);
+    CHECK_EQUAL(rtcDrift.getCorrection(), RTCDRIFT_MAX_CORRECTION);
+
+    // Timer2 (Fernbedienung, alle 50 us) anhalten, sonst dauern die Stunden.
+    TCCR2B = 0;
+    uint32_t start = chip.getTime();
+    unsigned long seconds = 21000;
+    int corrections = 0;
+    for (unsigned long i = 0; i < seconds; i++) {
+        halAdvanceMicros(1000000);
+        rtc.refresh();
+        uint32_t reads = chip.getReads();
+        uint32_t writes = chip.getWrites();
+        rtcDrift.tick(rtc);
+        CHECK_EQUAL(chip.getReads(), reads);
+        if (chip.getWrites() != writes) {
+            corrections++;
+            CHECK((rtc.getSeconds() >= 5) && (rtc.getSeconds() <= 54));
+        }
+    }
+    CHECK_EQUAL(corrections, 1);
+    // Die RTC des Hosts geht richtig, nach der Korrektur also eine Sekunde nach.
+    CHECK_EQUAL(chip.getTime(), start + seconds - 1);
+    printf("DRIFT,%d,%lu,%d\n", rtcDrift.getCorrection(), seconds, corrections);
+    return hostTestResult();
+}
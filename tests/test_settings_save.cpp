@@ -0,0 +1,43 @@
+/**
+ * test_settings_save
+ * Settings speichert verzoegert: eine Aenderung geht erst SETTINGS_SAVE_DELAY ms
+ * spaeter ins EEPROM, saveToEEPROM() (Verlassen der erweiterten Modi) sofort.
+ * Ein saveToEEPROM() ohne Aenderung darf die Verzoegerung der naechsten
+ * Aenderung nicht aushebeln.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Settings.h"
+#include "EepromLog.h"
+
+int main() {
+    Settings testSettings;
+    eepromLog.flush();
+
+    // Nichts geaendert, nichts zu schreiben.
+    testSettings.saveToEEPROM();
+    CHECK(!eepromLog.isBusy());
+
+    // Die naechste Aenderung wartet trotzdem.
+    testSettings.setBrightness(testSettings.getBrightness() == 50 ? 60 : 50);
+    testSettings.poll();
+    CHECK(!eepromLog.isBusy());
+    halAdvanceMicros((SETTINGS_SAVE_DELAY + 10) * 1000UL);
+    testSettings.poll();
+    CHECK(eepromLog.isBusy());
+    eepromLog.flush();
+
+    // Mit Aenderung schreibt saveToEEPROM() sofort.
+    testSettings.setBrightness(testSettings.getBrightness() == 50 ? 60 : 50);
+    testSettings.saveToEEPROM();
+    CHECK(eepromLog.isBusy());
+    eepromLog.flush();
+    return hostTestResult();
+}
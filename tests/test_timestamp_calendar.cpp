@@ -0,0 +1,103 @@
+/**
+ * test_timestamp_calendar
+ * Der Kalender in TimeStamp (2000 bis 2099) gegen timegm()/gmtime() der
+ * C-Bibliothek: jeder Tag mit Tagen seit 2000, Wochentag, Monatslaenge und
+ * Schaltjahr, dazu die letzten und n-ten Sonntage und die Sommerzeitregeln
+ * (EU und US, mehrere Zeitzonen) stuendlich gegen die POSIX-TZ-Regeln.
+ *
+ * @mc       Linux/g++
+ * @autor    David Weese / dave.weese _AT_ gmail _DOT_ com
+ * @version  1.0
+ * @created  17.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include <time.h>
+#include "HostTest.h"
+#include "TimeStamp.h"
+
+static time_t utc(int year, int month, int date) {
+    struct tm tm = {};
+    tm.tm_year = 100 + year;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = date;
+    return timegm(&tm);
+}
+
+static void testDays() {
+    const time_t start = utc(0, 1, 1);
+    unsigned long days = 0;
+    for (time_t t = start; t < utc(100, 1, 1); t += 86400, days++) {
+        struct tm tm;
+        gmtime_r(&t, &tm);
+        byte date = tm.tm_mday;
+        byte month = tm.tm_mon + 1;
+        byte year = tm.tm_year - 100;
+        CHECK_EQUAL(TimeStamp::daysSince2000(date, month, year), days);
+        CHECK_EQUAL(TimeStamp::minutesSince2000(59, 23, date, month, year), days * 1440 + 1439);
+        // tm_wday: 0 = Sonntag, DCF77: 7 = Sonntag
+        CHECK_EQUAL(TimeStamp::dayOfWeek(date, month, year), (tm.tm_wday + 6) % 7 + 1);
+        CHECK_EQUAL(TimeStamp::isLeapYear(year), utc(year, 3, 1) - utc(year, 2, 1) == 29 * 86400L);
+
+        // Der Tag danach ist der Erste, wenn der Monat zu Ende ist.
+        time_t next = t + 86400;
+        struct tm following;
+        gmtime_r(&next, &following);
+        CHECK_EQUAL(following.tm_mday == 1, date == TimeStamp::daysInMonth(month, year));
+    }
+    CHECK_EQUAL(days, 36525);
+}
+
+static void testSundays() {
+    for (byte year = 0; year < 100; year++) {
+        for (byte month = 1; month <= 12; month++) {
+            byte sundays[5];
+            byte count = 0;
+            for (byte date = 1; date <= TimeStamp::daysInMonth(month, year); date++) {
+                time_t t = utc(year, month, date);
+                struct tm tm;
+                gmtime_r(&t, &tm);
+                if (tm.tm_wday == 0) {
+                    sundays[count++] = date;
+                }
+            }
+            CHECK_EQUAL(TimeStamp::lastSunday(month, year), sundays[count - 1]);
+            for (byte n = 1; n <= 4; n++) {
+                CHECK_EQUAL(TimeStamp::nthSunday(n, month, year), sundays[n - 1]);
+            }
+        }
+    }
+}
+
+/*
+ * Sommerzeit stuendlich gegen tm_isdst aus localtime_r() mit der TZ-Regel.
+ * Die Umstellungen liegen alle auf vollen Stunden.
+ */
+static void testSummerTime(byte rule, int utcOffset, const char* tz) {
+    setenv("TZ", tz, 1);
+    tzset();
+    const time_t start = utc(0, 1, 2);
+    for (time_t t = start; t < utc(100, 1, 1); t += 3600) {
+        struct tm tm;
+        localtime_r(&t, &tm);
+        unsigned long standardMinutes = (t - utc(0, 1, 1)) / 60 + utcOffset;
+        // Das Jahr der Normalzeit, an Silvester kann es vom UTC-Jahr abweichen.
+        time_t standard = t + utcOffset * 60L;
+        struct tm local;
+        gmtime_r(&standard, &local);
+        boolean summer = TimeStamp::isSummerTime(rule, standardMinutes, local.tm_year - 100, utcOffset);
+        CHECK_EQUAL(summer, tm.tm_isdst > 0);
+    }
+}
+
+int main() {
+    testDays();
+    testSundays();
+    testSummerTime(TIMESTAMP_DST_EU, 0, "GMT0BST,M3.5.0/1,M10.5.0");
+    testSummerTime(TIMESTAMP_DST_EU, 60, "CET-1CEST,M3.5.0,M10.5.0/3");
+    testSummerTime(TIMESTAMP_DST_EU, 120, "EET-2EEST,M3.5.0/3,M10.5.0/4");
+    testSummerTime(TIMESTAMP_DST_US, -300, "EST5EDT,M3.2.0,M11.1.0");
+    testSummerTime(TIMESTAMP_DST_US, -480, "PST8PDT,M3.2.0,M11.1.0");
+    return hostTestResult();
+}
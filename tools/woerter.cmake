@@ -0,0 +1,218 @@
+# woerter
+# Erzeugt die Worttabelle XX_WORDS in Woerter_XX.h aus der Front in
+# layouts/XX.txt (Aufbau siehe dort): die Spalte jedes Wortes wird in seiner
+# Zeile gesucht, die Laenge ist die des Textes. Ersetzt wird der Kommentar
+# 'Die Woerter als Zeile, Startspalte und Laenge.' bis zum Ende der Tabelle,
+# die #defines der Woerter bleiben von Hand und werden gegen die Indizes der
+# Tabelle geprueft.
+#
+# Aufruf (die Ziele 'woerter' bzw. test_woerter_XX in CMakeLists.txt):
+#   cmake -DLAYOUT=<layouts/XX.txt> -DHEADER=<Woerter_XX.h> -DMODE=UPDATE|CHECK -P woerter.cmake
+# UPDATE schreibt die Tabelle in den Header, CHECK bricht ab, wenn sie nicht
+# zur Front passt.
+cmake_minimum_required(VERSION 3.13)
+
+set(ROWS 10)
+set(COLUMNS 11)
+
+get_filename_component(layout_name ${LAYOUT} NAME)
+
+# Umlaute sind in UTF-8 zwei Bytes, fuer die Suche zaehlen sie als eines.
+function(normalize out text)
+  string(REPLACE "Ä" "a" text "${text}")
+  string(REPLACE "Ö" "o" text "${text}")
+  string(REPLACE "Ü" "u" text "${text}")
+  set(${out} "${text}" PARENT_SCOPE)
+endfunction()
+
+function(fail message)
+  message(FATAL_ERROR "${layout_name}: ${message}")
+endfunction()
+
+file(STRINGS ${LAYOUT} lines ENCODING UTF-8)
+set(section)
+set(prefix)
+set(front)
+set(grid)
+set(words)
+foreach(line IN LISTS lines)
+  string(STRIP "${line}" line)
+  if(line STREQUAL "" OR line MATCHES "^#")
+    continue()
+  endif()
+  if(line MATCHES "^PRAEFIX ([A-Z]+)$")
+    set(prefix ${CMAKE_MATCH_1})
+  elseif(line STREQUAL "FRONT" OR line STREQUAL "WOERTER")
+    set(section ${line})
+  elseif(section STREQUAL "FRONT")
+    normalize(row "${line}")
+    string(LENGTH "${row}" length)
+    if(NOT length EQUAL COLUMNS)
+      fail("Zeile '${line}' hat ${length} statt ${COLUMNS} Buchstaben")
+    endif()
+    list(APPEND front "${row}")
+    list(APPEND grid "${line}")
+  elseif(section STREQUAL "WOERTER")
+    list(APPEND words "${line}")
+  else()
+    fail("unbekannte Zeile '${line}'")
+  endif()
+endforeach()
+list(LENGTH front count)
+if(NOT count EQUAL ROWS)
+  fail("FRONT hat ${count} statt ${ROWS} Zeilen")
+endif()
+if(NOT prefix)
+  fail("PRAEFIX fehlt")
+endif()
+
+file(READ ${HEADER} header)
+
+# Die Eintraege der Tabelle, der Name steht beim ersten Teil eines Wortes.
+set(codes)
+set(names)
+set(index 1)
+foreach(word IN LISTS words)
+  if(NOT word MATCHES "^([A-Z0-9_]+)[ ]+(.+)$")
+    fail("Wort '${word}' ist nicht <NAME> <zeile>:<text> ...")
+  endif()
+  set(name ${CMAKE_MATCH_1})
+  string(REGEX MATCHALL "[^ ]+" parts "${CMAKE_MATCH_2}")
+
+  if(NOT header MATCHES "\n#define ${prefix}_${name}[ ]+([0-9]+)")
+    fail("${prefix}_${name} fehlt in ${HEADER}")
+  endif()
+  if(NOT CMAKE_MATCH_1 EQUAL index)
+    fail("${prefix}_${name} ist ${CMAKE_MATCH_1} in ${HEADER}, in der Tabelle ${index}")
+  endif()
+
+  list(LENGTH parts remaining)
+  foreach(part IN LISTS parts)
+    set(column)
+    if(part MATCHES "^([0-9]):([0-9]+):(.+)$")
+      set(row ${CMAKE_MATCH_1})
+      set(column ${CMAKE_MATCH_2})
+      set(text "${CMAKE_MATCH_3}")
+    elseif(part MATCHES "^([0-9]):(.+)$")
+      set(row ${CMAKE_MATCH_1})
+      set(text "${CMAKE_MATCH_2}")
+    else()
+      fail("${name}: '${part}' ist nicht <zeile>:<text>")
+    endif()
+    normalize(text "${text}")
+    string(LENGTH "${text}" length)
+    list(GET front ${row} letters)
+
+    # Alle Stellen, an denen der Text in der Zeile steht.
+    set(found)
+    math(EXPR last "${COLUMNS} - ${length}")
+    if(last GREATER_EQUAL 0)
+      foreach(start RANGE 0 ${last})
+        string(SUBSTRING "${letters}" ${start} ${length} candidate)
+        if(candidate STREQUAL text)
+          list(APPEND found ${start})
+        endif()
+      endforeach()
+    endif()
+    list(LENGTH found matches)
+    if(matches EQUAL 0)
+      fail("${name}: '${text}' steht nicht in Zeile ${row} (${letters})")
+    endif()
+    if("${column}" STREQUAL "")
+      if(matches GREATER 1)
+        fail("${name}: '${text}' steht mehrmals in Zeile ${row}, Spalte angeben (${row}:<spalte>:${text})")
+      endif()
+      set(column ${found})
+    elseif(NOT column IN_LIST found)
+      fail("${name}: '${text}' steht nicht in Zeile ${row} ab Spalte ${column}")
+    endif()
+
+    # WORD_LAYOUT(%d, %2d, %2d)
+    if(column LESS 10)
+      set(column " ${column}")
+    endif()
+    if(length LESS 10)
+      set(length " ${length}")
+    endif()
+    set(code "WORD_LAYOUT(${row}, ${column}, ${length})")
+    math(EXPR remaining "${remaining} - 1")
+    if(remaining GREATER 0)
+      string(APPEND code " | WORD_MORE")
+    endif()
+    list(APPEND codes "${code}")
+    list(APPEND names "${name}")
+    set(name "-")
+    math(EXPR index "${index} + 1")
+  endforeach()
+endforeach()
+
+# Die Tabelle wie von Hand: Komma ausser beim letzten Eintrag, die Namen in
+# einer Spalte.
+list(LENGTH codes count)
+math(EXPR last "${count} - 1")
+set(table "    0,\n")
+foreach(i RANGE 0 ${last})
+  list(GET codes ${i} code)
+  list(GET names ${i} name)
+  if(i LESS last)
+    string(APPEND code ",")
+  endif()
+  if(name STREQUAL "-")
+    string(APPEND table "    ${code}\n")
+  else()
+    string(LENGTH "${code}" width)
+    while(width LESS 35)
+      string(APPEND code " ")
+      math(EXPR width "${width} + 1")
+    endwhile()
+    string(APPEND table "    ${code}  // ${name}\n")
+  endif()
+endforeach()
+
+set(grid_comment " *\n *   01234567890\n")
+set(row 0)
+foreach(line IN LISTS grid)
+  string(APPEND grid_comment " * ${row} ${line}\n")
+  math(EXPR row "${row} + 1")
+endforeach()
+
+get_filename_component(layout_dir ${LAYOUT} DIRECTORY)
+get_filename_component(layout_dir ${layout_dir} NAME)
+set(generated "/**
+ * Die Woerter als Zeile, Startspalte und Laenge. Index 0 ist 'kein Wort'.
+ * Woerter aus mehreren Teilen (z.B. ES IST) haben WORD_MORE bis auf den letzten Teil.
+${grid_comment} *
+ * Erzeugt mit tools/woerter.cmake aus ${layout_dir}/${layout_name}, nicht von Hand aendern.
+ */
+extern const word ${prefix}_WORDS[] PROGMEM;
+const word ${prefix}_WORDS[] = {
+${table}};
+")
+
+# Vom Kommentar der Tabelle bis zu ihrem Ende ersetzen.
+string(FIND "${header}" "/**\n * Die Woerter als Zeile, Startspalte und Laenge." begin)
+if(begin EQUAL -1)
+  fail("keine Tabelle in ${HEADER}")
+endif()
+string(SUBSTRING "${header}" ${begin} -1 rest)
+string(FIND "${rest}" "\n};\n" end)
+if(end EQUAL -1)
+  fail("Ende der Tabelle in ${HEADER} fehlt")
+endif()
+math(EXPR end "${begin} + ${end} + 4")
+string(SUBSTRING "${header}" 0 ${begin} before)
+string(SUBSTRING "${header}" ${end} -1 after)
+set(updated "${before}${generated}${after}")
+
+if(MODE STREQUAL "UPDATE")
+  if(NOT updated STREQUAL header)
+    file(WRITE ${HEADER} "${updated}")
+    message("${HEADER} aus ${layout_name} erzeugt")
+  endif()
+elseif(MODE STREQUAL "CHECK")
+  if(NOT updated STREQUAL header)
+    fail("${HEADER} passt nicht zur Front, neu erzeugen mit 'cmake --build <build> --target woerter'")
+  endif()
+else()
+  message(FATAL_ERROR "MODE muss UPDATE oder CHECK sein")
+endif()